@@ -4,10 +4,32 @@
 
 namespace CppSharp.AST
 {
+    public enum ExpressionValueKind
+    {
+        None,
+        SignedInteger,
+        UnsignedInteger,
+        Boolean,
+        Character,
+        Float,
+        String,
+        NullPtr
+    }
+
     public abstract class Expression : Statement
     {
         public string DebugText;
 
+        /// <summary>
+        /// The kind of value the expression folds to, if it is a constant
+        /// expression. Integers, booleans and characters are in IntegerValue,
+        /// signed values being sign extended.
+        /// </summary>
+        public ExpressionValueKind ValueKind { get; set; }
+        public ulong IntegerValue { get; set; }
+        public double FloatValue { get; set; }
+        public string StringValue { get; set; }
+
         public abstract TV Visit<TV>(IExpressionVisitor<TV> visitor);
 
         public abstract Expression Clone();
@@ -53,7 +75,11 @@ public override Expression Clone()
                 DebugText = this.DebugText,
                 Class = this.Class,
                 Declaration = this.Declaration,
-                String = this.String
+                String = this.String,
+                ValueKind = this.ValueKind,
+                IntegerValue = this.IntegerValue,
+                FloatValue = this.FloatValue,
+                StringValue = this.StringValue
             };
         }
     }
@@ -83,7 +109,11 @@ public override Expression Clone()
             {
                 DebugText = this.DebugText,
                 Declaration = this.Declaration,
-                String = this.String
+                String = this.String,
+                ValueKind = this.ValueKind,
+                IntegerValue = this.IntegerValue,
+                FloatValue = this.FloatValue,
+                StringValue = this.StringValue
             };
         }
     }
@@ -109,7 +139,11 @@ public override Expression Clone()
             {
                 DebugText = this.DebugText,
                 Declaration = this.Declaration,
-                String = this.String
+                String = this.String,
+                ValueKind = this.ValueKind,
+                IntegerValue = this.IntegerValue,
+                FloatValue = this.FloatValue,
+                StringValue = this.StringValue
             };
             clone.Arguments.AddRange(Arguments.Select(a => a.Clone()));
             return clone;
@@ -137,7 +171,11 @@ public override Expression Clone()
             {
                 DebugText = this.DebugText,
                 Declaration = this.Declaration,
-                String = this.String
+                String = this.String,
+                ValueKind = this.ValueKind,
+                IntegerValue = this.IntegerValue,
+                FloatValue = this.FloatValue,
+                StringValue = this.StringValue
             };
             clone.Arguments.AddRange(Arguments.Select(a => a.Clone()));
             return clone;
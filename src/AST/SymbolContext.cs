@@ -43,6 +43,26 @@ public NativeLibrary()
         public IList<string> Dependencies { get; private set; }
     }
 
+    /// <summary>
+    /// Looks up symbols in place of the symbol index of a symbol context,
+    /// e.g. through the native symbol index of the parser.
+    /// </summary>
+    public interface ISymbolResolver
+    {
+        /// <summary>
+        /// Finds the library with the symbol, or returns null.
+        /// </summary>
+        NativeLibrary FindLibraryBySymbol(string symbol);
+
+        /// <summary>
+        /// Resolves the symbols against their mangling variants, like
+        /// SymbolContext.FindSymbol, replacing each found symbol with the
+        /// spelling it was found with. Returns the library of each symbol,
+        /// or null for the symbols not found.
+        /// </summary>
+        NativeLibrary[] ResolveSymbols(IList<string> symbols);
+    }
+
     public class SymbolContext
     {
         /// <summary>
@@ -55,6 +75,11 @@ public class SymbolContext
         /// </summary>
         public Dictionary<string, NativeLibrary> Symbols;
 
+        /// <summary>
+        /// Resolver used instead of the symbol index when set.
+        /// </summary>
+        public ISymbolResolver Resolver { get; set; }
+
         public SymbolContext()
         {
             Libraries = new List<NativeLibrary>();
@@ -94,6 +119,16 @@ public void IndexSymbols()
 
         public bool FindSymbol(ref string symbol)
         {
+            if (Resolver != null)
+            {
+                var symbols = new[] { symbol };
+                if (Resolver.ResolveSymbols(symbols)[0] == null)
+                    return false;
+
+                symbol = symbols[0];
+                return true;
+            }
+
             NativeLibrary lib;
 
             if (FindLibraryBySymbol(symbol, out lib))
@@ -133,8 +168,41 @@ public bool FindSymbol(ref string symbol)
             return false;
         }
 
+        /// <summary>
+        /// Resolves the symbols like FindSymbol, all of them in a single call
+        /// to the resolver if there is one. Returns whether each symbol was
+        /// found.
+        /// </summary>
+        public bool[] FindSymbols(IList<string> symbols)
+        {
+            var found = new bool[symbols.Count];
+
+            if (Resolver != null)
+            {
+                var libraries = Resolver.ResolveSymbols(symbols);
+                for (var i = 0; i < found.Length; i++)
+                    found[i] = libraries[i] != null;
+                return found;
+            }
+
+            for (var i = 0; i < found.Length; i++)
+            {
+                var symbol = symbols[i];
+                found[i] = FindSymbol(ref symbol);
+                symbols[i] = symbol;
+            }
+
+            return found;
+        }
+
         public bool FindLibraryBySymbol(string symbol, out NativeLibrary library)
         {
+            if (Resolver != null)
+            {
+                library = Resolver.FindLibraryBySymbol(symbol);
+                return library != null;
+            }
+
             return Symbols.TryGetValue(symbol, out library);
         }
     }
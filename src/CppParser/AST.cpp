@@ -6,9 +6,12 @@
 ************************************************************************/
 
 #include "AST.h"
+#include "MappedSymbolTable.h"
+#include <mutex>
 #include <string>
 #include <vector>
 #include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/Support/Path.h>
 
 // copy from widenPath ('llvm/lib/Support/Windows/Path.inc')
@@ -559,7 +562,10 @@ DEF_STRING(Statement, String)
 Statement::Statement(const std::string& str, StatementClass stmtClass, Declaration* decl) : String(str), Class(stmtClass), Decl(decl) {}
 
 Expression::Expression(const std::string& str, StatementClass stmtClass, Declaration* decl)
-    : Statement(str, stmtClass, decl) {}
+    : Statement(str, stmtClass, decl), ValueKind(ExpressionValueKind::None),
+      IntegerValue(0), FloatValue(0) {}
+
+DEF_STRING(Expression, StringValue)
 
 BinaryOperator::BinaryOperator(const std::string& str, Expression* lhs, Expression* rhs, const std::string& opcodeStr)
     : Expression(str, StatementClass::BinaryOperator), LHS(lhs), RHS(rhs), OpcodeStr(opcodeStr) {}
@@ -633,6 +639,24 @@ Function::~Function() {}
 DEF_STRING(Function, Mangled)
 DEF_STRING(Function, Signature)
 DEF_VECTOR(Function, Parameter*, Parameters)
+DEF_VECTOR(Function, FunctionTargetLayout, TargetLayouts)
+
+FunctionTargetLayout::FunctionTargetLayout()
+    : IsReturnIndirect(false)
+    , HasThisReturn(false)
+{
+}
+
+FunctionTargetLayout::FunctionTargetLayout(const FunctionTargetLayout& rhs)
+    : Mangled(rhs.Mangled)
+    , IsReturnIndirect(rhs.IsReturnIndirect)
+    , HasThisReturn(rhs.HasThisReturn)
+    , IndirectParameters(rhs.IndirectParameters)
+{
+}
+
+DEF_STRING(FunctionTargetLayout, Mangled)
+DEF_VECTOR(FunctionTargetLayout, unsigned, IndirectParameters)
 
 Method::Method() 
     : Function()
@@ -714,12 +738,15 @@ Class::~Class()
 {
     if (Layout)
         delete Layout;
+    for (auto TargetLayout : TargetLayouts)
+        delete TargetLayout;
 }
 
 DEF_VECTOR(Class, BaseClassSpecifier*, Bases)
 DEF_VECTOR(Class, Field*, Fields)
 DEF_VECTOR(Class, Method*, Methods)
 DEF_VECTOR(Class, AccessSpecifierDecl*, Specifiers)
+DEF_VECTOR(Class, ClassLayout*, TargetLayouts)
 
 Template::Template() : Declaration(DeclarationKind::Template),
     TemplatedDecl(0) {}
@@ -757,21 +784,46 @@ ClassTemplatePartialSpecialization::ClassTemplatePartialSpecialization()
 
 ClassTemplatePartialSpecialization::~ClassTemplatePartialSpecialization() {}
 
+static const std::string& GetSpecializationUSR(FunctionTemplateSpecialization* Spec)
+{
+    return Spec->SpecializedFunction->USR;
+}
+
 FunctionTemplate::FunctionTemplate() : Template(DeclarationKind::FunctionTemplate) {}
 
 FunctionTemplate::~FunctionTemplate() {}
 
-DEF_VECTOR(FunctionTemplate, FunctionTemplateSpecialization*, Specializations)
+FunctionTemplateSpecialization* FunctionTemplate::getSpecializations(unsigned i)
+{
+    return Specializations[i];
+}
 
-FunctionTemplateSpecialization* FunctionTemplate::FindSpecialization(const std::string& usr)
+void FunctionTemplate::addSpecializations(FunctionTemplateSpecialization*& s)
 {
-    auto foundSpec = std::find_if(Specializations.begin(), Specializations.end(),
-        [&](FunctionTemplateSpecialization* cts) { return cts->SpecializedFunction->USR == usr; });
+    Specializations.push_back(s);
+    SpecializationIndex.add(Specializations, Specializations.size() - 1,
+        GetSpecializationUSR);
+}
 
-    if (foundSpec != Specializations.end())
-        return static_cast<FunctionTemplateSpecialization*>(*foundSpec);
+unsigned FunctionTemplate::getSpecializationsCount()
+{
+    return Specializations.size();
+}
 
-    return nullptr;
+void FunctionTemplate::clearSpecializations()
+{
+    Specializations.clear();
+    SpecializationIndex.invalidate();
+}
+
+FunctionTemplateSpecialization** FunctionTemplate::getSpecializationsData()
+{
+    return Specializations.data();
+}
+
+FunctionTemplateSpecialization* FunctionTemplate::FindSpecialization(const std::string& usr)
+{
+    return SpecializationIndex.find(Specializations, usr, GetSpecializationUSR);
 }
 
 FunctionTemplateSpecialization::FunctionTemplateSpecialization()
@@ -865,21 +917,261 @@ TranslationUnit::~TranslationUnit() {}
 
 DEF_STRING(TranslationUnit, FileName)
 DEF_VECTOR(TranslationUnit, MacroDefinition*, Macros)
+DEF_STRING(TranslationUnit, ContentHash)
+DEF_VECTOR_STRING(TranslationUnit, Includes)
 
 NativeLibrary::NativeLibrary()
     : ArchType(AST::ArchType::UnknownArch)
+    , MappedSymbols(0)
+{
+}
+
+NativeLibrary::NativeLibrary(const NativeLibrary& rhs)
+    : FileName(rhs.FileName)
+    , ArchType(rhs.ArchType)
+    , Symbols(rhs.Symbols)
+    , Dependencies(rhs.Dependencies)
+    , MappedSymbols(rhs.MappedSymbols)
+    , SymbolIndex(rhs.SymbolIndex)
+{
+    if (MappedSymbols)
+        MappedSymbols->References++;
+}
+
+static void ReleaseMappedSymbols(MappedSymbolTable* MappedSymbols)
 {
+    if (MappedSymbols && --MappedSymbols->References == 0)
+        delete MappedSymbols;
 }
 
 NativeLibrary::~NativeLibrary()
 {
+    ReleaseMappedSymbols(MappedSymbols);
+}
+
+NativeLibrary& NativeLibrary::operator=(const NativeLibrary& rhs)
+{
+    if (rhs.MappedSymbols)
+        rhs.MappedSymbols->References++;
+    ReleaseMappedSymbols(MappedSymbols);
+
+    FileName = rhs.FileName;
+    ArchType = rhs.ArchType;
+    Symbols = rhs.Symbols;
+    Dependencies = rhs.Dependencies;
+    MappedSymbols = rhs.MappedSymbols;
+    SymbolIndex = rhs.SymbolIndex;
+    return *this;
 }
 
 // NativeLibrary
 DEF_STRING(NativeLibrary, FileName)
-DEF_VECTOR_STRING(NativeLibrary, Symbols)
 DEF_VECTOR_STRING(NativeLibrary, Dependencies)
 
+const char* NativeLibrary::getSymbols(unsigned i)
+{
+    if (i < Symbols.size())
+        return Symbols[i].c_str();
+
+    // Mapped symbols are only kept if they are null-terminated in place.
+    auto& Range = MappedSymbols->Symbols[i - Symbols.size()];
+    return MappedSymbols->Data + Range.Offset;
+}
+
+void NativeLibrary::addSymbols(const char* s)
+{
+    Symbols.push_back(s);
+    SymbolIndex.clear();
+}
+
+unsigned NativeLibrary::getSymbolsCount()
+{
+    return Symbols.size() + (MappedSymbols ? MappedSymbols->Symbols.size() : 0);
+}
+
+void NativeLibrary::clearSymbols()
+{
+    Symbols.clear();
+    if (MappedSymbols)
+    {
+        MappedSymbols->Symbols.clear();
+        MappedSymbols->ExportedSymbolLookup = nullptr;
+    }
+    SymbolIndex.clear();
+}
+
+bool NativeLibrary::GetSymbol(unsigned i, const char*& Data, unsigned& Length)
+{
+    if (i < Symbols.size())
+    {
+        Data = Symbols[i].data();
+        Length = Symbols[i].size();
+        return true;
+    }
+
+    i -= Symbols.size();
+    if (!MappedSymbols || i >= MappedSymbols->Symbols.size())
+        return false;
+
+    auto& Range = MappedSymbols->Symbols[i];
+    Data = MappedSymbols->Data + Range.Offset;
+    Length = Range.Length;
+    return true;
+}
+
+// The symbol index is an open addressing hash table of symbol indices + 1,
+// so looking up a symbol never needs to materialize a string.
+void NativeLibrary::BuildSymbolIndex()
+{
+    unsigned Count = getSymbolsCount();
+    unsigned Size = 16;
+    while (Size < Count * 2)
+        Size <<= 1;
+
+    SymbolIndex.assign(Size, 0);
+
+    for (unsigned I = 0; I != Count; ++I)
+    {
+        const char* Data;
+        unsigned Length;
+        GetSymbol(I, Data, Length);
+
+        auto Slot = llvm::HashString(llvm::StringRef(Data, Length)) & (Size - 1);
+        while (SymbolIndex[Slot] != 0)
+            Slot = (Slot + 1) & (Size - 1);
+        SymbolIndex[Slot] = I + 1;
+    }
+}
+
+bool NativeLibrary::HasSymbol(const char* Symbol)
+{
+    return HasSymbol(Symbol, strlen(Symbol));
+}
+
+bool NativeLibrary::HasSymbol(const char* Symbol, unsigned Length)
+{
+    // Libraries with a symbol hash table answer for the symbols they define
+    // through it. Symbols lists the undefined ones too, which are only found
+    // through the index, so it is built on the first miss.
+    if (MappedSymbols && MappedSymbols->ExportedSymbolLookup &&
+        MappedSymbols->ExportedSymbolLookup(Symbol, Length, nullptr))
+        return true;
+
+    if (SymbolIndex.empty())
+        BuildSymbolIndex();
+
+    llvm::StringRef Name(Symbol, Length);
+    unsigned Mask = SymbolIndex.size() - 1;
+    for (auto Slot = llvm::HashString(Name) & Mask; SymbolIndex[Slot] != 0;
+        Slot = (Slot + 1) & Mask)
+    {
+        const char* Data;
+        unsigned DataLength;
+        GetSymbol(SymbolIndex[Slot] - 1, Data, DataLength);
+        if (Name == llvm::StringRef(Data, DataLength))
+            return true;
+    }
+
+    return false;
+}
+
+const char* NativeLibrary::GetSymbolVersion(const char* Symbol)
+{
+    const char* Version = nullptr;
+    if (MappedSymbols && MappedSymbols->ExportedSymbolLookup)
+        MappedSymbols->ExportedSymbolLookup(Symbol, strlen(Symbol), &Version);
+    return Version;
+}
+
+SymbolContext::SymbolContext() {}
+
+SymbolContext::~SymbolContext() {}
+
+DEF_VECTOR(SymbolContext, NativeLibrary*, Libraries)
+
+int SymbolContext::FindLibraryBySymbol(const char* Symbol)
+{
+    return FindLibraryBySymbol(Symbol, strlen(Symbol));
+}
+
+int SymbolContext::FindLibraryBySymbol(const char* Symbol, unsigned Length)
+{
+    for (unsigned I = 0, E = Libraries.size(); I != E; ++I)
+    {
+        auto Library = Libraries[I];
+        if (Library->HasSymbol(Symbol, Length))
+            return I;
+
+        // Symbols starting with a double underscore are also known by their
+        // name without the first underscore.
+        if (Length > 0 && Symbol[0] == '_')
+        {
+            llvm::SmallString<256> Prefixed("_");
+            Prefixed.append(Symbol, Symbol + Length);
+            if (Library->HasSymbol(Prefixed.data(), Prefixed.size()))
+                return I;
+        }
+    }
+
+    return -1;
+}
+
+unsigned SymbolContext::ResolveSymbols(const char** Symbols, unsigned Count,
+    int* LibraryIndices, SymbolVariant* Variants)
+{
+    unsigned Resolved = 0;
+    llvm::SmallString<256> Alternative;
+
+    auto FindVariant = [&](llvm::StringRef Prefix, llvm::StringRef Symbol) {
+        Alternative = Prefix;
+        Alternative += Symbol;
+        return FindLibraryBySymbol(Alternative.data(), Alternative.size());
+    };
+
+    for (unsigned I = 0; I != Count; ++I)
+    {
+        llvm::StringRef Symbol(Symbols[I]);
+
+        auto Variant = SymbolVariant::Exact;
+        int Index = FindLibraryBySymbol(Symbol.data(), Symbol.size());
+
+        // Check for C symbols with a leading underscore.
+        if (Index < 0)
+        {
+            Variant = SymbolVariant::LeadingUnderscore;
+            Index = FindVariant("_", Symbol);
+        }
+
+        if (Index < 0)
+        {
+            Variant = SymbolVariant::TrimmedUnderscores;
+            Index = FindVariant("", Symbol.ltrim("_"));
+        }
+
+        if (Index < 0)
+        {
+            Variant = SymbolVariant::ImpPrefix;
+            Index = FindVariant("_imp_", Symbol);
+        }
+
+        if (Index < 0)
+        {
+            Variant = SymbolVariant::DoubleImpPrefix;
+            Index = FindVariant("__imp_", Symbol);
+        }
+
+        if (Index < 0)
+            Variant = SymbolVariant::NotFound;
+        else
+            Resolved++;
+
+        LibraryIndices[I] = Index;
+        Variants[I] = Variant;
+    }
+
+    return Resolved;
+}
+
 // ASTContext
 DEF_VECTOR(ASTContext, TranslationUnit*, TranslationUnits)
 
@@ -902,11 +1194,34 @@ ClassTemplatePartialSpecialization* ClassTemplate::FindPartialSpecialization(con
     return nullptr;
 }
 
-ASTContext::ASTContext() {}
+struct ASTContextMutex
+{
+    std::mutex Mutex;
+};
 
-ASTContext::~ASTContext() {}
+ASTContext::ASTContext() : Mutex(new ASTContextMutex()) {}
 
-TranslationUnit* ASTContext::FindOrCreateModule(std::string File)
+ASTContext::ASTContext(const ASTContext& rhs)
+    : TranslationUnits(rhs.TranslationUnits), Mutex(new ASTContextMutex()) {}
+
+ASTContext::~ASTContext()
+{
+    for (auto Unit : StaleUnits)
+        delete Unit;
+    delete Mutex;
+}
+
+void ASTContext::lock()
+{
+    Mutex->Mutex.lock();
+}
+
+void ASTContext::unlock()
+{
+    Mutex->Mutex.unlock();
+}
+
+TranslationUnit* ASTContext::FindModule(std::string File)
 {
     auto normalizedFile = normalizePath(File);
 
@@ -915,11 +1230,16 @@ TranslationUnit* ASTContext::FindOrCreateModule(std::string File)
             return unit && unit->FileName == normalizedFile;
     });
 
-    if (existingUnit != TranslationUnits.end())
-        return *existingUnit;
+    return existingUnit != TranslationUnits.end() ? *existingUnit : nullptr;
+}
+
+TranslationUnit* ASTContext::FindOrCreateModule(std::string File)
+{
+    if (auto existingUnit = FindModule(File))
+        return existingUnit;
 
     auto unit = new TranslationUnit();
-    unit->FileName = normalizedFile;
+    unit->FileName = normalizePath(File);
     TranslationUnits.push_back(unit);
 
     return unit;
@@ -574,10 +574,30 @@ public:
     STRING(String)
 };
 
+enum class ExpressionValueKind
+{
+    None,
+    SignedInteger,
+    UnsignedInteger,
+    Boolean,
+    Character,
+    Float,
+    String,
+    NullPtr
+};
+
 class CS_API Expression : public Statement
 {
 public:
     Expression(const std::string& str, StatementClass Class = StatementClass::Any, Declaration* decl = 0);
+
+    // The value the expression folds to, if it is a constant expression.
+    // Integers, booleans and characters are in IntegerValue, signed values
+    // being sign extended.
+    ExpressionValueKind ValueKind;
+    uint64_t IntegerValue;
+    double FloatValue;
+    STRING(StringValue)
 };
 
 class CS_API BinaryOperator : public Expression
@@ -680,6 +700,19 @@ enum class CXXOperatorKind
 
 class FunctionTemplateSpecialization;
 
+// ABI details of a function for one of the additional targets of a parse.
+struct CS_API FunctionTargetLayout
+{
+    FunctionTargetLayout();
+    FunctionTargetLayout(const FunctionTargetLayout&);
+
+    STRING(Mangled)
+    bool IsReturnIndirect;
+    bool HasThisReturn;
+    // Indices of the parameters which are passed indirectly.
+    VECTOR(unsigned, IndirectParameters)
+};
+
 class CS_API Function : public Declaration
 {
 public:
@@ -701,6 +734,9 @@ public:
     VECTOR(Parameter*, Parameters)
     FunctionTemplateSpecialization* SpecializationInfo;
     Function* InstantiatedFrom;
+    // Per target of CppParserOptions::Targets, with an empty mangled name
+    // if the function was not found for the target.
+    VECTOR(FunctionTargetLayout, TargetLayouts)
 };
 
 class AccessSpecifierDecl;
@@ -820,6 +856,9 @@ public:
     bool IsExternCContext;
 
     ClassLayout* Layout;
+    // Per target of CppParserOptions::Targets, null if the class was not
+    // found for the target.
+    VECTOR(ClassLayout*, TargetLayouts)
 };
 
 class CS_API Template : public Declaration
@@ -940,6 +979,11 @@ public:
     ~FunctionTemplate();
     VECTOR(FunctionTemplateSpecialization*, Specializations)
     FunctionTemplateSpecialization* FindSpecialization(const std::string& usr);
+
+private:
+    // Specializations by the USR of their function, kept up to date by the
+    // accessors of the specializations.
+    HashIndex<FunctionTemplateSpecialization, std::string> SpecializationIndex;
 };
 
 class CS_API FunctionTemplateSpecialization
@@ -1039,6 +1083,10 @@ public:
     STRING(FileName)
     bool IsSystemHeader;
     VECTOR(MacroDefinition*, Macros)
+    // MD5 hash of the file contents when it was last parsed.
+    STRING(ContentHash)
+    // Normalized file names of the headers directly included by this unit.
+    VECTOR_STRING(Includes)
 };
 
 enum class ArchType
@@ -1048,24 +1096,94 @@ enum class ArchType
     x86_64
 };
 
+struct MappedSymbolTable;
+
 class CS_API NativeLibrary
 {
 public:
     NativeLibrary();
+    NativeLibrary(const NativeLibrary&);
     ~NativeLibrary();
     STRING(FileName)
     ArchType ArchType;
-    VECTOR_STRING(Symbols)
+
+    // The symbols read as owned strings, followed by the ones read with
+    // CppParserOptions::MappedSymbols, which point into the mapped library.
+    std::vector<std::string> Symbols;
+    const char* getSymbols(unsigned i);
+    void addSymbols(const char* s);
+    unsigned getSymbolsCount();
+    void clearSymbols();
+
     VECTOR_STRING(Dependencies)
+
+    // Whether the symbol is in Symbols, which also lists the undefined
+    // dynamic symbols of ELF libraries. The defined ones of mapped ELF
+    // libraries are looked up in their own hash table first.
+    bool HasSymbol(const char* Symbol);
+    // Version of an exported symbol (ELF only), or null if it has none.
+    const char* GetSymbolVersion(const char* Symbol);
+
+    CS_IGNORE NativeLibrary& operator=(const NativeLibrary&);
+    CS_IGNORE bool HasSymbol(const char* Symbol, unsigned Length);
+    CS_IGNORE void BuildSymbolIndex();
+    CS_IGNORE MappedSymbolTable* MappedSymbols;
+
+private:
+    bool GetSymbol(unsigned i, const char*& Data, unsigned& Length);
+    std::vector<unsigned> SymbolIndex;
+};
+
+enum class SymbolVariant
+{
+    Exact,
+    LeadingUnderscore,
+    TrimmedUnderscores,
+    ImpPrefix,
+    DoubleImpPrefix,
+    NotFound
+};
+
+class CS_API SymbolContext
+{
+public:
+    SymbolContext();
+    ~SymbolContext();
+    VECTOR(NativeLibrary*, Libraries)
+
+    // Returns the index of the first library with the symbol, or -1.
+    int FindLibraryBySymbol(const char* Symbol);
+
+    // Resolves each symbol against its mangling variants in a single call,
+    // filling the index of the defining library (-1 if none) and the
+    // variant that matched. Returns the number of resolved symbols.
+    unsigned ResolveSymbols(const char** Symbols, unsigned Count,
+        int* LibraryIndices, SymbolVariant* Variants);
+
+    CS_IGNORE int FindLibraryBySymbol(const char* Symbol, unsigned Length);
 };
 
+struct ASTContextMutex;
+
 class CS_API ASTContext
 {
 public:
     ASTContext();
+    ASTContext(const ASTContext&);
     ~ASTContext();
     TranslationUnit* FindOrCreateModule(std::string File);
+    TranslationUnit* FindModule(std::string File);
     VECTOR(TranslationUnit*, TranslationUnits)
+
+    // Units dropped by incremental parses. Declarations of the other units
+    // may still point to them, so they are only freed with the context.
+    CS_IGNORE std::vector<TranslationUnit*> StaleUnits;
+
+    // Held by the parsers while they add declarations, so concurrent parses
+    // can share the context.
+    CS_IGNORE void lock();
+    CS_IGNORE void unlock();
+    CS_IGNORE ASTContextMutex* Mutex;
 };
 
 #pragma endregion
@@ -0,0 +1,841 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#include "ASTSerializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+using namespace CppSharp::CppParser::AST;
+
+typedef std::vector<std::pair<Declaration*, ASTBufferChildGroup>> ChildList;
+
+template<typename T>
+static void AddChildren(ChildList& Children, const std::vector<T*>& Decls,
+    ASTBufferChildGroup Group)
+{
+    for (auto D : Decls)
+        Children.emplace_back(D, Group);
+}
+
+static void GetChildren(DeclarationContext* Context, ChildList& Children)
+{
+    AddChildren(Children, Context->Namespaces, ASTBufferChildGroup::Namespaces);
+    AddChildren(Children, Context->Enums, ASTBufferChildGroup::Enums);
+    AddChildren(Children, Context->Functions, ASTBufferChildGroup::Functions);
+    AddChildren(Children, Context->Templates, ASTBufferChildGroup::Templates);
+    AddChildren(Children, Context->Classes, ASTBufferChildGroup::Classes);
+    AddChildren(Children, Context->Typedefs, ASTBufferChildGroup::Typedefs);
+    AddChildren(Children, Context->TypeAliases, ASTBufferChildGroup::TypeAliases);
+    AddChildren(Children, Context->Variables, ASTBufferChildGroup::Variables);
+    AddChildren(Children, Context->Friends, ASTBufferChildGroup::Friends);
+}
+
+static void GetChildren(Template* Template, ChildList& Children)
+{
+    AddChildren(Children, Template->Parameters, ASTBufferChildGroup::TemplateParameters);
+    if (Template->TemplatedDecl)
+        Children.emplace_back(Template->TemplatedDecl, ASTBufferChildGroup::TemplatedDecl);
+}
+
+/// Returns the declarations owned by a declaration, in the order the
+/// converter visits them.
+static ChildList GetChildren(Declaration* D)
+{
+    ChildList Children;
+
+    switch (D->Kind)
+    {
+    case DeclarationKind::TranslationUnit:
+    case DeclarationKind::Namespace:
+        GetChildren(static_cast<DeclarationContext*>(D), Children);
+        break;
+    case DeclarationKind::Class:
+    case DeclarationKind::ClassTemplateSpecialization:
+    case DeclarationKind::ClassTemplatePartialSpecialization:
+    {
+        auto C = static_cast<Class*>(D);
+        GetChildren(C, Children);
+        AddChildren(Children, C->Fields, ASTBufferChildGroup::Fields);
+        AddChildren(Children, C->Methods, ASTBufferChildGroup::Methods);
+        AddChildren(Children, C->Specifiers, ASTBufferChildGroup::Specifiers);
+        break;
+    }
+    case DeclarationKind::Enumeration:
+    {
+        auto E = static_cast<Enumeration*>(D);
+        AddChildren(Children, E->Items, ASTBufferChildGroup::Items);
+        break;
+    }
+    case DeclarationKind::Function:
+    case DeclarationKind::Method:
+    {
+        auto F = static_cast<Function*>(D);
+        AddChildren(Children, F->Parameters, ASTBufferChildGroup::Parameters);
+        break;
+    }
+    case DeclarationKind::ClassTemplate:
+    {
+        auto CT = static_cast<ClassTemplate*>(D);
+        GetChildren(CT, Children);
+        AddChildren(Children, CT->Specializations, ASTBufferChildGroup::Specializations);
+        break;
+    }
+    case DeclarationKind::VarTemplate:
+    {
+        auto VT = static_cast<VarTemplate*>(D);
+        GetChildren(VT, Children);
+        AddChildren(Children, VT->Specializations, ASTBufferChildGroup::Specializations);
+        break;
+    }
+    case DeclarationKind::TypeAliasTemplate:
+    case DeclarationKind::FunctionTemplate:
+    case DeclarationKind::TemplateTemplateParm:
+        GetChildren(static_cast<Template*>(D), Children);
+        break;
+    default:
+        break;
+    }
+
+    return Children;
+}
+
+/// Returns the type of parameters, fields, variables and typedefs, or the
+/// return type of functions.
+static const QualifiedType* GetType(Declaration* D)
+{
+    switch (D->Kind)
+    {
+    case DeclarationKind::Typedef:
+    case DeclarationKind::TypeAlias:
+        return &static_cast<TypedefNameDecl*>(D)->QualifiedType;
+    case DeclarationKind::Parameter:
+        return &static_cast<Parameter*>(D)->QualifiedType;
+    case DeclarationKind::Function:
+    case DeclarationKind::Method:
+        return &static_cast<Function*>(D)->ReturnType;
+    case DeclarationKind::Variable:
+    case DeclarationKind::VarTemplateSpecialization:
+    case DeclarationKind::VarTemplatePartialSpecialization:
+        return &static_cast<Variable*>(D)->QualifiedType;
+    case DeclarationKind::Field:
+        return &static_cast<Field*>(D)->QualifiedType;
+    default:
+        return nullptr;
+    }
+}
+
+static bool IsClass(DeclarationKind Kind)
+{
+    switch (Kind)
+    {
+    case DeclarationKind::Class:
+    case DeclarationKind::ClassTemplateSpecialization:
+    case DeclarationKind::ClassTemplatePartialSpecialization:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool IsDeclarationContext(DeclarationKind Kind)
+{
+    switch (Kind)
+    {
+    case DeclarationKind::TranslationUnit:
+    case DeclarationKind::Namespace:
+    case DeclarationKind::Class:
+    case DeclarationKind::ClassTemplateSpecialization:
+    case DeclarationKind::ClassTemplatePartialSpecialization:
+    case DeclarationKind::Enumeration:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ASTSerializer::Collect(Declaration* D)
+{
+    if (!D || !Indices.emplace(D, -1).second)
+        return;
+
+    Declarations.push_back(D);
+
+    for (auto& Child : GetChildren(D))
+        Collect(Child.first);
+}
+
+int32_t ASTSerializer::GetIndex(Declaration* D)
+{
+    auto It = Indices.find(D);
+    return It != Indices.end() ? It->second : -1;
+}
+
+uint32_t ASTSerializer::AddString(const std::string& String)
+{
+    if (String.empty())
+        return 0;
+
+    auto It = StringOffsets.find(String);
+    if (It != StringOffsets.end())
+        return It->second;
+
+    uint32_t Offset = Strings.size();
+    uint32_t Length = String.size();
+    Strings.insert(Strings.end(), (const char*)&Length,
+        (const char*)&Length + sizeof(Length));
+    Strings.insert(Strings.end(), String.begin(), String.end());
+
+    // Null terminate and keep the entries 4-byte aligned.
+    do
+        Strings.push_back('\0');
+    while (Strings.size() % sizeof(uint32_t));
+
+    StringOffsets.emplace(String, Offset);
+    return Offset;
+}
+
+bool ASTSerializer::SetDeclaration(ASTBufferType& Record, Declaration* D)
+{
+    Record.Declaration = GetIndex(D);
+    return !D || Record.Declaration != -1;
+}
+
+int32_t ASTSerializer::AddType(Type* T)
+{
+    if (!T)
+        return -1;
+
+    auto It = TypeIndices.find(T);
+    if (It != TypeIndices.end())
+        return It->second;
+
+    // The record is filled in before it is stored, as adding the types it
+    // refers to reallocates the table.
+    int32_t Index = Types.size();
+    TypeIndices.emplace(T, Index);
+    Types.emplace_back();
+
+    ASTBufferType Record = {};
+    Record.NativePtr = (uint64_t)(uintptr_t)T;
+    Record.Kind = (uint32_t)T->Kind;
+    Record.Declaration = -1;
+    for (auto& QualType : Record.Types)
+        QualType.Type = -1;
+    if (T->IsDependent)
+        Record.Flags |= IsDependentTypeFlag;
+
+    bool IsSerialized = true;
+    switch (T->Kind)
+    {
+    case TypeKind::Tag:
+        IsSerialized = SetDeclaration(Record, static_cast<TagType*>(T)->Declaration);
+        break;
+    case TypeKind::Array:
+    {
+        auto AT = static_cast<ArrayType*>(T);
+        Record.Value = (uint32_t)AT->SizeType;
+        Record.Size = AT->Size;
+        Record.ElementSize = AT->ElementSize;
+        Record.Types[0] = AddType(AT->QualifiedType);
+        break;
+    }
+    case TypeKind::Pointer:
+    {
+        auto PT = static_cast<PointerType*>(T);
+        Record.Value = (uint32_t)PT->Modifier;
+        Record.Types[0] = AddType(PT->QualifiedPointee);
+        break;
+    }
+    case TypeKind::MemberPointer:
+        Record.Types[0] = AddType(static_cast<MemberPointerType*>(T)->Pointee);
+        break;
+    case TypeKind::Typedef:
+        IsSerialized = SetDeclaration(Record, static_cast<TypedefType*>(T)->Declaration);
+        break;
+    case TypeKind::Attributed:
+    {
+        auto AT = static_cast<AttributedType*>(T);
+        Record.Types[0] = AddType(AT->Modified);
+        Record.Types[1] = AddType(AT->Equivalent);
+        break;
+    }
+    case TypeKind::Decayed:
+    {
+        auto DT = static_cast<DecayedType*>(T);
+        Record.Types[0] = AddType(DT->Decayed);
+        Record.Types[1] = AddType(DT->Original);
+        Record.Types[2] = AddType(DT->Pointee);
+        break;
+    }
+    case TypeKind::TemplateParameter:
+    {
+        auto TPT = static_cast<TemplateParameterType*>(T);
+        IsSerialized = SetDeclaration(Record, TPT->Parameter);
+        Record.Value = TPT->Depth;
+        Record.Index = TPT->Index;
+        if (TPT->IsParameterPack)
+            Record.Flags |= IsParameterPackFlag;
+        break;
+    }
+    case TypeKind::TemplateParameterSubstitution:
+        Record.Types[0] = AddType(
+            static_cast<TemplateParameterSubstitutionType*>(T)->Replacement);
+        break;
+    case TypeKind::InjectedClassName:
+    {
+        auto ICNT = static_cast<InjectedClassNameType*>(T);
+        IsSerialized = SetDeclaration(Record, ICNT->Class);
+        Record.Types[0] = AddType(ICNT->InjectedSpecializationType);
+        break;
+    }
+    case TypeKind::DependentName:
+        Record.Types[0] = AddType(static_cast<DependentNameType*>(T)->Desugared);
+        break;
+    case TypeKind::UnaryTransform:
+    {
+        auto UTT = static_cast<UnaryTransformType*>(T);
+        Record.Types[0] = AddType(UTT->Desugared);
+        Record.Types[1] = AddType(UTT->BaseType);
+        break;
+    }
+    case TypeKind::Builtin:
+        Record.Value = (uint32_t)static_cast<BuiltinType*>(T)->Type;
+        break;
+    case TypeKind::PackExpansion:
+        break;
+    default:
+        // Function types and template specializations refer to parameters
+        // and template arguments, which are not serialized.
+        IsSerialized = false;
+        break;
+    }
+
+    if (IsSerialized)
+        Record.Flags |= IsSerializedTypeFlag;
+
+    Types[Index] = Record;
+    return Index;
+}
+
+ASTBufferQualifiedType ASTSerializer::AddType(const QualifiedType& QualType)
+{
+    ASTBufferQualifiedType Record;
+    Record.Type = AddType(QualType.Type);
+    Record.Qualifiers = 0;
+    if (QualType.Qualifiers.IsConst)
+        Record.Qualifiers |= IsConstQualifier;
+    if (QualType.Qualifiers.IsVolatile)
+        Record.Qualifiers |= IsVolatileQualifier;
+    if (QualType.Qualifiers.IsRestrict)
+        Record.Qualifiers |= IsRestrictQualifier;
+    return Record;
+}
+
+template<typename T>
+static uint32_t Append(std::vector<char>& Buffer, const T* Data, size_t Count)
+{
+    Buffer.resize((Buffer.size() + alignof(T) - 1) & ~(alignof(T) - 1));
+    uint32_t Offset = Buffer.size();
+    Buffer.insert(Buffer.end(), (const char*)Data, (const char*)(Data + Count));
+    return Offset;
+}
+
+std::vector<char> ASTSerializer::Serialize(ASTContext* Context)
+{
+    for (auto Unit : Context->TranslationUnits)
+        Collect(Unit);
+
+    std::sort(Declarations.begin(), Declarations.end());
+    for (uint32_t I = 0, E = Declarations.size(); I != E; ++I)
+        Indices[Declarations[I]] = I;
+
+    // Offset 0 is the empty string.
+    Strings.assign(2 * sizeof(uint32_t), '\0');
+
+    std::vector<ASTBufferDeclaration> Records(Declarations.size());
+    std::vector<ASTBufferChild> Children;
+    std::vector<ASTBufferBase> Bases;
+
+    for (uint32_t I = 0, E = Declarations.size(); I != E; ++I)
+    {
+        auto D = Declarations[I];
+        auto& Record = Records[I];
+
+        Record.NativePtr = (uint64_t)(uintptr_t)D;
+        Record.OriginalPtr = (uint64_t)(uintptr_t)D->OriginalPtr;
+        Record.Kind = (uint32_t)D->Kind;
+        Record.Access = (uint32_t)D->Access;
+        Record.Namespace = GetIndex(D->_Namespace);
+        Record.CompleteDeclaration = GetIndex(D->CompleteDeclaration);
+        Record.Location = D->Location.ID;
+        Record.LineNumberStart = D->LineNumberStart;
+        Record.LineNumberEnd = D->LineNumberEnd;
+        Record.DefinitionOrder = D->DefinitionOrder;
+        Record.Name = AddString(D->Name);
+        Record.USR = AddString(D->USR);
+        Record.DebugText = AddString(D->DebugText);
+
+        Record.Flags = 0;
+        if (D->IsIncomplete)
+            Record.Flags |= IsIncompleteFlag;
+        if (D->IsDependent)
+            Record.Flags |= IsDependentFlag;
+        if (D->IsImplicit)
+            Record.Flags |= IsImplicitFlag;
+        if (IsDeclarationContext(D->Kind) &&
+            static_cast<DeclarationContext*>(D)->IsAnonymous)
+            Record.Flags |= IsAnonymousFlag;
+
+        Record.ChildrenBegin = Children.size();
+        for (auto& Child : GetChildren(D))
+            Children.push_back({ GetIndex(Child.first), Child.second });
+        Record.ChildrenCount = Children.size() - Record.ChildrenBegin;
+
+        auto DeclType = GetType(D);
+        Record.Type = DeclType ? AddType(*DeclType) : ASTBufferQualifiedType{ -1, 0 };
+
+        Record.BasesBegin = Bases.size();
+        if (IsClass(D->Kind))
+        {
+            for (auto Base : static_cast<Class*>(D)->Bases)
+            {
+                ASTBufferBase BaseRecord;
+                BaseRecord.Access = (uint32_t)Base->Access;
+                BaseRecord.IsVirtual = Base->IsVirtual;
+                BaseRecord.Type = AddType(Base->Type);
+                BaseRecord.Offset = Base->Offset;
+                Bases.push_back(BaseRecord);
+            }
+        }
+        Record.BasesCount = Bases.size() - Record.BasesBegin;
+
+        Record.Index = 0;
+        Record.Reserved = 0;
+        if (D->Kind == DeclarationKind::Parameter)
+        {
+            auto P = static_cast<Parameter*>(D);
+            Record.Index = P->Index;
+            if (P->IsIndirect)
+                Record.Flags |= IsIndirectFlag;
+            if (P->HasDefaultValue)
+                Record.Flags |= HasDefaultValueFlag;
+        }
+    }
+
+    std::vector<char> Buffer(sizeof(ASTBufferHeader));
+
+    ASTBufferHeader Header;
+    Header.Magic = ASTBufferMagic;
+    Header.Version = ASTBufferVersion;
+    Header.StringsOffset = Append(Buffer, Strings.data(), Strings.size());
+    Header.StringsSize = Strings.size();
+    Header.DeclarationsOffset = Append(Buffer, Records.data(), Records.size());
+    Header.DeclarationsCount = Records.size();
+    Header.ChildrenOffset = Append(Buffer, Children.data(), Children.size());
+    Header.ChildrenCount = Children.size();
+    Header.TypesOffset = Append(Buffer, Types.data(), Types.size());
+    Header.TypesCount = Types.size();
+    Header.BasesOffset = Append(Buffer, Bases.data(), Bases.size());
+    Header.BasesCount = Bases.size();
+    memcpy(Buffer.data(), &Header, sizeof(Header));
+
+    return Buffer;
+}
+
+/// The nodes of a context, which are only ever freed here. Most of the
+/// nodes of the AST are not owned by anyone (and their destructors are not
+/// virtual), so they are collected once and then freed by their kind.
+/// Class layouts are freed by their class, and the few nodes which are only
+/// reachable from them are not collected.
+struct ASTNodes
+{
+    void Add(Declaration* D);
+    void Add(Type* T);
+    void Add(const QualifiedType& QualType) { Add(QualType.Type); }
+    void Add(const std::vector<TemplateArgument>& Arguments);
+    void Add(FunctionTemplateSpecialization* Specialization);
+    void Release();
+
+    std::unordered_set<Declaration*> Declarations;
+    std::unordered_set<Type*> Types;
+    std::unordered_set<PreprocessedEntity*> Entities;
+    std::unordered_set<FunctionTemplateSpecialization*> Specializations;
+    std::vector<BaseClassSpecifier*> Bases;
+    std::vector<RawComment*> Comments;
+};
+
+void ASTNodes::Add(Declaration* D)
+{
+    if (!D || !Declarations.insert(D).second)
+        return;
+
+    if (D->Comment)
+        Comments.push_back(D->Comment);
+    Entities.insert(D->PreprocessedEntities.begin(), D->PreprocessedEntities.end());
+
+    for (auto& Child : GetChildren(D))
+        Add(Child.first);
+
+    if (auto DeclType = GetType(D))
+        Add(*DeclType);
+
+    switch (D->Kind)
+    {
+    case DeclarationKind::TranslationUnit:
+    {
+        auto Unit = static_cast<TranslationUnit*>(D);
+        Entities.insert(Unit->Macros.begin(), Unit->Macros.end());
+        break;
+    }
+    case DeclarationKind::ClassTemplateSpecialization:
+    case DeclarationKind::ClassTemplatePartialSpecialization:
+        Add(static_cast<ClassTemplateSpecialization*>(D)->Arguments);
+        // Fall through.
+    case DeclarationKind::Class:
+        for (auto Base : static_cast<Class*>(D)->Bases)
+        {
+            Bases.push_back(Base);
+            Add(Base->Type);
+        }
+        break;
+    case DeclarationKind::Enumeration:
+    {
+        auto E = static_cast<Enumeration*>(D);
+        Add(E->Type);
+        Add(E->BuiltinType);
+        break;
+    }
+    case DeclarationKind::Function:
+    case DeclarationKind::Method:
+    {
+        auto F = static_cast<Function*>(D);
+        Add(F->SpecializationInfo);
+        Add(F->InstantiatedFrom);
+        break;
+    }
+    case DeclarationKind::FunctionTemplate:
+        for (auto Specialization : static_cast<FunctionTemplate*>(D)->Specializations)
+            Add(Specialization);
+        break;
+    case DeclarationKind::VarTemplateSpecialization:
+    case DeclarationKind::VarTemplatePartialSpecialization:
+        Add(static_cast<VarTemplateSpecialization*>(D)->Arguments);
+        break;
+    case DeclarationKind::TypeAlias:
+        Add(static_cast<TypeAlias*>(D)->DescribedAliasTemplate);
+        break;
+    case DeclarationKind::Friend:
+        Add(static_cast<Friend*>(D)->Declaration);
+        break;
+    case DeclarationKind::TemplateTypeParm:
+        Add(static_cast<TypeTemplateParameter*>(D)->DefaultArgument);
+        break;
+    default:
+        break;
+    }
+}
+
+void ASTNodes::Add(Type* T)
+{
+    if (!T || !Types.insert(T).second)
+        return;
+
+    switch (T->Kind)
+    {
+    case TypeKind::Array:
+        Add(static_cast<ArrayType*>(T)->QualifiedType);
+        break;
+    case TypeKind::Function:
+    {
+        auto FT = static_cast<FunctionType*>(T);
+        Add(FT->ReturnType);
+        for (auto Param : FT->Parameters)
+            Add(Param);
+        break;
+    }
+    case TypeKind::Pointer:
+        Add(static_cast<PointerType*>(T)->QualifiedPointee);
+        break;
+    case TypeKind::MemberPointer:
+        Add(static_cast<MemberPointerType*>(T)->Pointee);
+        break;
+    case TypeKind::Attributed:
+    {
+        auto AT = static_cast<AttributedType*>(T);
+        Add(AT->Modified);
+        Add(AT->Equivalent);
+        break;
+    }
+    case TypeKind::Decayed:
+    {
+        auto DT = static_cast<DecayedType*>(T);
+        Add(DT->Decayed);
+        Add(DT->Original);
+        Add(DT->Pointee);
+        break;
+    }
+    case TypeKind::TemplateSpecialization:
+    {
+        auto TST = static_cast<TemplateSpecializationType*>(T);
+        Add(TST->Arguments);
+        Add(TST->Desugared);
+        break;
+    }
+    case TypeKind::DependentTemplateSpecialization:
+    {
+        auto DTST = static_cast<DependentTemplateSpecializationType*>(T);
+        Add(DTST->Arguments);
+        Add(DTST->Desugared);
+        break;
+    }
+    case TypeKind::TemplateParameterSubstitution:
+        Add(static_cast<TemplateParameterSubstitutionType*>(T)->Replacement);
+        break;
+    case TypeKind::InjectedClassName:
+        Add(static_cast<InjectedClassNameType*>(T)->InjectedSpecializationType);
+        break;
+    case TypeKind::DependentName:
+        Add(static_cast<DependentNameType*>(T)->Desugared);
+        break;
+    case TypeKind::UnaryTransform:
+    {
+        auto UTT = static_cast<UnaryTransformType*>(T);
+        Add(UTT->Desugared);
+        Add(UTT->BaseType);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void ASTNodes::Add(const std::vector<TemplateArgument>& Arguments)
+{
+    for (auto& Argument : Arguments)
+    {
+        Add(Argument.Type);
+        Add(Argument.Declaration);
+    }
+}
+
+void ASTNodes::Add(FunctionTemplateSpecialization* Specialization)
+{
+    if (!Specialization || !Specializations.insert(Specialization).second)
+        return;
+
+    Add(Specialization->Arguments);
+    Add(Specialization->SpecializedFunction);
+}
+
+static void DeleteDeclaration(Declaration* D)
+{
+    switch (D->Kind)
+    {
+    case DeclarationKind::TranslationUnit:
+        delete static_cast<TranslationUnit*>(D);
+        break;
+    case DeclarationKind::Namespace:
+        delete static_cast<Namespace*>(D);
+        break;
+    case DeclarationKind::Typedef:
+        delete static_cast<TypedefDecl*>(D);
+        break;
+    case DeclarationKind::TypeAlias:
+        delete static_cast<TypeAlias*>(D);
+        break;
+    case DeclarationKind::Parameter:
+        delete static_cast<Parameter*>(D);
+        break;
+    case DeclarationKind::Function:
+        delete static_cast<Function*>(D);
+        break;
+    case DeclarationKind::Method:
+        delete static_cast<Method*>(D);
+        break;
+    case DeclarationKind::Enumeration:
+        delete static_cast<Enumeration*>(D);
+        break;
+    case DeclarationKind::EnumerationItem:
+        delete static_cast<Enumeration::Item*>(D);
+        break;
+    case DeclarationKind::Variable:
+        delete static_cast<Variable*>(D);
+        break;
+    case DeclarationKind::Field:
+        delete static_cast<Field*>(D);
+        break;
+    case DeclarationKind::AccessSpecifier:
+        delete static_cast<AccessSpecifierDecl*>(D);
+        break;
+    case DeclarationKind::Class:
+        delete static_cast<Class*>(D);
+        break;
+    case DeclarationKind::TypeAliasTemplate:
+        delete static_cast<TypeAliasTemplate*>(D);
+        break;
+    case DeclarationKind::ClassTemplate:
+        delete static_cast<ClassTemplate*>(D);
+        break;
+    case DeclarationKind::ClassTemplateSpecialization:
+        delete static_cast<ClassTemplateSpecialization*>(D);
+        break;
+    case DeclarationKind::ClassTemplatePartialSpecialization:
+        delete static_cast<ClassTemplatePartialSpecialization*>(D);
+        break;
+    case DeclarationKind::FunctionTemplate:
+        delete static_cast<FunctionTemplate*>(D);
+        break;
+    case DeclarationKind::Friend:
+        delete static_cast<Friend*>(D);
+        break;
+    case DeclarationKind::TemplateTemplateParm:
+        delete static_cast<TemplateTemplateParameter*>(D);
+        break;
+    case DeclarationKind::TemplateTypeParm:
+        delete static_cast<TypeTemplateParameter*>(D);
+        break;
+    case DeclarationKind::NonTypeTemplateParm:
+        delete static_cast<NonTypeTemplateParameter*>(D);
+        break;
+    case DeclarationKind::VarTemplate:
+        delete static_cast<VarTemplate*>(D);
+        break;
+    case DeclarationKind::VarTemplateSpecialization:
+        delete static_cast<VarTemplateSpecialization*>(D);
+        break;
+    case DeclarationKind::VarTemplatePartialSpecialization:
+        delete static_cast<VarTemplatePartialSpecialization*>(D);
+        break;
+    default:
+        break;
+    }
+}
+
+static void DeleteType(Type* T)
+{
+    switch (T->Kind)
+    {
+    case TypeKind::Tag:
+        delete static_cast<TagType*>(T);
+        break;
+    case TypeKind::Array:
+        delete static_cast<ArrayType*>(T);
+        break;
+    case TypeKind::Function:
+        delete static_cast<FunctionType*>(T);
+        break;
+    case TypeKind::Pointer:
+        delete static_cast<PointerType*>(T);
+        break;
+    case TypeKind::MemberPointer:
+        delete static_cast<MemberPointerType*>(T);
+        break;
+    case TypeKind::Typedef:
+        delete static_cast<TypedefType*>(T);
+        break;
+    case TypeKind::Attributed:
+        delete static_cast<AttributedType*>(T);
+        break;
+    case TypeKind::Decayed:
+        delete static_cast<DecayedType*>(T);
+        break;
+    case TypeKind::TemplateSpecialization:
+        delete static_cast<TemplateSpecializationType*>(T);
+        break;
+    case TypeKind::DependentTemplateSpecialization:
+        delete static_cast<DependentTemplateSpecializationType*>(T);
+        break;
+    case TypeKind::TemplateParameter:
+        delete static_cast<TemplateParameterType*>(T);
+        break;
+    case TypeKind::TemplateParameterSubstitution:
+        delete static_cast<TemplateParameterSubstitutionType*>(T);
+        break;
+    case TypeKind::InjectedClassName:
+        delete static_cast<InjectedClassNameType*>(T);
+        break;
+    case TypeKind::DependentName:
+        delete static_cast<DependentNameType*>(T);
+        break;
+    case TypeKind::PackExpansion:
+        delete static_cast<PackExpansionType*>(T);
+        break;
+    case TypeKind::Builtin:
+        delete static_cast<BuiltinType*>(T);
+        break;
+    case TypeKind::UnaryTransform:
+        delete static_cast<UnaryTransformType*>(T);
+        break;
+    }
+}
+
+void ASTNodes::Release()
+{
+    for (auto D : Declarations)
+        DeleteDeclaration(D);
+    for (auto T : Types)
+        DeleteType(T);
+
+    for (auto Entity : Entities)
+    {
+        if (Entity->Kind == DeclarationKind::MacroDefinition)
+            delete static_cast<MacroDefinition*>(Entity);
+        else if (Entity->Kind == DeclarationKind::MacroExpansion)
+            delete static_cast<MacroExpansion*>(Entity);
+    }
+
+    for (auto Specialization : Specializations)
+        delete Specialization;
+    for (auto Base : Bases)
+        delete Base;
+    for (auto Comment : Comments)
+        delete Comment;
+}
+
+void* CppSharp_SerializeAST(ASTContext* Context)
+{
+    if (!Context)
+        return nullptr;
+
+    ASTSerializer Serializer;
+    return new std::vector<char>(Serializer.Serialize(Context));
+}
+
+const void* CppSharp_GetASTBufferData(void* Buffer)
+{
+    return static_cast<std::vector<char>*>(Buffer)->data();
+}
+
+unsigned CppSharp_GetASTBufferSize(void* Buffer)
+{
+    return static_cast<std::vector<char>*>(Buffer)->size();
+}
+
+void CppSharp_FreeASTBuffer(void* Buffer)
+{
+    delete static_cast<std::vector<char>*>(Buffer);
+}
+
+void CppSharp_ReleaseDeclarations(ASTContext* Context)
+{
+    if (!Context)
+        return;
+
+    // The units dropped by incremental parses are released along with the
+    // others, as their declarations may be shared with them.
+    ASTNodes Nodes;
+    for (auto Unit : Context->TranslationUnits)
+        Nodes.Add(Unit);
+    for (auto Unit : Context->StaleUnits)
+        Nodes.Add(Unit);
+
+    Context->TranslationUnits.clear();
+    Context->StaleUnits.clear();
+    Nodes.Release();
+}
@@ -0,0 +1,216 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#pragma once
+
+#include "AST.h"
+
+#include <unordered_map>
+
+namespace CppSharp { namespace CppParser { namespace AST {
+
+/// The AST buffer is a flat, offset-based image of the declarations of an
+/// ASTContext which the managed side can read without crossing the native
+/// boundary for every field. All offsets are relative to the start of the
+/// buffer and all values are in host byte order, as the buffer is only
+/// meant to be consumed in-process (see ASTBuffer.cs).
+///
+/// Layout: header, string table, declaration table, children table, type
+/// table, base class table.
+
+const uint32_t ASTBufferMagic = 0x54415343; // "CSAT"
+const uint32_t ASTBufferVersion = 2;
+
+struct ASTBufferHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t StringsOffset;
+    uint32_t StringsSize;
+    uint32_t DeclarationsOffset;
+    uint32_t DeclarationsCount;
+    uint32_t ChildrenOffset;
+    uint32_t ChildrenCount;
+    uint32_t TypesOffset;
+    uint32_t TypesCount;
+    uint32_t BasesOffset;
+    uint32_t BasesCount;
+};
+
+enum ASTBufferDeclarationFlags
+{
+    IsIncompleteFlag = 1 << 0,
+    IsDependentFlag = 1 << 1,
+    IsImplicitFlag = 1 << 2,
+    IsAnonymousFlag = 1 << 3,
+    IsIndirectFlag = 1 << 4,
+    HasDefaultValueFlag = 1 << 5
+};
+
+enum ASTBufferQualifiers
+{
+    IsConstQualifier = 1 << 0,
+    IsVolatileQualifier = 1 << 1,
+    IsRestrictQualifier = 1 << 2
+};
+
+/// A qualified type, as an index into the type table (-1 for no type).
+struct ASTBufferQualifiedType
+{
+    int32_t Type;
+    uint32_t Qualifiers;
+};
+
+/// Declarations are sorted by their native pointer so that they can be
+/// looked up with a binary search. Declaration references are indices into
+/// the declaration table, or -1 when the declaration was not serialized.
+/// Strings are offsets into the string table, where each entry is a 32-bit
+/// length followed by the null terminated UTF-8 text (offset 0 is "").
+struct ASTBufferDeclaration
+{
+    uint64_t NativePtr;
+    uint64_t OriginalPtr;
+    uint32_t Kind;
+    uint32_t Access;
+    int32_t Namespace;
+    int32_t CompleteDeclaration;
+    uint32_t Location;
+    int32_t LineNumberStart;
+    int32_t LineNumberEnd;
+    uint32_t DefinitionOrder;
+    uint32_t Name;
+    uint32_t USR;
+    uint32_t DebugText;
+    uint32_t Flags;
+    uint32_t ChildrenBegin;
+    uint32_t ChildrenCount;
+    // Type of parameters, fields, variables and typedefs, or the return
+    // type of functions.
+    ASTBufferQualifiedType Type;
+    uint32_t BasesBegin;
+    uint32_t BasesCount;
+    // Position of parameters.
+    uint32_t Index;
+    uint32_t Reserved;
+};
+
+static_assert(sizeof(ASTBufferDeclaration) == 96,
+    "The managed ASTBufferDeclaration layout must be kept in sync");
+
+/// The list of its owner a child declaration comes from, so the converter
+/// does not have to tell it from the kind of the child.
+enum class ASTBufferChildGroup : uint32_t
+{
+    Namespaces,
+    Enums,
+    Functions,
+    Templates,
+    Classes,
+    Typedefs,
+    TypeAliases,
+    Variables,
+    Friends,
+    TemplateParameters,
+    TemplatedDecl,
+    Fields,
+    Methods,
+    Specifiers,
+    Items,
+    Parameters,
+    Specializations
+};
+
+struct ASTBufferChild
+{
+    int32_t Declaration;
+    ASTBufferChildGroup Group;
+};
+
+enum ASTBufferTypeFlags
+{
+    IsDependentTypeFlag = 1 << 0,
+    IsParameterPackFlag = 1 << 1,
+    // Cleared for the types whose fields are not in the buffer (function
+    // types and template specializations, or types referring to a
+    // declaration which was not serialized), which are read from NativePtr.
+    IsSerializedTypeFlag = 1 << 2
+};
+
+/// Types are deduplicated by native pointer. The fields which are used
+/// depend on the kind of the type:
+/// - Declaration: Tag, Typedef, TemplateParameter, InjectedClassName.
+/// - Value: primitive type of Builtin, modifier of Pointer, size type of
+///   Array, depth of TemplateParameter.
+/// - Index: index of TemplateParameter.
+/// - Size, ElementSize: Array.
+/// - Types: pointee of Pointer and MemberPointer, element of Array,
+///   modified and equivalent of Attributed, decayed, original and pointee
+///   of Decayed, replacement of TemplateParameterSubstitution, injected
+///   specialization of InjectedClassName, desugared of DependentName,
+///   desugared and base of UnaryTransform.
+struct ASTBufferType
+{
+    uint64_t NativePtr;
+    uint32_t Kind;
+    uint32_t Flags;
+    int32_t Declaration;
+    uint32_t Value;
+    uint32_t Index;
+    uint32_t Reserved;
+    int64_t Size;
+    int64_t ElementSize;
+    ASTBufferQualifiedType Types[3];
+};
+
+static_assert(sizeof(ASTBufferType) == 72,
+    "The managed ASTBufferType layout must be kept in sync");
+
+struct ASTBufferBase
+{
+    uint32_t Access;
+    uint32_t IsVirtual;
+    int32_t Type;
+    int32_t Offset;
+};
+
+class ASTSerializer
+{
+public:
+    std::vector<char> Serialize(ASTContext* Context);
+
+private:
+    void Collect(Declaration* D);
+    int32_t GetIndex(Declaration* D);
+    uint32_t AddString(const std::string& String);
+    int32_t AddType(Type* T);
+    ASTBufferQualifiedType AddType(const QualifiedType& QualType);
+    bool SetDeclaration(ASTBufferType& Record, Declaration* D);
+
+    std::vector<Declaration*> Declarations;
+    std::unordered_map<Declaration*, int32_t> Indices;
+    std::vector<ASTBufferType> Types;
+    std::unordered_map<Type*, int32_t> TypeIndices;
+    std::unordered_map<std::string, uint32_t> StringOffsets;
+    std::vector<char> Strings;
+};
+
+} } }
+
+extern "C"
+{
+    CS_API void* CppSharp_SerializeAST(CppSharp::CppParser::AST::ASTContext* Context);
+    CS_API const void* CppSharp_GetASTBufferData(void* Buffer);
+    CS_API unsigned CppSharp_GetASTBufferSize(void* Buffer);
+    CS_API void CppSharp_FreeASTBuffer(void* Buffer);
+
+    /// Frees the translation units of a context along with their
+    /// declarations, types, comments and macros, and leaves the context
+    /// empty. The nodes must not be referenced by another context, and
+    /// their managed wrappers must not be disposed, as that would run
+    /// their destructors again.
+    CS_API void CppSharp_ReleaseDeclarations(CppSharp::CppParser::AST::ASTContext* Context);
+}
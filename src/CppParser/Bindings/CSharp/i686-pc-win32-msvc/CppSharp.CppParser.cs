@@ -188,6 +188,18 @@ public enum StatementClass
                 ExplicitCastExpr = 7
             }
 
+            public enum ExpressionValueKind
+            {
+                None = 0,
+                SignedInteger = 1,
+                UnsignedInteger = 2,
+                Boolean = 3,
+                Character = 4,
+                Float = 5,
+                String = 6,
+                NullPtr = 7
+            }
+
             public enum TemplateSpecializationKind
             {
                 Undeclared = 0,
@@ -263,6 +275,16 @@ public enum ArchType
                 x86_64 = 2
             }
 
+            public enum SymbolVariant
+            {
+                Exact = 0,
+                LeadingUnderscore = 1,
+                TrimmedUnderscores = 2,
+                ImpPrefix = 3,
+                DoubleImpPrefix = 4,
+                NotFound = 5
+            }
+
             public unsafe partial class Type : IDisposable
             {
                 [StructLayout(LayoutKind.Explicit, Size = 8)]
@@ -934,6 +956,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getParametersCount@FunctionType@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getParametersCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getParametersData@FunctionType@AST@CppParser@CppSharp@@QAEPAPAVParameter@234@XZ")]
+                    internal static extern global::System.IntPtr getParametersData_0(global::System.IntPtr instance);
                 }
 
                 public static new FunctionType __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -1033,6 +1060,15 @@ public uint ParametersCount
                     }
                 }
 
+                public global::System.IntPtr ParametersData
+                {
+                    get
+                    {
+                        var __ret = Internal.getParametersData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.QualifiedType ReturnType
                 {
                     get
@@ -1822,6 +1858,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@TemplateSpecializationType@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@TemplateSpecializationType@AST@CppParser@CppSharp@@QAEPAUTemplateArgument@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new TemplateSpecializationType __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -1917,6 +1958,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.Template Template
                 {
                     get
@@ -2000,6 +2050,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@DependentTemplateSpecializationType@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@DependentTemplateSpecializationType@AST@CppParser@CppSharp@@QAEPAUTemplateArgument@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new DependentTemplateSpecializationType __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -2095,6 +2150,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.QualifiedType Desugared
                 {
                     get
@@ -3029,6 +3093,11 @@ public partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getComponentsCount@VTableLayout@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getComponentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getComponentsData@VTableLayout@AST@CppParser@CppSharp@@QAEPAUVTableComponent@234@XZ")]
+                    internal static extern global::System.IntPtr getComponentsData_0(global::System.IntPtr instance);
                 }
 
                 public global::System.IntPtr __Instance { get; protected set; }
@@ -3132,6 +3201,15 @@ public uint ComponentsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr ComponentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getComponentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class VFTableInfo : IDisposable
@@ -3696,15 +3774,30 @@ public partial struct Internal
                         EntryPoint="?getVFTablesCount@ClassLayout@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getVFTablesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getVFTablesData@ClassLayout@AST@CppParser@CppSharp@@QAEPAUVFTableInfo@234@XZ")]
+                    internal static extern global::System.IntPtr getVFTablesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFieldsCount@ClassLayout@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getFieldsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getFieldsData@ClassLayout@AST@CppParser@CppSharp@@QAEPAVLayoutField@234@XZ")]
+                    internal static extern global::System.IntPtr getFieldsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getBasesCount@ClassLayout@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getBasesCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getBasesData@ClassLayout@AST@CppParser@CppSharp@@QAEPAVLayoutBase@234@XZ")]
+                    internal static extern global::System.IntPtr getBasesData_0(global::System.IntPtr instance);
                 }
 
                 public global::System.IntPtr __Instance { get; protected set; }
@@ -3849,6 +3942,15 @@ public uint VFTablesCount
                     }
                 }
 
+                public global::System.IntPtr VFTablesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getVFTablesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint FieldsCount
                 {
                     get
@@ -3858,6 +3960,15 @@ public uint FieldsCount
                     }
                 }
 
+                public global::System.IntPtr FieldsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getFieldsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint BasesCount
                 {
                     get
@@ -3867,6 +3978,15 @@ public uint BasesCount
                     }
                 }
 
+                public global::System.IntPtr BasesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getBasesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.CppAbi ABI
                 {
                     get
@@ -4079,6 +4199,11 @@ public partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getPreprocessedEntitiesCount@Declaration@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getPreprocessedEntitiesCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getPreprocessedEntitiesData@Declaration@AST@CppParser@CppSharp@@QAEPAPAVPreprocessedEntity@234@XZ")]
+                    internal static extern global::System.IntPtr getPreprocessedEntitiesData_0(global::System.IntPtr instance);
                 }
 
                 public global::System.IntPtr __Instance { get; protected set; }
@@ -4233,6 +4358,15 @@ public uint PreprocessedEntitiesCount
                     }
                 }
 
+                public global::System.IntPtr PreprocessedEntitiesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getPreprocessedEntitiesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.DeclarationKind Kind
                 {
                     get
@@ -4662,45 +4796,90 @@ public new partial struct Internal
                         EntryPoint="?getNamespacesCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getNamespacesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getNamespacesData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVNamespace@234@XZ")]
+                    internal static extern global::System.IntPtr getNamespacesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getEnumsCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getEnumsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getEnumsData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVEnumeration@234@XZ")]
+                    internal static extern global::System.IntPtr getEnumsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFunctionsCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getFunctionsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getFunctionsData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVFunction@234@XZ")]
+                    internal static extern global::System.IntPtr getFunctionsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getClassesCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getClassesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getClassesData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVClass@234@XZ")]
+                    internal static extern global::System.IntPtr getClassesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getTemplatesCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getTemplatesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTemplatesData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVTemplate@234@XZ")]
+                    internal static extern global::System.IntPtr getTemplatesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getTypedefsCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getTypedefsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTypedefsData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVTypedefDecl@234@XZ")]
+                    internal static extern global::System.IntPtr getTypedefsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getTypeAliasesCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getTypeAliasesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTypeAliasesData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVTypeAlias@234@XZ")]
+                    internal static extern global::System.IntPtr getTypeAliasesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getVariablesCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getVariablesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getVariablesData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVVariable@234@XZ")]
+                    internal static extern global::System.IntPtr getVariablesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFriendsCount@DeclarationContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getFriendsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getFriendsData@DeclarationContext@AST@CppParser@CppSharp@@QAEPAPAVFriend@234@XZ")]
+                    internal static extern global::System.IntPtr getFriendsData_0(global::System.IntPtr instance);
                 }
 
                 public static new DeclarationContext __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -4993,6 +5172,15 @@ public uint NamespacesCount
                     }
                 }
 
+                public global::System.IntPtr NamespacesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getNamespacesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint EnumsCount
                 {
                     get
@@ -5002,6 +5190,15 @@ public uint EnumsCount
                     }
                 }
 
+                public global::System.IntPtr EnumsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getEnumsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint FunctionsCount
                 {
                     get
@@ -5011,6 +5208,15 @@ public uint FunctionsCount
                     }
                 }
 
+                public global::System.IntPtr FunctionsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getFunctionsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint ClassesCount
                 {
                     get
@@ -5020,6 +5226,15 @@ public uint ClassesCount
                     }
                 }
 
+                public global::System.IntPtr ClassesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getClassesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint TemplatesCount
                 {
                     get
@@ -5029,6 +5244,15 @@ public uint TemplatesCount
                     }
                 }
 
+                public global::System.IntPtr TemplatesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getTemplatesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint TypedefsCount
                 {
                     get
@@ -5038,6 +5262,15 @@ public uint TypedefsCount
                     }
                 }
 
+                public global::System.IntPtr TypedefsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getTypedefsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint TypeAliasesCount
                 {
                     get
@@ -5047,6 +5280,15 @@ public uint TypeAliasesCount
                     }
                 }
 
+                public global::System.IntPtr TypeAliasesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getTypeAliasesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint VariablesCount
                 {
                     get
@@ -5056,6 +5298,15 @@ public uint VariablesCount
                     }
                 }
 
+                public global::System.IntPtr VariablesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getVariablesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint FriendsCount
                 {
                     get
@@ -5065,6 +5316,15 @@ public uint FriendsCount
                     }
                 }
 
+                public global::System.IntPtr FriendsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getFriendsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public bool IsAnonymous
                 {
                     get
@@ -5841,7 +6101,7 @@ public string String
 
             public unsafe partial class Expression : global::CppSharp.Parser.AST.Statement, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 32)]
+                [StructLayout(LayoutKind.Explicit, Size = 80)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -5853,6 +6113,18 @@ public new partial struct Internal
                     [FieldOffset(8)]
                     public global::std.basic_string.Internal String;
 
+                    [FieldOffset(32)]
+                    public global::CppSharp.Parser.AST.ExpressionValueKind ValueKind;
+
+                    [FieldOffset(40)]
+                    public ulong IntegerValue;
+
+                    [FieldOffset(48)]
+                    public double FloatValue;
+
+                    [FieldOffset(56)]
+                    public global::std.basic_string.Internal StringValue;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0Expression@AST@CppParser@CppSharp@@QAE@ABV0123@@Z")]
@@ -5862,6 +6134,16 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??1Expression@AST@CppParser@CppSharp@@QAE@XZ")]
                     internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getStringValue@Expression@AST@CppParser@CppSharp@@QAEPBDXZ")]
+                    internal static extern global::System.IntPtr getStringValue_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?setStringValue@Expression@AST@CppParser@CppSharp@@QAEXPBD@Z")]
+                    internal static extern void setStringValue_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
                 }
 
                 public static new Expression __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -5876,7 +6158,7 @@ public static Expression __CreateInstance(Expression.Internal native, bool skipV
 
                 private static void* __CopyValue(Expression.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(32);
+                    var ret = Marshal.AllocHGlobal(80);
                     global::CppSharp.Parser.AST.Expression.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -5900,7 +6182,7 @@ protected Expression(void* native, bool skipVTables = false)
                 public Expression(global::CppSharp.Parser.AST.Expression _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(32);
+                    __Instance = Marshal.AllocHGlobal(80);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -5918,11 +6200,65 @@ public override void Dispose(bool disposing)
                     if (__ownsNativeInstance)
                         Marshal.FreeHGlobal(__Instance);
                 }
+
+                public string StringValue
+                {
+                    get
+                    {
+                        var __ret = Internal.getStringValue_0((__Instance + __PointerAdjustment));
+                        return Marshal.PtrToStringAnsi(__ret);
+                    }
+
+                    set
+                    {
+                        var __arg0 = value;
+                        Internal.setStringValue_0((__Instance + __PointerAdjustment), __arg0);
+                    }
+                }
+
+                public global::CppSharp.Parser.AST.ExpressionValueKind ValueKind
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->ValueKind;
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->ValueKind = value;
+                    }
+                }
+
+                public ulong IntegerValue
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->IntegerValue;
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->IntegerValue = value;
+                    }
+                }
+
+                public double FloatValue
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->FloatValue;
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->FloatValue = value;
+                    }
+                }
             }
 
             public unsafe partial class BinaryOperator : global::CppSharp.Parser.AST.Expression, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 64)]
+                [StructLayout(LayoutKind.Explicit, Size = 112)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -5935,12 +6271,24 @@ public new partial struct Internal
                     public global::std.basic_string.Internal String;
 
                     [FieldOffset(32)]
+                    public global::CppSharp.Parser.AST.ExpressionValueKind ValueKind;
+
+                    [FieldOffset(40)]
+                    public ulong IntegerValue;
+
+                    [FieldOffset(48)]
+                    public double FloatValue;
+
+                    [FieldOffset(56)]
+                    public global::std.basic_string.Internal StringValue;
+
+                    [FieldOffset(80)]
                     public global::System.IntPtr LHS;
 
-                    [FieldOffset(36)]
+                    [FieldOffset(84)]
                     public global::System.IntPtr RHS;
 
-                    [FieldOffset(40)]
+                    [FieldOffset(88)]
                     public global::std.basic_string.Internal OpcodeStr;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -5976,7 +6324,7 @@ public static BinaryOperator __CreateInstance(BinaryOperator.Internal native, bo
 
                 private static void* __CopyValue(BinaryOperator.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(64);
+                    var ret = Marshal.AllocHGlobal(112);
                     global::CppSharp.Parser.AST.BinaryOperator.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -6000,7 +6348,7 @@ protected BinaryOperator(void* native, bool skipVTables = false)
                 public BinaryOperator(global::CppSharp.Parser.AST.BinaryOperator _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(64);
+                    __Instance = Marshal.AllocHGlobal(112);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -6073,7 +6421,7 @@ public string OpcodeStr
 
             public unsafe partial class CallExpr : global::CppSharp.Parser.AST.Expression, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 44)]
+                [StructLayout(LayoutKind.Explicit, Size = 96)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -6086,6 +6434,18 @@ public new partial struct Internal
                     public global::std.basic_string.Internal String;
 
                     [FieldOffset(32)]
+                    public global::CppSharp.Parser.AST.ExpressionValueKind ValueKind;
+
+                    [FieldOffset(40)]
+                    public ulong IntegerValue;
+
+                    [FieldOffset(48)]
+                    public double FloatValue;
+
+                    [FieldOffset(56)]
+                    public global::std.basic_string.Internal StringValue;
+
+                    [FieldOffset(80)]
                     internal global::std.vector.Internal Arguments;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -6117,6 +6477,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@CallExpr@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@CallExpr@AST@CppParser@CppSharp@@QAEPAPAVExpression@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new CallExpr __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -6131,7 +6496,7 @@ public static CallExpr __CreateInstance(CallExpr.Internal native, bool skipVTabl
 
                 private static void* __CopyValue(CallExpr.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(44);
+                    var ret = Marshal.AllocHGlobal(96);
                     global::CppSharp.Parser.AST.CallExpr.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -6155,7 +6520,7 @@ protected CallExpr(void* native, bool skipVTables = false)
                 public CallExpr(global::CppSharp.Parser.AST.CallExpr _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(44);
+                    __Instance = Marshal.AllocHGlobal(96);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -6206,11 +6571,20 @@ public uint ArgumentsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class CXXConstructExpr : global::CppSharp.Parser.AST.Expression, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 44)]
+                [StructLayout(LayoutKind.Explicit, Size = 96)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -6223,6 +6597,18 @@ public new partial struct Internal
                     public global::std.basic_string.Internal String;
 
                     [FieldOffset(32)]
+                    public global::CppSharp.Parser.AST.ExpressionValueKind ValueKind;
+
+                    [FieldOffset(40)]
+                    public ulong IntegerValue;
+
+                    [FieldOffset(48)]
+                    public double FloatValue;
+
+                    [FieldOffset(56)]
+                    public global::std.basic_string.Internal StringValue;
+
+                    [FieldOffset(80)]
                     internal global::std.vector.Internal Arguments;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -6254,6 +6640,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@CXXConstructExpr@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@CXXConstructExpr@AST@CppParser@CppSharp@@QAEPAPAVExpression@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new CXXConstructExpr __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -6268,7 +6659,7 @@ public static CXXConstructExpr __CreateInstance(CXXConstructExpr.Internal native
 
                 private static void* __CopyValue(CXXConstructExpr.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(44);
+                    var ret = Marshal.AllocHGlobal(96);
                     global::CppSharp.Parser.AST.CXXConstructExpr.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -6292,7 +6683,7 @@ protected CXXConstructExpr(void* native, bool skipVTables = false)
                 public CXXConstructExpr(global::CppSharp.Parser.AST.CXXConstructExpr _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(44);
+                    __Instance = Marshal.AllocHGlobal(96);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -6343,6 +6734,15 @@ public uint ArgumentsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class Parameter : global::CppSharp.Parser.AST.Declaration, IDisposable
@@ -6567,9 +6967,230 @@ public uint Index
                 }
             }
 
+            public unsafe partial class FunctionTargetLayout : IDisposable
+            {
+                [StructLayout(LayoutKind.Explicit, Size = 40)]
+                public partial struct Internal
+                {
+                    [FieldOffset(0)]
+                    public global::std.basic_string.Internal Mangled;
+
+                    [FieldOffset(24)]
+                    public byte IsReturnIndirect;
+
+                    [FieldOffset(25)]
+                    public byte HasThisReturn;
+
+                    [FieldOffset(28)]
+                    internal global::std.vector.Internal IndirectParameters;
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??0FunctionTargetLayout@AST@CppParser@CppSharp@@QAE@XZ")]
+                    internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??0FunctionTargetLayout@AST@CppParser@CppSharp@@QAE@ABU0123@@Z")]
+                    internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??1FunctionTargetLayout@AST@CppParser@CppSharp@@QAE@XZ")]
+                    internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIndirectParameters@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEII@Z")]
+                    internal static extern uint getIndirectParameters_0(global::System.IntPtr instance, uint i);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?addIndirectParameters@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEXAAI@Z")]
+                    internal static extern void addIndirectParameters_0(global::System.IntPtr instance, uint* s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?clearIndirectParameters@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEXXZ")]
+                    internal static extern void clearIndirectParameters_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getMangled@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEPBDXZ")]
+                    internal static extern global::System.IntPtr getMangled_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?setMangled@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEXPBD@Z")]
+                    internal static extern void setMangled_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIndirectParametersCount@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEIXZ")]
+                    internal static extern uint getIndirectParametersCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIndirectParametersData@FunctionTargetLayout@AST@CppParser@CppSharp@@QAEPAIXZ")]
+                    internal static extern uint* getIndirectParametersData_0(global::System.IntPtr instance);
+                }
+
+                public global::System.IntPtr __Instance { get; protected set; }
+
+                protected int __PointerAdjustment;
+                public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, FunctionTargetLayout> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, FunctionTargetLayout>();
+                protected void*[] __OriginalVTables;
+
+                protected bool __ownsNativeInstance;
+
+                public static FunctionTargetLayout __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+                {
+                    return new FunctionTargetLayout(native.ToPointer(), skipVTables);
+                }
+
+                public static FunctionTargetLayout __CreateInstance(FunctionTargetLayout.Internal native, bool skipVTables = false)
+                {
+                    return new FunctionTargetLayout(native, skipVTables);
+                }
+
+                private static void* __CopyValue(FunctionTargetLayout.Internal native)
+                {
+                    var ret = Marshal.AllocHGlobal(40);
+                    global::CppSharp.Parser.AST.FunctionTargetLayout.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                    return ret.ToPointer();
+                }
+
+                private FunctionTargetLayout(FunctionTargetLayout.Internal native, bool skipVTables = false)
+                    : this(__CopyValue(native), skipVTables)
+                {
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                }
+
+                protected FunctionTargetLayout(void* native, bool skipVTables = false)
+                {
+                    if (native == null)
+                        return;
+                    __Instance = new global::System.IntPtr(native);
+                }
+
+                public FunctionTargetLayout()
+                {
+                    __Instance = Marshal.AllocHGlobal(40);
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                    Internal.ctor_0((__Instance + __PointerAdjustment));
+                }
+
+                public FunctionTargetLayout(global::CppSharp.Parser.AST.FunctionTargetLayout _0)
+                {
+                    __Instance = Marshal.AllocHGlobal(40);
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                    if (ReferenceEquals(_0, null))
+                        throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
+                    var __arg0 = _0.__Instance;
+                    Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void Dispose()
+                {
+                    Dispose(disposing: true);
+                }
+
+                public virtual void Dispose(bool disposing)
+                {
+                    global::CppSharp.Parser.AST.FunctionTargetLayout __dummy;
+                    NativeToManagedMap.TryRemove(__Instance, out __dummy);
+                    if (disposing)
+                        Internal.dtor_0((__Instance + __PointerAdjustment), 0);
+                    if (__ownsNativeInstance)
+                        Marshal.FreeHGlobal(__Instance);
+                }
+
+                public uint getIndirectParameters(uint i)
+                {
+                    var __ret = Internal.getIndirectParameters_0((__Instance + __PointerAdjustment), i);
+                    return __ret;
+                }
+
+                public void addIndirectParameters(ref uint s)
+                {
+                    fixed (uint* __refParamPtr0 = &s)
+                    {
+                        var __arg0 = __refParamPtr0;
+                        Internal.addIndirectParameters_0((__Instance + __PointerAdjustment), __arg0);
+                    }
+                }
+
+                public void clearIndirectParameters()
+                {
+                    Internal.clearIndirectParameters_0((__Instance + __PointerAdjustment));
+                }
+
+                public string Mangled
+                {
+                    get
+                    {
+                        var __ret = Internal.getMangled_0((__Instance + __PointerAdjustment));
+                        return Marshal.PtrToStringAnsi(__ret);
+                    }
+
+                    set
+                    {
+                        var __arg0 = value;
+                        Internal.setMangled_0((__Instance + __PointerAdjustment), __arg0);
+                    }
+                }
+
+                public uint IndirectParametersCount
+                {
+                    get
+                    {
+                        var __ret = Internal.getIndirectParametersCount_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public uint* IndirectParametersData
+                {
+                    get
+                    {
+                        var __ret = Internal.getIndirectParametersData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public bool IsReturnIndirect
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->IsReturnIndirect != 0;
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->IsReturnIndirect = (byte) (value ? 1 : 0);
+                    }
+                }
+
+                public bool HasThisReturn
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->HasThisReturn != 0;
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->HasThisReturn = (byte) (value ? 1 : 0);
+                    }
+                }
+            }
+
             public unsafe partial class Function : global::CppSharp.Parser.AST.Declaration, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 220)]
+                [StructLayout(LayoutKind.Explicit, Size = 232)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -6665,6 +7286,9 @@ public new partial struct Internal
                     [FieldOffset(216)]
                     public global::System.IntPtr InstantiatedFrom;
 
+                    [FieldOffset(220)]
+                    internal global::std.vector.Internal TargetLayouts;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0Function@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -6695,6 +7319,21 @@ public new partial struct Internal
                         EntryPoint="?clearParameters@Function@AST@CppParser@CppSharp@@QAEXXZ")]
                     internal static extern void clearParameters_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayouts@Function@AST@CppParser@CppSharp@@QAE?AUFunctionTargetLayout@234@I@Z")]
+                    internal static extern void getTargetLayouts_0(global::System.IntPtr instance, global::System.IntPtr @return, uint i);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?addTargetLayouts@Function@AST@CppParser@CppSharp@@QAEXAAUFunctionTargetLayout@234@@Z")]
+                    internal static extern void addTargetLayouts_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?clearTargetLayouts@Function@AST@CppParser@CppSharp@@QAEXXZ")]
+                    internal static extern void clearTargetLayouts_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getMangled@Function@AST@CppParser@CppSharp@@QAEPBDXZ")]
@@ -6719,6 +7358,21 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getParametersCount@Function@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getParametersCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getParametersData@Function@AST@CppParser@CppSharp@@QAEPAPAVParameter@234@XZ")]
+                    internal static extern global::System.IntPtr getParametersData_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayoutsCount@Function@AST@CppParser@CppSharp@@QAEIXZ")]
+                    internal static extern uint getTargetLayoutsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayoutsData@Function@AST@CppParser@CppSharp@@QAEPAUFunctionTargetLayout@234@XZ")]
+                    internal static extern global::System.IntPtr getTargetLayoutsData_0(global::System.IntPtr instance);
                 }
 
                 public static new Function __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -6733,7 +7387,7 @@ public static Function __CreateInstance(Function.Internal native, bool skipVTabl
 
                 private static void* __CopyValue(Function.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(220);
+                    var ret = Marshal.AllocHGlobal(232);
                     global::CppSharp.Parser.AST.Function.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -6757,7 +7411,7 @@ protected Function(void* native, bool skipVTables = false)
                 public Function()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(220);
+                    __Instance = Marshal.AllocHGlobal(232);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -6766,7 +7420,7 @@ public Function()
                 public Function(global::CppSharp.Parser.AST.Function _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(220);
+                    __Instance = Marshal.AllocHGlobal(232);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -6809,6 +7463,26 @@ public void clearParameters()
                     Internal.clearParameters_0((__Instance + __PointerAdjustment));
                 }
 
+                public global::CppSharp.Parser.AST.FunctionTargetLayout getTargetLayouts(uint i)
+                {
+                    var __ret = new global::CppSharp.Parser.AST.FunctionTargetLayout.Internal();
+                    Internal.getTargetLayouts_0((__Instance + __PointerAdjustment), new IntPtr(&__ret), i);
+                    return global::CppSharp.Parser.AST.FunctionTargetLayout.__CreateInstance(__ret);
+                }
+
+                public void addTargetLayouts(global::CppSharp.Parser.AST.FunctionTargetLayout s)
+                {
+                    if (ReferenceEquals(s, null))
+                        throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                    var __arg0 = s.__Instance;
+                    Internal.addTargetLayouts_0((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void clearTargetLayouts()
+                {
+                    Internal.clearTargetLayouts_0((__Instance + __PointerAdjustment));
+                }
+
                 public string Mangled
                 {
                     get
@@ -6848,28 +7522,55 @@ public uint ParametersCount
                     }
                 }
 
-                public global::CppSharp.Parser.AST.QualifiedType ReturnType
+                public global::System.IntPtr ParametersData
                 {
                     get
                     {
-                        return global::CppSharp.Parser.AST.QualifiedType.__CreateInstance(((Internal*) __Instance)->ReturnType);
+                        var __ret = Internal.getParametersData_0((__Instance + __PointerAdjustment));
+                        return __ret;
                     }
+                }
 
-                    set
+                public uint TargetLayoutsCount
+                {
+                    get
                     {
-                        ((Internal*) __Instance)->ReturnType = ReferenceEquals(value, null) ? new global::CppSharp.Parser.AST.QualifiedType.Internal() : *(global::CppSharp.Parser.AST.QualifiedType.Internal*) (value.__Instance);
+                        var __ret = Internal.getTargetLayoutsCount_0((__Instance + __PointerAdjustment));
+                        return __ret;
                     }
                 }
 
-                public bool IsReturnIndirect
+                public global::System.IntPtr TargetLayoutsData
                 {
                     get
                     {
-                        return ((Internal*) __Instance)->IsReturnIndirect != 0;
+                        var __ret = Internal.getTargetLayoutsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
                     }
+                }
 
-                    set
-                    {
+                public global::CppSharp.Parser.AST.QualifiedType ReturnType
+                {
+                    get
+                    {
+                        return global::CppSharp.Parser.AST.QualifiedType.__CreateInstance(((Internal*) __Instance)->ReturnType);
+                    }
+
+                    set
+                    {
+                        ((Internal*) __Instance)->ReturnType = ReferenceEquals(value, null) ? new global::CppSharp.Parser.AST.QualifiedType.Internal() : *(global::CppSharp.Parser.AST.QualifiedType.Internal*) (value.__Instance);
+                    }
+                }
+
+                public bool IsReturnIndirect
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->IsReturnIndirect != 0;
+                    }
+
+                    set
+                    {
                         ((Internal*) __Instance)->IsReturnIndirect = (byte) (value ? 1 : 0);
                     }
                 }
@@ -7004,7 +7705,7 @@ public bool IsDeleted
 
             public unsafe partial class Method : global::CppSharp.Parser.AST.Function, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 244)]
+                [StructLayout(LayoutKind.Explicit, Size = 256)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -7101,33 +7802,36 @@ public new partial struct Internal
                     public global::System.IntPtr InstantiatedFrom;
 
                     [FieldOffset(220)]
+                    internal global::std.vector.Internal TargetLayouts;
+
+                    [FieldOffset(232)]
                     public byte IsVirtual;
 
-                    [FieldOffset(221)]
+                    [FieldOffset(233)]
                     public byte IsStatic;
 
-                    [FieldOffset(222)]
+                    [FieldOffset(234)]
                     public byte IsConst;
 
-                    [FieldOffset(223)]
+                    [FieldOffset(235)]
                     public byte IsExplicit;
 
-                    [FieldOffset(224)]
+                    [FieldOffset(236)]
                     public byte IsOverride;
 
-                    [FieldOffset(228)]
+                    [FieldOffset(240)]
                     public global::CppSharp.Parser.AST.CXXMethodKind MethodKind;
 
-                    [FieldOffset(232)]
+                    [FieldOffset(244)]
                     public byte IsDefaultConstructor;
 
-                    [FieldOffset(233)]
+                    [FieldOffset(245)]
                     public byte IsCopyConstructor;
 
-                    [FieldOffset(234)]
+                    [FieldOffset(246)]
                     public byte IsMoveConstructor;
 
-                    [FieldOffset(236)]
+                    [FieldOffset(248)]
                     public global::CppSharp.Parser.AST.QualifiedType.Internal ConversionType;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -7158,7 +7862,7 @@ public static Method __CreateInstance(Method.Internal native, bool skipVTables =
 
                 private static void* __CopyValue(Method.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(244);
+                    var ret = Marshal.AllocHGlobal(256);
                     global::CppSharp.Parser.AST.Method.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -7182,7 +7886,7 @@ protected Method(void* native, bool skipVTables = false)
                 public Method()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(244);
+                    __Instance = Marshal.AllocHGlobal(256);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -7191,7 +7895,7 @@ public Method()
                 public Method(global::CppSharp.Parser.AST.Method _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(244);
+                    __Instance = Marshal.AllocHGlobal(256);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -7476,6 +8180,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getItemsCount@Enumeration@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getItemsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getItemsData@Enumeration@AST@CppParser@CppSharp@@QAEPAPAVItem@1234@XZ")]
+                    internal static extern global::System.IntPtr getItemsData_0(global::System.IntPtr instance);
                 }
 
                 [Flags]
@@ -7764,6 +8473,15 @@ public uint ItemsCount
                     }
                 }
 
+                public global::System.IntPtr ItemsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getItemsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.Enumeration.EnumModifiers Modifiers
                 {
                     get
@@ -8494,7 +9212,7 @@ public override void Dispose(bool disposing)
 
             public unsafe partial class Class : global::CppSharp.Parser.AST.DeclarationContext, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 312)]
+                [StructLayout(LayoutKind.Explicit, Size = 324)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -8623,6 +9341,9 @@ public new partial struct Internal
                     [FieldOffset(308)]
                     public global::System.IntPtr Layout;
 
+                    [FieldOffset(312)]
+                    internal global::std.vector.Internal TargetLayouts;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0Class@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -8698,25 +9419,70 @@ public new partial struct Internal
                         EntryPoint="?clearSpecifiers@Class@AST@CppParser@CppSharp@@QAEXXZ")]
                     internal static extern void clearSpecifiers_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayouts@Class@AST@CppParser@CppSharp@@QAEPAUClassLayout@234@I@Z")]
+                    internal static extern global::System.IntPtr getTargetLayouts_0(global::System.IntPtr instance, uint i);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?addTargetLayouts@Class@AST@CppParser@CppSharp@@QAEXAAPAUClassLayout@234@@Z")]
+                    internal static extern void addTargetLayouts_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?clearTargetLayouts@Class@AST@CppParser@CppSharp@@QAEXXZ")]
+                    internal static extern void clearTargetLayouts_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getBasesCount@Class@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getBasesCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getBasesData@Class@AST@CppParser@CppSharp@@QAEPAPAUBaseClassSpecifier@234@XZ")]
+                    internal static extern global::System.IntPtr getBasesData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFieldsCount@Class@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getFieldsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getFieldsData@Class@AST@CppParser@CppSharp@@QAEPAPAVField@234@XZ")]
+                    internal static extern global::System.IntPtr getFieldsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getMethodsCount@Class@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getMethodsCount_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getMethodsData@Class@AST@CppParser@CppSharp@@QAEPAPAVMethod@234@XZ")]
+                    internal static extern global::System.IntPtr getMethodsData_0(global::System.IntPtr instance);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getSpecifiersCount@Class@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getSpecifiersCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getSpecifiersData@Class@AST@CppParser@CppSharp@@QAEPAPAVAccessSpecifierDecl@234@XZ")]
+                    internal static extern global::System.IntPtr getSpecifiersData_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayoutsCount@Class@AST@CppParser@CppSharp@@QAEIXZ")]
+                    internal static extern uint getTargetLayoutsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTargetLayoutsData@Class@AST@CppParser@CppSharp@@QAEPAPAUClassLayout@234@XZ")]
+                    internal static extern global::System.IntPtr getTargetLayoutsData_0(global::System.IntPtr instance);
                 }
 
                 public static new Class __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -8731,7 +9497,7 @@ public static Class __CreateInstance(Class.Internal native, bool skipVTables = f
 
                 private static void* __CopyValue(Class.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(312);
+                    var ret = Marshal.AllocHGlobal(324);
                     global::CppSharp.Parser.AST.Class.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -8755,7 +9521,7 @@ protected Class(void* native, bool skipVTables = false)
                 public Class()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(312);
+                    __Instance = Marshal.AllocHGlobal(324);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -8764,7 +9530,7 @@ public Class()
                 public Class(global::CppSharp.Parser.AST.Class _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(312);
+                    __Instance = Marshal.AllocHGlobal(324);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -8879,6 +9645,30 @@ public void clearSpecifiers()
                     Internal.clearSpecifiers_0((__Instance + __PointerAdjustment));
                 }
 
+                public global::CppSharp.Parser.AST.ClassLayout getTargetLayouts(uint i)
+                {
+                    var __ret = Internal.getTargetLayouts_0((__Instance + __PointerAdjustment), i);
+                    global::CppSharp.Parser.AST.ClassLayout __result0;
+                    if (__ret == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.AST.ClassLayout.NativeToManagedMap.ContainsKey(__ret))
+                        __result0 = (global::CppSharp.Parser.AST.ClassLayout) global::CppSharp.Parser.AST.ClassLayout.NativeToManagedMap[__ret];
+                    else __result0 = global::CppSharp.Parser.AST.ClassLayout.__CreateInstance(__ret);
+                    return __result0;
+                }
+
+                public void addTargetLayouts(global::CppSharp.Parser.AST.ClassLayout s)
+                {
+                    if (ReferenceEquals(s, null))
+                        throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                    var __arg0 = s.__Instance;
+                    Internal.addTargetLayouts_0((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void clearTargetLayouts()
+                {
+                    Internal.clearTargetLayouts_0((__Instance + __PointerAdjustment));
+                }
+
                 public uint BasesCount
                 {
                     get
@@ -8888,6 +9678,15 @@ public uint BasesCount
                     }
                 }
 
+                public global::System.IntPtr BasesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getBasesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint FieldsCount
                 {
                     get
@@ -8897,6 +9696,15 @@ public uint FieldsCount
                     }
                 }
 
+                public global::System.IntPtr FieldsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getFieldsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint MethodsCount
                 {
                     get
@@ -8906,6 +9714,15 @@ public uint MethodsCount
                     }
                 }
 
+                public global::System.IntPtr MethodsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getMethodsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint SpecifiersCount
                 {
                     get
@@ -8915,6 +9732,33 @@ public uint SpecifiersCount
                     }
                 }
 
+                public global::System.IntPtr SpecifiersData
+                {
+                    get
+                    {
+                        var __ret = Internal.getSpecifiersData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public uint TargetLayoutsCount
+                {
+                    get
+                    {
+                        var __ret = Internal.getTargetLayoutsCount_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public global::System.IntPtr TargetLayoutsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getTargetLayoutsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public bool IsPOD
                 {
                     get
@@ -9152,6 +9996,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getParametersCount@Template@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getParametersCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getParametersData@Template@AST@CppParser@CppSharp@@QAEPAPAVDeclaration@234@XZ")]
+                    internal static extern global::System.IntPtr getParametersData_0(global::System.IntPtr instance);
                 }
 
                 public static new Template __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -9261,6 +10110,15 @@ public uint ParametersCount
                     }
                 }
 
+                public global::System.IntPtr ParametersData
+                {
+                    get
+                    {
+                        var __ret = Internal.getParametersData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.Declaration TemplatedDecl
                 {
                     get
@@ -10276,6 +11134,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getSpecializationsCount@ClassTemplate@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getSpecializationsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getSpecializationsData@ClassTemplate@AST@CppParser@CppSharp@@QAEPAPAVClassTemplateSpecialization@234@XZ")]
+                    internal static extern global::System.IntPtr getSpecializationsData_0(global::System.IntPtr instance);
                 }
 
                 public static new ClassTemplate __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -10374,11 +11237,20 @@ public uint SpecializationsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr SpecializationsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getSpecializationsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class ClassTemplateSpecialization : global::CppSharp.Parser.AST.Class, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 332)]
+                [StructLayout(LayoutKind.Explicit, Size = 344)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -10508,12 +11380,15 @@ public new partial struct Internal
                     public global::System.IntPtr Layout;
 
                     [FieldOffset(312)]
+                    internal global::std.vector.Internal TargetLayouts;
+
+                    [FieldOffset(324)]
                     public global::System.IntPtr TemplatedDecl;
 
-                    [FieldOffset(316)]
+                    [FieldOffset(328)]
                     internal global::std.vector.Internal Arguments;
 
-                    [FieldOffset(328)]
+                    [FieldOffset(340)]
                     public global::CppSharp.Parser.AST.TemplateSpecializationKind SpecializationKind;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -10550,6 +11425,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@ClassTemplateSpecialization@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@ClassTemplateSpecialization@AST@CppParser@CppSharp@@QAEPAUTemplateArgument@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new ClassTemplateSpecialization __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -10564,7 +11444,7 @@ public static ClassTemplateSpecialization __CreateInstance(ClassTemplateSpeciali
 
                 private static void* __CopyValue(ClassTemplateSpecialization.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(332);
+                    var ret = Marshal.AllocHGlobal(344);
                     global::CppSharp.Parser.AST.ClassTemplateSpecialization.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -10588,7 +11468,7 @@ protected ClassTemplateSpecialization(void* native, bool skipVTables = false)
                 public ClassTemplateSpecialization()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(332);
+                    __Instance = Marshal.AllocHGlobal(344);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -10597,7 +11477,7 @@ public ClassTemplateSpecialization()
                 public ClassTemplateSpecialization(global::CppSharp.Parser.AST.ClassTemplateSpecialization _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(332);
+                    __Instance = Marshal.AllocHGlobal(344);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -10645,6 +11525,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.ClassTemplate TemplatedDecl
                 {
                     get
@@ -10679,7 +11568,7 @@ public uint ArgumentsCount
 
             public unsafe partial class ClassTemplatePartialSpecialization : global::CppSharp.Parser.AST.ClassTemplateSpecialization, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 332)]
+                [StructLayout(LayoutKind.Explicit, Size = 344)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -10809,12 +11698,15 @@ public new partial struct Internal
                     public global::System.IntPtr Layout;
 
                     [FieldOffset(312)]
+                    internal global::std.vector.Internal TargetLayouts;
+
+                    [FieldOffset(324)]
                     public global::System.IntPtr TemplatedDecl;
 
-                    [FieldOffset(316)]
+                    [FieldOffset(328)]
                     internal global::std.vector.Internal Arguments;
 
-                    [FieldOffset(328)]
+                    [FieldOffset(340)]
                     public global::CppSharp.Parser.AST.TemplateSpecializationKind SpecializationKind;
 
                     [SuppressUnmanagedCodeSecurity]
@@ -10845,7 +11737,7 @@ public static ClassTemplatePartialSpecialization __CreateInstance(ClassTemplateP
 
                 private static void* __CopyValue(ClassTemplatePartialSpecialization.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(332);
+                    var ret = Marshal.AllocHGlobal(344);
                     global::CppSharp.Parser.AST.ClassTemplatePartialSpecialization.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -10869,7 +11761,7 @@ protected ClassTemplatePartialSpecialization(void* native, bool skipVTables = fa
                 public ClassTemplatePartialSpecialization()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(332);
+                    __Instance = Marshal.AllocHGlobal(344);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -10878,7 +11770,7 @@ public ClassTemplatePartialSpecialization()
                 public ClassTemplatePartialSpecialization(global::CppSharp.Parser.AST.ClassTemplatePartialSpecialization _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(332);
+                    __Instance = Marshal.AllocHGlobal(344);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -10900,7 +11792,7 @@ public override void Dispose(bool disposing)
 
             public unsafe partial class FunctionTemplate : global::CppSharp.Parser.AST.Template, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 156)]
+                [StructLayout(LayoutKind.Explicit, Size = 168)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -10963,6 +11855,9 @@ public new partial struct Internal
                     [FieldOffset(144)]
                     internal global::std.vector.Internal Specializations;
 
+                    [FieldOffset(156)]
+                    internal global::std.vector.Internal SpecializationIndex;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0FunctionTemplate@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -10997,6 +11892,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getSpecializationsCount@FunctionTemplate@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getSpecializationsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getSpecializationsData@FunctionTemplate@AST@CppParser@CppSharp@@QAEPAPAVFunctionTemplateSpecialization@234@XZ")]
+                    internal static extern global::System.IntPtr getSpecializationsData_0(global::System.IntPtr instance);
                 }
 
                 public static new FunctionTemplate __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -11011,7 +11911,7 @@ public static FunctionTemplate __CreateInstance(FunctionTemplate.Internal native
 
                 private static void* __CopyValue(FunctionTemplate.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(156);
+                    var ret = Marshal.AllocHGlobal(168);
                     global::CppSharp.Parser.AST.FunctionTemplate.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -11035,7 +11935,7 @@ protected FunctionTemplate(void* native, bool skipVTables = false)
                 public FunctionTemplate()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(156);
+                    __Instance = Marshal.AllocHGlobal(168);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -11044,7 +11944,7 @@ public FunctionTemplate()
                 public FunctionTemplate(global::CppSharp.Parser.AST.FunctionTemplate _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(156);
+                    __Instance = Marshal.AllocHGlobal(168);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -11095,6 +11995,15 @@ public uint SpecializationsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr SpecializationsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getSpecializationsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class FunctionTemplateSpecialization : IDisposable
@@ -11148,6 +12057,11 @@ public partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@FunctionTemplateSpecialization@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@FunctionTemplateSpecialization@AST@CppParser@CppSharp@@QAEPAUTemplateArgument@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public global::System.IntPtr __Instance { get; protected set; }
@@ -11252,6 +12166,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.FunctionTemplate Template
                 {
                     get
@@ -11401,6 +12324,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getSpecializationsCount@VarTemplate@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getSpecializationsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getSpecializationsData@VarTemplate@AST@CppParser@CppSharp@@QAEPAPAVVarTemplateSpecialization@234@XZ")]
+                    internal static extern global::System.IntPtr getSpecializationsData_0(global::System.IntPtr instance);
                 }
 
                 public static new VarTemplate __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -11499,6 +12427,15 @@ public uint SpecializationsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr SpecializationsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getSpecializationsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class VarTemplateSpecialization : global::CppSharp.Parser.AST.Variable, IDisposable
@@ -11606,6 +12543,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@VarTemplateSpecialization@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@VarTemplateSpecialization@AST@CppParser@CppSharp@@QAEPAUTemplateArgument@234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public static new VarTemplateSpecialization __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -11701,6 +12643,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public global::CppSharp.Parser.AST.VarTemplate TemplatedDecl
                 {
                     get
@@ -12561,7 +13512,7 @@ public string Text
 
             public unsafe partial class TranslationUnit : global::CppSharp.Parser.AST.Namespace, IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 292)]
+                [StructLayout(LayoutKind.Explicit, Size = 328)]
                 public new partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -12660,6 +13611,12 @@ public new partial struct Internal
                     [FieldOffset(280)]
                     internal global::std.vector.Internal Macros;
 
+                    [FieldOffset(292)]
+                    public global::std.basic_string.Internal ContentHash;
+
+                    [FieldOffset(316)]
+                    internal global::std.vector.Internal Includes;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0TranslationUnit@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -12690,6 +13647,26 @@ public new partial struct Internal
                         EntryPoint="?clearMacros@TranslationUnit@AST@CppParser@CppSharp@@QAEXXZ")]
                     internal static extern void clearMacros_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIncludes@TranslationUnit@AST@CppParser@CppSharp@@QAEPBDI@Z")]
+                    internal static extern global::System.IntPtr getIncludes_0(global::System.IntPtr instance, uint i);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?addIncludes@TranslationUnit@AST@CppParser@CppSharp@@QAEXPBD@Z")]
+                    internal static extern void addIncludes_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?clearIncludes@TranslationUnit@AST@CppParser@CppSharp@@QAEXXZ")]
+                    internal static extern void clearIncludes_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIncludesData@TranslationUnit@AST@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                    internal static extern void getIncludesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFileName@TranslationUnit@AST@CppParser@CppSharp@@QAEPBDXZ")]
@@ -12704,6 +13681,26 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getMacrosCount@TranslationUnit@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getMacrosCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getMacrosData@TranslationUnit@AST@CppParser@CppSharp@@QAEPAPAVMacroDefinition@234@XZ")]
+                    internal static extern global::System.IntPtr getMacrosData_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getContentHash@TranslationUnit@AST@CppParser@CppSharp@@QAEPBDXZ")]
+                    internal static extern global::System.IntPtr getContentHash_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?setContentHash@TranslationUnit@AST@CppParser@CppSharp@@QAEXPBD@Z")]
+                    internal static extern void setContentHash_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getIncludesCount@TranslationUnit@AST@CppParser@CppSharp@@QAEIXZ")]
+                    internal static extern uint getIncludesCount_0(global::System.IntPtr instance);
                 }
 
                 public static new TranslationUnit __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -12718,7 +13715,7 @@ public static TranslationUnit __CreateInstance(TranslationUnit.Internal native,
 
                 private static void* __CopyValue(TranslationUnit.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(292);
+                    var ret = Marshal.AllocHGlobal(328);
                     global::CppSharp.Parser.AST.TranslationUnit.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -12742,7 +13739,7 @@ protected TranslationUnit(void* native, bool skipVTables = false)
                 public TranslationUnit()
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(292);
+                    __Instance = Marshal.AllocHGlobal(328);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -12751,7 +13748,7 @@ public TranslationUnit()
                 public TranslationUnit(global::CppSharp.Parser.AST.TranslationUnit _0)
                     : this((void*) null)
                 {
-                    __Instance = Marshal.AllocHGlobal(292);
+                    __Instance = Marshal.AllocHGlobal(328);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -12794,6 +13791,28 @@ public void clearMacros()
                     Internal.clearMacros_0((__Instance + __PointerAdjustment));
                 }
 
+                public string getIncludes(uint i)
+                {
+                    var __ret = Internal.getIncludes_0((__Instance + __PointerAdjustment), i);
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
+                public void addIncludes(string s)
+                {
+                    var __arg0 = s;
+                    Internal.addIncludes_0((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void clearIncludes()
+                {
+                    Internal.clearIncludes_0((__Instance + __PointerAdjustment));
+                }
+
+                public void getIncludesData(global::System.IntPtr Strings)
+                {
+                    Internal.getIncludesData_0((__Instance + __PointerAdjustment), Strings);
+                }
+
                 public string FileName
                 {
                     get
@@ -12818,11 +13837,44 @@ public uint MacrosCount
                     }
                 }
 
-                public bool IsSystemHeader
+                public global::System.IntPtr MacrosData
                 {
                     get
                     {
-                        return ((Internal*) __Instance)->IsSystemHeader != 0;
+                        var __ret = Internal.getMacrosData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public string ContentHash
+                {
+                    get
+                    {
+                        var __ret = Internal.getContentHash_0((__Instance + __PointerAdjustment));
+                        return Marshal.PtrToStringAnsi(__ret);
+                    }
+
+                    set
+                    {
+                        var __arg0 = value;
+                        Internal.setContentHash_0((__Instance + __PointerAdjustment), __arg0);
+                    }
+                }
+
+                public uint IncludesCount
+                {
+                    get
+                    {
+                        var __ret = Internal.getIncludesCount_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public bool IsSystemHeader
+                {
+                    get
+                    {
+                        return ((Internal*) __Instance)->IsSystemHeader != 0;
                     }
 
                     set
@@ -12834,7 +13886,7 @@ public bool IsSystemHeader
 
             public unsafe partial class NativeLibrary : IDisposable
             {
-                [StructLayout(LayoutKind.Explicit, Size = 52)]
+                [StructLayout(LayoutKind.Explicit, Size = 68)]
                 public partial struct Internal
                 {
                     [FieldOffset(0)]
@@ -12849,6 +13901,12 @@ public partial struct Internal
                     [FieldOffset(40)]
                     internal global::std.vector.Internal Dependencies;
 
+                    [FieldOffset(52)]
+                    public global::System.IntPtr MappedSymbols;
+
+                    [FieldOffset(56)]
+                    internal global::std.vector.Internal SymbolIndex;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0NativeLibrary@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -12894,6 +13952,22 @@ public partial struct Internal
                         EntryPoint="?clearDependencies@NativeLibrary@AST@CppParser@CppSharp@@QAEXXZ")]
                     internal static extern void clearDependencies_0(global::System.IntPtr instance);
 
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getDependenciesData@NativeLibrary@AST@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                    internal static extern void getDependenciesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?HasSymbol@NativeLibrary@AST@CppParser@CppSharp@@QAE_NPBD@Z")]
+                    [return: MarshalAsAttribute(UnmanagedType.I1)]
+                    internal static extern bool HasSymbol_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string Symbol);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?GetSymbolVersion@NativeLibrary@AST@CppParser@CppSharp@@QAEPBDPBD@Z")]
+                    internal static extern global::System.IntPtr GetSymbolVersion_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string Symbol);
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getFileName@NativeLibrary@AST@CppParser@CppSharp@@QAEPBDXZ")]
@@ -12935,7 +14009,7 @@ public static NativeLibrary __CreateInstance(NativeLibrary.Internal native, bool
 
                 private static void* __CopyValue(NativeLibrary.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(52);
+                    var ret = Marshal.AllocHGlobal(68);
                     global::CppSharp.Parser.AST.NativeLibrary.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -12956,7 +14030,7 @@ protected NativeLibrary(void* native, bool skipVTables = false)
 
                 public NativeLibrary()
                 {
-                    __Instance = Marshal.AllocHGlobal(52);
+                    __Instance = Marshal.AllocHGlobal(68);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -12964,7 +14038,7 @@ public NativeLibrary()
 
                 public NativeLibrary(global::CppSharp.Parser.AST.NativeLibrary _0)
                 {
-                    __Instance = Marshal.AllocHGlobal(52);
+                    __Instance = Marshal.AllocHGlobal(68);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -13022,6 +14096,25 @@ public void clearDependencies()
                     Internal.clearDependencies_0((__Instance + __PointerAdjustment));
                 }
 
+                public void getDependenciesData(global::System.IntPtr Strings)
+                {
+                    Internal.getDependenciesData_0((__Instance + __PointerAdjustment), Strings);
+                }
+
+                public bool HasSymbol(string Symbol)
+                {
+                    var __arg0 = Symbol;
+                    var __ret = Internal.HasSymbol_0((__Instance + __PointerAdjustment), __arg0);
+                    return __ret;
+                }
+
+                public string GetSymbolVersion(string Symbol)
+                {
+                    var __arg0 = Symbol;
+                    var __ret = Internal.GetSymbolVersion_0((__Instance + __PointerAdjustment), __arg0);
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
                 public string FileName
                 {
                     get
@@ -13069,14 +14162,208 @@ public uint DependenciesCount
                 }
             }
 
-            public unsafe partial class ASTContext : IDisposable
+            public unsafe partial class SymbolContext : IDisposable
             {
                 [StructLayout(LayoutKind.Explicit, Size = 12)]
                 public partial struct Internal
+                {
+                    [FieldOffset(0)]
+                    internal global::std.vector.Internal Libraries;
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??0SymbolContext@AST@CppParser@CppSharp@@QAE@XZ")]
+                    internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??0SymbolContext@AST@CppParser@CppSharp@@QAE@ABV0123@@Z")]
+                    internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="??1SymbolContext@AST@CppParser@CppSharp@@QAE@XZ")]
+                    internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getLibraries@SymbolContext@AST@CppParser@CppSharp@@QAEPAVNativeLibrary@234@I@Z")]
+                    internal static extern global::System.IntPtr getLibraries_0(global::System.IntPtr instance, uint i);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?addLibraries@SymbolContext@AST@CppParser@CppSharp@@QAEXAAPAVNativeLibrary@234@@Z")]
+                    internal static extern void addLibraries_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?clearLibraries@SymbolContext@AST@CppParser@CppSharp@@QAEXXZ")]
+                    internal static extern void clearLibraries_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?FindLibraryBySymbol@SymbolContext@AST@CppParser@CppSharp@@QAEHPBD@Z")]
+                    internal static extern int FindLibraryBySymbol_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string Symbol);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?ResolveSymbols@SymbolContext@AST@CppParser@CppSharp@@QAEIPAPBDIPAHPAW4SymbolVariant@234@@Z")]
+                    internal static extern uint ResolveSymbols_0(global::System.IntPtr instance, sbyte** Symbols, uint Count, int* LibraryIndices, global::CppSharp.Parser.AST.SymbolVariant* Variants);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getLibrariesCount@SymbolContext@AST@CppParser@CppSharp@@QAEIXZ")]
+                    internal static extern uint getLibrariesCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getLibrariesData@SymbolContext@AST@CppParser@CppSharp@@QAEPAPAVNativeLibrary@234@XZ")]
+                    internal static extern global::System.IntPtr getLibrariesData_0(global::System.IntPtr instance);
+                }
+
+                public global::System.IntPtr __Instance { get; protected set; }
+
+                protected int __PointerAdjustment;
+                public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, SymbolContext> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, SymbolContext>();
+                protected void*[] __OriginalVTables;
+
+                protected bool __ownsNativeInstance;
+
+                public static SymbolContext __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+                {
+                    return new SymbolContext(native.ToPointer(), skipVTables);
+                }
+
+                public static SymbolContext __CreateInstance(SymbolContext.Internal native, bool skipVTables = false)
+                {
+                    return new SymbolContext(native, skipVTables);
+                }
+
+                private static void* __CopyValue(SymbolContext.Internal native)
+                {
+                    var ret = Marshal.AllocHGlobal(12);
+                    global::CppSharp.Parser.AST.SymbolContext.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                    return ret.ToPointer();
+                }
+
+                private SymbolContext(SymbolContext.Internal native, bool skipVTables = false)
+                    : this(__CopyValue(native), skipVTables)
+                {
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                }
+
+                protected SymbolContext(void* native, bool skipVTables = false)
+                {
+                    if (native == null)
+                        return;
+                    __Instance = new global::System.IntPtr(native);
+                }
+
+                public SymbolContext()
+                {
+                    __Instance = Marshal.AllocHGlobal(12);
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                    Internal.ctor_0((__Instance + __PointerAdjustment));
+                }
+
+                public SymbolContext(global::CppSharp.Parser.AST.SymbolContext _0)
+                {
+                    __Instance = Marshal.AllocHGlobal(12);
+                    __ownsNativeInstance = true;
+                    NativeToManagedMap[__Instance] = this;
+                    if (ReferenceEquals(_0, null))
+                        throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
+                    var __arg0 = _0.__Instance;
+                    Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void Dispose()
+                {
+                    Dispose(disposing: true);
+                }
+
+                public virtual void Dispose(bool disposing)
+                {
+                    global::CppSharp.Parser.AST.SymbolContext __dummy;
+                    NativeToManagedMap.TryRemove(__Instance, out __dummy);
+                    if (disposing)
+                        Internal.dtor_0((__Instance + __PointerAdjustment), 0);
+                    if (__ownsNativeInstance)
+                        Marshal.FreeHGlobal(__Instance);
+                }
+
+                public global::CppSharp.Parser.AST.NativeLibrary getLibraries(uint i)
+                {
+                    var __ret = Internal.getLibraries_0((__Instance + __PointerAdjustment), i);
+                    global::CppSharp.Parser.AST.NativeLibrary __result0;
+                    if (__ret == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(__ret))
+                        __result0 = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[__ret];
+                    else __result0 = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(__ret);
+                    return __result0;
+                }
+
+                public void addLibraries(global::CppSharp.Parser.AST.NativeLibrary s)
+                {
+                    if (ReferenceEquals(s, null))
+                        throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                    var __arg0 = s.__Instance;
+                    Internal.addLibraries_0((__Instance + __PointerAdjustment), __arg0);
+                }
+
+                public void clearLibraries()
+                {
+                    Internal.clearLibraries_0((__Instance + __PointerAdjustment));
+                }
+
+                public int FindLibraryBySymbol(string Symbol)
+                {
+                    var __arg0 = Symbol;
+                    var __ret = Internal.FindLibraryBySymbol_0((__Instance + __PointerAdjustment), __arg0);
+                    return __ret;
+                }
+
+                public uint ResolveSymbols(sbyte** Symbols, uint Count, int* LibraryIndices, global::CppSharp.Parser.AST.SymbolVariant* Variants)
+                {
+                    var __ret = Internal.ResolveSymbols_0((__Instance + __PointerAdjustment), Symbols, Count, LibraryIndices, Variants);
+                    return __ret;
+                }
+
+                public uint LibrariesCount
+                {
+                    get
+                    {
+                        var __ret = Internal.getLibrariesCount_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
+                public global::System.IntPtr LibrariesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getLibrariesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+            }
+
+            public unsafe partial class ASTContext : IDisposable
+            {
+                [StructLayout(LayoutKind.Explicit, Size = 28)]
+                public partial struct Internal
                 {
                     [FieldOffset(0)]
                     internal global::std.vector.Internal TranslationUnits;
 
+                    [FieldOffset(12)]
+                    internal global::std.vector.Internal StaleUnits;
+
+                    [FieldOffset(24)]
+                    public global::System.IntPtr Mutex;
+
                     [SuppressUnmanagedCodeSecurity]
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="??0ASTContext@AST@CppParser@CppSharp@@QAE@XZ")]
@@ -13111,6 +14398,11 @@ public partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getTranslationUnitsCount@ASTContext@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getTranslationUnitsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getTranslationUnitsData@ASTContext@AST@CppParser@CppSharp@@QAEPAPAVTranslationUnit@234@XZ")]
+                    internal static extern global::System.IntPtr getTranslationUnitsData_0(global::System.IntPtr instance);
                 }
 
                 public global::System.IntPtr __Instance { get; protected set; }
@@ -13133,7 +14425,7 @@ public static ASTContext __CreateInstance(ASTContext.Internal native, bool skipV
 
                 private static void* __CopyValue(ASTContext.Internal native)
                 {
-                    var ret = Marshal.AllocHGlobal(12);
+                    var ret = Marshal.AllocHGlobal(28);
                     global::CppSharp.Parser.AST.ASTContext.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                     return ret.ToPointer();
                 }
@@ -13154,7 +14446,7 @@ protected ASTContext(void* native, bool skipVTables = false)
 
                 public ASTContext()
                 {
-                    __Instance = Marshal.AllocHGlobal(12);
+                    __Instance = Marshal.AllocHGlobal(28);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     Internal.ctor_0((__Instance + __PointerAdjustment));
@@ -13162,7 +14454,7 @@ public ASTContext()
 
                 public ASTContext(global::CppSharp.Parser.AST.ASTContext _0)
                 {
-                    __Instance = Marshal.AllocHGlobal(12);
+                    __Instance = Marshal.AllocHGlobal(28);
                     __ownsNativeInstance = true;
                     NativeToManagedMap[__Instance] = this;
                     if (ReferenceEquals(_0, null))
@@ -13218,6 +14510,15 @@ public uint TranslationUnitsCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr TranslationUnitsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getTranslationUnitsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class Comment : IDisposable
@@ -13453,6 +14754,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getBlocksCount@FullComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getBlocksCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getBlocksData@FullComment@AST@CppParser@CppSharp@@QAEPAPAVBlockContentComment@234@XZ")]
+                    internal static extern global::System.IntPtr getBlocksData_0(global::System.IntPtr instance);
                 }
 
                 public static new FullComment __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -13551,6 +14857,15 @@ public uint BlocksCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr BlocksData
+                {
+                    get
+                    {
+                        var __ret = Internal.getBlocksData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class InlineContentComment : global::CppSharp.Parser.AST.Comment, IDisposable
@@ -13703,6 +15018,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getContentCount@ParagraphComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getContentCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getContentData@ParagraphComment@AST@CppParser@CppSharp@@QAEPAPAVInlineContentComment@234@XZ")]
+                    internal static extern global::System.IntPtr getContentData_0(global::System.IntPtr instance);
                 }
 
                 public static new ParagraphComment __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -13802,6 +15122,15 @@ public uint ContentCount
                     }
                 }
 
+                public global::System.IntPtr ContentData
+                {
+                    get
+                    {
+                        var __ret = Internal.getContentData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public bool IsWhitespace
                 {
                     get
@@ -13872,6 +15201,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@BlockCommandComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@BlockCommandComment@AST@CppParser@CppSharp@@QAEPAVArgument@1234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public unsafe partial class Argument : IDisposable
@@ -14100,6 +15434,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint CommandId
                 {
                     get
@@ -14323,6 +15666,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getPositionCount@TParamCommandComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getPositionCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getPositionData@TParamCommandComment@AST@CppParser@CppSharp@@QAEPAIXZ")]
+                    internal static extern uint* getPositionData_0(global::System.IntPtr instance);
                 }
 
                 public static new TParamCommandComment __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
@@ -14417,6 +15765,15 @@ public uint PositionCount
                         return __ret;
                     }
                 }
+
+                public uint* PositionData
+                {
+                    get
+                    {
+                        var __ret = Internal.getPositionData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class VerbatimBlockLineComment : global::CppSharp.Parser.AST.Comment, IDisposable
@@ -14590,7 +15947,12 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getLinesCount@VerbatimBlockComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getLinesCount_0(global::System.IntPtr instance);
-                }
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getLinesData@VerbatimBlockComment@AST@CppParser@CppSharp@@QAEPAPAVVerbatimBlockLineComment@234@XZ")]
+                    internal static extern global::System.IntPtr getLinesData_0(global::System.IntPtr instance);
+                }
 
                 public static new VerbatimBlockComment __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
                 {
@@ -14688,6 +16050,15 @@ public uint LinesCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr LinesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getLinesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class VerbatimLineComment : global::CppSharp.Parser.AST.BlockCommandComment, IDisposable
@@ -14870,6 +16241,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getArgumentsCount@InlineCommandComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getArgumentsData@InlineCommandComment@AST@CppParser@CppSharp@@QAEPAVArgument@1234@XZ")]
+                    internal static extern global::System.IntPtr getArgumentsData_0(global::System.IntPtr instance);
                 }
 
                 public enum RenderKind
@@ -15096,6 +16472,15 @@ public uint ArgumentsCount
                     }
                 }
 
+                public global::System.IntPtr ArgumentsData
+                {
+                    get
+                    {
+                        var __ret = Internal.getArgumentsData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
+
                 public uint CommandId
                 {
                     get
@@ -15273,6 +16658,11 @@ public new partial struct Internal
                     [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                         EntryPoint="?getAttributesCount@HTMLStartTagComment@AST@CppParser@CppSharp@@QAEIXZ")]
                     internal static extern uint getAttributesCount_0(global::System.IntPtr instance);
+
+                    [SuppressUnmanagedCodeSecurity]
+                    [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                        EntryPoint="?getAttributesData@HTMLStartTagComment@AST@CppParser@CppSharp@@QAEPAVAttribute@1234@XZ")]
+                    internal static extern global::System.IntPtr getAttributesData_0(global::System.IntPtr instance);
                 }
 
                 public unsafe partial class Attribute : IDisposable
@@ -15533,6 +16923,15 @@ public uint AttributesCount
                         return __ret;
                     }
                 }
+
+                public global::System.IntPtr AttributesData
+                {
+                    get
+                    {
+                        var __ret = Internal.getAttributesData_0((__Instance + __PointerAdjustment));
+                        return __ret;
+                    }
+                }
             }
 
             public unsafe partial class HTMLEndTagComment : global::CppSharp.Parser.AST.HTMLTagComment, IDisposable
@@ -16851,297 +18250,112 @@ public enum SourceLocationKind
             User = 4
         }
 
-        public unsafe partial class CppParserOptions : IDisposable
+        [SuppressUnmanagedCodeSecurity, UnmanagedFunctionPointerAttribute(global::System.Runtime.InteropServices.CallingConvention.Cdecl)]
+        public unsafe delegate void ParserDiagnosticHandler(global::System.IntPtr Diagnostic);
+
+        public unsafe partial class VirtualFile : IDisposable
         {
-            [StructLayout(LayoutKind.Explicit, Size = 156)]
+            [StructLayout(LayoutKind.Explicit, Size = 48)]
             public partial struct Internal
             {
                 [FieldOffset(0)]
-                internal global::std.vector.Internal Arguments;
-
-                [FieldOffset(12)]
-                public global::std.basic_string.Internal LibraryFile;
-
-                [FieldOffset(36)]
-                internal global::std.vector.Internal SourceFiles;
-
-                [FieldOffset(48)]
-                internal global::std.vector.Internal IncludeDirs;
-
-                [FieldOffset(60)]
-                internal global::std.vector.Internal SystemIncludeDirs;
-
-                [FieldOffset(72)]
-                internal global::std.vector.Internal Defines;
-
-                [FieldOffset(84)]
-                internal global::std.vector.Internal Undefines;
-
-                [FieldOffset(96)]
-                internal global::std.vector.Internal LibraryDirs;
-
-                [FieldOffset(108)]
-                public global::System.IntPtr ASTContext;
-
-                [FieldOffset(112)]
-                public int ToolSetToUse;
-
-                [FieldOffset(116)]
-                public global::std.basic_string.Internal TargetTriple;
-
-                [FieldOffset(140)]
-                public global::CppSharp.Parser.AST.CppAbi Abi;
-
-                [FieldOffset(144)]
-                public byte NoStandardIncludes;
-
-                [FieldOffset(145)]
-                public byte NoBuiltinIncludes;
-
-                [FieldOffset(146)]
-                public byte MicrosoftMode;
-
-                [FieldOffset(147)]
-                public byte Verbose;
-
-                [FieldOffset(148)]
-                public global::CppSharp.Parser.LanguageVersion LanguageVersion;
+                public global::std.basic_string.Internal FileName;
 
-                [FieldOffset(152)]
-                public global::System.IntPtr TargetInfo;
+                [FieldOffset(24)]
+                public global::std.basic_string.Internal Contents;
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0CppParserOptions@CppParser@CppSharp@@QAE@XZ")]
+                    EntryPoint="??0VirtualFile@CppParser@CppSharp@@QAE@XZ")]
                 internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0CppParserOptions@CppParser@CppSharp@@QAE@ABU012@@Z")]
-                internal static extern global::System.IntPtr cctor_2(global::System.IntPtr instance, global::System.IntPtr _0);
+                    EntryPoint="??0VirtualFile@CppParser@CppSharp@@QAE@ABU012@@Z")]
+                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??1CppParserOptions@CppParser@CppSharp@@QAE@XZ")]
+                    EntryPoint="??1VirtualFile@CppParser@CppSharp@@QAE@XZ")]
                 internal static extern void dtor_0(global::System.IntPtr instance, int delete);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getArguments@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getArguments_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addArguments@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addArguments_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearArguments@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearArguments_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getSourceFiles_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addSourceFiles_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearSourceFiles_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getIncludeDirs_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addIncludeDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearIncludeDirs_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getSystemIncludeDirs_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addSystemIncludeDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearSystemIncludeDirs_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getDefines@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getDefines_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addDefines@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addDefines_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearDefines@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearDefines_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getUndefines@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getUndefines_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addUndefines@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addUndefines_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearUndefines@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearUndefines_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
-                internal static extern global::System.IntPtr getLibraryDirs_0(global::System.IntPtr instance, uint i);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void addLibraryDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearLibraryDirs_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getArgumentsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getLibraryFile@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
-                internal static extern global::System.IntPtr getLibraryFile_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?setLibraryFile@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void setLibraryFile_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getSourceFilesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getSourceFilesCount_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getIncludeDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getIncludeDirsCount_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getSystemIncludeDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getSystemIncludeDirsCount_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getDefinesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getDefinesCount_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getUndefinesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getUndefinesCount_0(global::System.IntPtr instance);
+                    EntryPoint="?getFileName@VirtualFile@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getFileName_0(global::System.IntPtr instance);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getLibraryDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getLibraryDirsCount_0(global::System.IntPtr instance);
+                    EntryPoint="?setFileName@VirtualFile@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setFileName_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getTargetTriple@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
-                internal static extern global::System.IntPtr getTargetTriple_0(global::System.IntPtr instance);
+                    EntryPoint="?getContents@VirtualFile@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getContents_0(global::System.IntPtr instance);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?setTargetTriple@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void setTargetTriple_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+                    EntryPoint="?setContents@VirtualFile@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setContents_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
             }
 
             public global::System.IntPtr __Instance { get; protected set; }
 
             protected int __PointerAdjustment;
-            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, CppParserOptions> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, CppParserOptions>();
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, VirtualFile> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, VirtualFile>();
             protected void*[] __OriginalVTables;
 
             protected bool __ownsNativeInstance;
 
-            public static CppParserOptions __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+            public static VirtualFile __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
             {
-                return new CppParserOptions(native.ToPointer(), skipVTables);
+                return new VirtualFile(native.ToPointer(), skipVTables);
             }
 
-            public static CppParserOptions __CreateInstance(CppParserOptions.Internal native, bool skipVTables = false)
+            public static VirtualFile __CreateInstance(VirtualFile.Internal native, bool skipVTables = false)
             {
-                return new CppParserOptions(native, skipVTables);
+                return new VirtualFile(native, skipVTables);
             }
 
-            private static void* __CopyValue(CppParserOptions.Internal native)
+            private static void* __CopyValue(VirtualFile.Internal native)
             {
-                var ret = Marshal.AllocHGlobal(156);
-                global::CppSharp.Parser.CppParserOptions.Internal.cctor_2(ret, new global::System.IntPtr(&native));
+                var ret = Marshal.AllocHGlobal(48);
+                global::CppSharp.Parser.VirtualFile.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                 return ret.ToPointer();
             }
 
-            private CppParserOptions(CppParserOptions.Internal native, bool skipVTables = false)
+            private VirtualFile(VirtualFile.Internal native, bool skipVTables = false)
                 : this(__CopyValue(native), skipVTables)
             {
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
             }
 
-            protected CppParserOptions(void* native, bool skipVTables = false)
+            protected VirtualFile(void* native, bool skipVTables = false)
             {
                 if (native == null)
                     return;
                 __Instance = new global::System.IntPtr(native);
             }
 
-            public CppParserOptions()
+            public VirtualFile()
             {
-                __Instance = Marshal.AllocHGlobal(156);
+                __Instance = Marshal.AllocHGlobal(48);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
                 Internal.ctor_0((__Instance + __PointerAdjustment));
             }
 
-            public CppParserOptions(global::CppSharp.Parser.CppParserOptions _0)
+            public VirtualFile(global::CppSharp.Parser.VirtualFile _0)
             {
-                __Instance = Marshal.AllocHGlobal(156);
+                __Instance = Marshal.AllocHGlobal(48);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
                 if (ReferenceEquals(_0, null))
                     throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
                 var __arg0 = _0.__Instance;
-                Internal.cctor_2((__Instance + __PointerAdjustment), __arg0);
+                Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
             }
 
             public void Dispose()
@@ -17151,7 +18365,7 @@ public void Dispose()
 
             public virtual void Dispose(bool disposing)
             {
-                global::CppSharp.Parser.CppParserOptions __dummy;
+                global::CppSharp.Parser.VirtualFile __dummy;
                 NativeToManagedMap.TryRemove(__Instance, out __dummy);
                 if (disposing)
                     Internal.dtor_0((__Instance + __PointerAdjustment), 0);
@@ -17159,452 +18373,326 @@ public virtual void Dispose(bool disposing)
                     Marshal.FreeHGlobal(__Instance);
             }
 
-            public string getArguments(uint i)
+            public string FileName
             {
-                var __ret = Internal.getArguments_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
-            }
+                get
+                {
+                    var __ret = Internal.getFileName_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
 
-            public void addArguments(string s)
-            {
-                var __arg0 = s;
-                Internal.addArguments_0((__Instance + __PointerAdjustment), __arg0);
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setFileName_0((__Instance + __PointerAdjustment), __arg0);
+                }
             }
 
-            public void clearArguments()
+            public string Contents
             {
-                Internal.clearArguments_0((__Instance + __PointerAdjustment));
-            }
+                get
+                {
+                    var __ret = Internal.getContents_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
 
-            public string getSourceFiles(uint i)
-            {
-                var __ret = Internal.getSourceFiles_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setContents_0((__Instance + __PointerAdjustment), __arg0);
+                }
             }
+        }
 
-            public void addSourceFiles(string s)
+        public unsafe partial class ParserDiagnostic : IDisposable
+        {
+            [StructLayout(LayoutKind.Explicit, Size = 60)]
+            public partial struct Internal
             {
-                var __arg0 = s;
-                Internal.addSourceFiles_0((__Instance + __PointerAdjustment), __arg0);
-            }
+                [FieldOffset(0)]
+                public global::std.basic_string.Internal FileName;
 
-            public void clearSourceFiles()
-            {
-                Internal.clearSourceFiles_0((__Instance + __PointerAdjustment));
-            }
+                [FieldOffset(24)]
+                public global::std.basic_string.Internal Message;
 
-            public string getIncludeDirs(uint i)
-            {
-                var __ret = Internal.getIncludeDirs_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
-            }
+                [FieldOffset(48)]
+                public global::CppSharp.Parser.ParserDiagnosticLevel Level;
 
-            public void addIncludeDirs(string s)
-            {
-                var __arg0 = s;
-                Internal.addIncludeDirs_0((__Instance + __PointerAdjustment), __arg0);
-            }
+                [FieldOffset(52)]
+                public int LineNumber;
 
-            public void clearIncludeDirs()
-            {
-                Internal.clearIncludeDirs_0((__Instance + __PointerAdjustment));
-            }
+                [FieldOffset(56)]
+                public int ColumnNumber;
 
-            public string getSystemIncludeDirs(uint i)
-            {
-                var __ret = Internal.getSystemIncludeDirs_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
-            }
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0ParserDiagnostic@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
 
-            public void addSystemIncludeDirs(string s)
-            {
-                var __arg0 = s;
-                Internal.addSystemIncludeDirs_0((__Instance + __PointerAdjustment), __arg0);
-            }
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0ParserDiagnostic@CppParser@CppSharp@@QAE@ABU012@@Z")]
+                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
 
-            public void clearSystemIncludeDirs()
-            {
-                Internal.clearSystemIncludeDirs_0((__Instance + __PointerAdjustment));
-            }
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??1ParserDiagnostic@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern void dtor_0(global::System.IntPtr instance, int delete);
 
-            public string getDefines(uint i)
-            {
-                var __ret = Internal.getDefines_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getFileName@ParserDiagnostic@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getFileName_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setFileName@ParserDiagnostic@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setFileName_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getMessage@ParserDiagnostic@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getMessage_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setMessage@ParserDiagnostic@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setMessage_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
             }
 
-            public void addDefines(string s)
+            public global::System.IntPtr __Instance { get; protected set; }
+
+            protected int __PointerAdjustment;
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserDiagnostic> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserDiagnostic>();
+            protected void*[] __OriginalVTables;
+
+            protected bool __ownsNativeInstance;
+
+            public static ParserDiagnostic __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
             {
-                var __arg0 = s;
-                Internal.addDefines_0((__Instance + __PointerAdjustment), __arg0);
+                return new ParserDiagnostic(native.ToPointer(), skipVTables);
             }
 
-            public void clearDefines()
+            public static ParserDiagnostic __CreateInstance(ParserDiagnostic.Internal native, bool skipVTables = false)
             {
-                Internal.clearDefines_0((__Instance + __PointerAdjustment));
+                return new ParserDiagnostic(native, skipVTables);
             }
 
-            public string getUndefines(uint i)
+            private static void* __CopyValue(ParserDiagnostic.Internal native)
             {
-                var __ret = Internal.getUndefines_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
+                var ret = Marshal.AllocHGlobal(60);
+                global::CppSharp.Parser.ParserDiagnostic.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                return ret.ToPointer();
             }
 
-            public void addUndefines(string s)
+            private ParserDiagnostic(ParserDiagnostic.Internal native, bool skipVTables = false)
+                : this(__CopyValue(native), skipVTables)
             {
-                var __arg0 = s;
-                Internal.addUndefines_0((__Instance + __PointerAdjustment), __arg0);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
             }
 
-            public void clearUndefines()
+            protected ParserDiagnostic(void* native, bool skipVTables = false)
             {
-                Internal.clearUndefines_0((__Instance + __PointerAdjustment));
+                if (native == null)
+                    return;
+                __Instance = new global::System.IntPtr(native);
             }
 
-            public string getLibraryDirs(uint i)
+            public ParserDiagnostic()
             {
-                var __ret = Internal.getLibraryDirs_0((__Instance + __PointerAdjustment), i);
-                return Marshal.PtrToStringAnsi(__ret);
+                __Instance = Marshal.AllocHGlobal(60);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                Internal.ctor_0((__Instance + __PointerAdjustment));
             }
 
-            public void addLibraryDirs(string s)
+            public ParserDiagnostic(global::CppSharp.Parser.ParserDiagnostic _0)
             {
-                var __arg0 = s;
-                Internal.addLibraryDirs_0((__Instance + __PointerAdjustment), __arg0);
+                __Instance = Marshal.AllocHGlobal(60);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                if (ReferenceEquals(_0, null))
+                    throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = _0.__Instance;
+                Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
             }
 
-            public void clearLibraryDirs()
+            public void Dispose()
             {
-                Internal.clearLibraryDirs_0((__Instance + __PointerAdjustment));
+                Dispose(disposing: true);
             }
 
-            public uint ArgumentsCount
+            public virtual void Dispose(bool disposing)
             {
-                get
-                {
-                    var __ret = Internal.getArgumentsCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
-                }
+                global::CppSharp.Parser.ParserDiagnostic __dummy;
+                NativeToManagedMap.TryRemove(__Instance, out __dummy);
+                if (disposing)
+                    Internal.dtor_0((__Instance + __PointerAdjustment), 0);
+                if (__ownsNativeInstance)
+                    Marshal.FreeHGlobal(__Instance);
             }
 
-            public string LibraryFile
+            public string FileName
             {
                 get
                 {
-                    var __ret = Internal.getLibraryFile_0((__Instance + __PointerAdjustment));
+                    var __ret = Internal.getFileName_0((__Instance + __PointerAdjustment));
                     return Marshal.PtrToStringAnsi(__ret);
                 }
 
                 set
                 {
                     var __arg0 = value;
-                    Internal.setLibraryFile_0((__Instance + __PointerAdjustment), __arg0);
+                    Internal.setFileName_0((__Instance + __PointerAdjustment), __arg0);
                 }
             }
 
-            public uint SourceFilesCount
+            public string Message
             {
                 get
                 {
-                    var __ret = Internal.getSourceFilesCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    var __ret = Internal.getMessage_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
                 }
-            }
 
-            public uint IncludeDirsCount
-            {
-                get
+                set
                 {
-                    var __ret = Internal.getIncludeDirsCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    var __arg0 = value;
+                    Internal.setMessage_0((__Instance + __PointerAdjustment), __arg0);
                 }
             }
 
-            public uint SystemIncludeDirsCount
+            public global::CppSharp.Parser.ParserDiagnosticLevel Level
             {
                 get
                 {
-                    var __ret = Internal.getSystemIncludeDirsCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    return ((Internal*) __Instance)->Level;
                 }
-            }
 
-            public uint DefinesCount
-            {
-                get
+                set
                 {
-                    var __ret = Internal.getDefinesCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    ((Internal*) __Instance)->Level = value;
                 }
             }
 
-            public uint UndefinesCount
+            public int LineNumber
             {
                 get
                 {
-                    var __ret = Internal.getUndefinesCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    return ((Internal*) __Instance)->LineNumber;
                 }
-            }
 
-            public uint LibraryDirsCount
-            {
-                get
+                set
                 {
-                    var __ret = Internal.getLibraryDirsCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
+                    ((Internal*) __Instance)->LineNumber = value;
                 }
             }
 
-            public string TargetTriple
+            public int ColumnNumber
             {
                 get
                 {
-                    var __ret = Internal.getTargetTriple_0((__Instance + __PointerAdjustment));
-                    return Marshal.PtrToStringAnsi(__ret);
+                    return ((Internal*) __Instance)->ColumnNumber;
                 }
 
                 set
                 {
-                    var __arg0 = value;
-                    Internal.setTargetTriple_0((__Instance + __PointerAdjustment), __arg0);
+                    ((Internal*) __Instance)->ColumnNumber = value;
                 }
             }
+        }
 
-            public global::CppSharp.Parser.AST.ASTContext ASTContext
-            {
-                get
-                {
-                    global::CppSharp.Parser.AST.ASTContext __result0;
-                    if (((Internal*) __Instance)->ASTContext == IntPtr.Zero) __result0 = null;
-                    else if (global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->ASTContext))
-                        __result0 = (global::CppSharp.Parser.AST.ASTContext) global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap[((Internal*) __Instance)->ASTContext];
-                    else __result0 = global::CppSharp.Parser.AST.ASTContext.__CreateInstance(((Internal*) __Instance)->ASTContext);
-                    return __result0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->ASTContext = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
-                }
-            }
-
-            public int ToolSetToUse
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->ToolSetToUse;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->ToolSetToUse = value;
-                }
-            }
-
-            public global::CppSharp.Parser.AST.CppAbi Abi
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->Abi;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->Abi = value;
-                }
-            }
-
-            public bool NoStandardIncludes
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->NoStandardIncludes != 0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->NoStandardIncludes = (byte) (value ? 1 : 0);
-                }
-            }
-
-            public bool NoBuiltinIncludes
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->NoBuiltinIncludes != 0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->NoBuiltinIncludes = (byte) (value ? 1 : 0);
-                }
-            }
-
-            public bool MicrosoftMode
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->MicrosoftMode != 0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->MicrosoftMode = (byte) (value ? 1 : 0);
-                }
-            }
-
-            public bool Verbose
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->Verbose != 0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->Verbose = (byte) (value ? 1 : 0);
-                }
-            }
-
-            public global::CppSharp.Parser.LanguageVersion LanguageVersion
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->LanguageVersion;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->LanguageVersion = value;
-                }
-            }
-
-            public global::CppSharp.Parser.ParserTargetInfo TargetInfo
-            {
-                get
-                {
-                    global::CppSharp.Parser.ParserTargetInfo __result0;
-                    if (((Internal*) __Instance)->TargetInfo == IntPtr.Zero) __result0 = null;
-                    else if (global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->TargetInfo))
-                        __result0 = (global::CppSharp.Parser.ParserTargetInfo) global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap[((Internal*) __Instance)->TargetInfo];
-                    else __result0 = global::CppSharp.Parser.ParserTargetInfo.__CreateInstance(((Internal*) __Instance)->TargetInfo);
-                    return __result0;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->TargetInfo = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
-                }
-            }
-        }
-
-        public unsafe partial class ParserDiagnostic : IDisposable
-        {
-            [StructLayout(LayoutKind.Explicit, Size = 60)]
-            public partial struct Internal
+        public unsafe partial class ParserTarget : IDisposable
+        {
+            [StructLayout(LayoutKind.Explicit, Size = 32)]
+            public partial struct Internal
             {
                 [FieldOffset(0)]
-                public global::std.basic_string.Internal FileName;
+                public global::std.basic_string.Internal TargetTriple;
 
                 [FieldOffset(24)]
-                public global::std.basic_string.Internal Message;
-
-                [FieldOffset(48)]
-                public global::CppSharp.Parser.ParserDiagnosticLevel Level;
-
-                [FieldOffset(52)]
-                public int LineNumber;
+                public global::CppSharp.Parser.AST.CppAbi Abi;
 
-                [FieldOffset(56)]
-                public int ColumnNumber;
+                [FieldOffset(28)]
+                public byte MicrosoftMode;
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0ParserDiagnostic@CppParser@CppSharp@@QAE@XZ")]
+                    EntryPoint="??0ParserTarget@CppParser@CppSharp@@QAE@XZ")]
                 internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0ParserDiagnostic@CppParser@CppSharp@@QAE@ABU012@@Z")]
+                    EntryPoint="??0ParserTarget@CppParser@CppSharp@@QAE@ABU012@@Z")]
                 internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??1ParserDiagnostic@CppParser@CppSharp@@QAE@XZ")]
+                    EntryPoint="??1ParserTarget@CppParser@CppSharp@@QAE@XZ")]
                 internal static extern void dtor_0(global::System.IntPtr instance, int delete);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getFileName@ParserDiagnostic@CppParser@CppSharp@@QAEPBDXZ")]
-                internal static extern global::System.IntPtr getFileName_0(global::System.IntPtr instance);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?setFileName@ParserDiagnostic@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void setFileName_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
-
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getMessage@ParserDiagnostic@CppParser@CppSharp@@QAEPBDXZ")]
-                internal static extern global::System.IntPtr getMessage_0(global::System.IntPtr instance);
+                    EntryPoint="?getTargetTriple@ParserTarget@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getTargetTriple_0(global::System.IntPtr instance);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?setMessage@ParserDiagnostic@CppParser@CppSharp@@QAEXPBD@Z")]
-                internal static extern void setMessage_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+                    EntryPoint="?setTargetTriple@ParserTarget@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setTargetTriple_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
             }
 
             public global::System.IntPtr __Instance { get; protected set; }
 
             protected int __PointerAdjustment;
-            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserDiagnostic> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserDiagnostic>();
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserTarget> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserTarget>();
             protected void*[] __OriginalVTables;
 
             protected bool __ownsNativeInstance;
 
-            public static ParserDiagnostic __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+            public static ParserTarget __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
             {
-                return new ParserDiagnostic(native.ToPointer(), skipVTables);
+                return new ParserTarget(native.ToPointer(), skipVTables);
             }
 
-            public static ParserDiagnostic __CreateInstance(ParserDiagnostic.Internal native, bool skipVTables = false)
+            public static ParserTarget __CreateInstance(ParserTarget.Internal native, bool skipVTables = false)
             {
-                return new ParserDiagnostic(native, skipVTables);
+                return new ParserTarget(native, skipVTables);
             }
 
-            private static void* __CopyValue(ParserDiagnostic.Internal native)
+            private static void* __CopyValue(ParserTarget.Internal native)
             {
-                var ret = Marshal.AllocHGlobal(60);
-                global::CppSharp.Parser.ParserDiagnostic.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                var ret = Marshal.AllocHGlobal(32);
+                global::CppSharp.Parser.ParserTarget.Internal.cctor_1(ret, new global::System.IntPtr(&native));
                 return ret.ToPointer();
             }
 
-            private ParserDiagnostic(ParserDiagnostic.Internal native, bool skipVTables = false)
+            private ParserTarget(ParserTarget.Internal native, bool skipVTables = false)
                 : this(__CopyValue(native), skipVTables)
             {
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
             }
 
-            protected ParserDiagnostic(void* native, bool skipVTables = false)
+            protected ParserTarget(void* native, bool skipVTables = false)
             {
                 if (native == null)
                     return;
                 __Instance = new global::System.IntPtr(native);
             }
 
-            public ParserDiagnostic()
+            public ParserTarget()
             {
-                __Instance = Marshal.AllocHGlobal(60);
+                __Instance = Marshal.AllocHGlobal(32);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
                 Internal.ctor_0((__Instance + __PointerAdjustment));
             }
 
-            public ParserDiagnostic(global::CppSharp.Parser.ParserDiagnostic _0)
+            public ParserTarget(global::CppSharp.Parser.ParserTarget _0)
             {
-                __Instance = Marshal.AllocHGlobal(60);
+                __Instance = Marshal.AllocHGlobal(32);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
                 if (ReferenceEquals(_0, null))
@@ -17620,7 +18708,7 @@ public void Dispose()
 
             public virtual void Dispose(bool disposing)
             {
-                global::CppSharp.Parser.ParserDiagnostic __dummy;
+                global::CppSharp.Parser.ParserTarget __dummy;
                 NativeToManagedMap.TryRemove(__Instance, out __dummy);
                 if (disposing)
                     Internal.dtor_0((__Instance + __PointerAdjustment), 0);
@@ -17628,188 +18716,1704 @@ public virtual void Dispose(bool disposing)
                     Marshal.FreeHGlobal(__Instance);
             }
 
-            public string FileName
-            {
-                get
-                {
-                    var __ret = Internal.getFileName_0((__Instance + __PointerAdjustment));
-                    return Marshal.PtrToStringAnsi(__ret);
-                }
-
-                set
-                {
-                    var __arg0 = value;
-                    Internal.setFileName_0((__Instance + __PointerAdjustment), __arg0);
-                }
-            }
-
-            public string Message
+            public string TargetTriple
             {
                 get
                 {
-                    var __ret = Internal.getMessage_0((__Instance + __PointerAdjustment));
+                    var __ret = Internal.getTargetTriple_0((__Instance + __PointerAdjustment));
                     return Marshal.PtrToStringAnsi(__ret);
                 }
 
                 set
                 {
                     var __arg0 = value;
-                    Internal.setMessage_0((__Instance + __PointerAdjustment), __arg0);
-                }
-            }
-
-            public global::CppSharp.Parser.ParserDiagnosticLevel Level
-            {
-                get
-                {
-                    return ((Internal*) __Instance)->Level;
-                }
-
-                set
-                {
-                    ((Internal*) __Instance)->Level = value;
+                    Internal.setTargetTriple_0((__Instance + __PointerAdjustment), __arg0);
                 }
             }
 
-            public int LineNumber
+            public global::CppSharp.Parser.AST.CppAbi Abi
             {
                 get
                 {
-                    return ((Internal*) __Instance)->LineNumber;
+                    return ((Internal*) __Instance)->Abi;
                 }
 
                 set
                 {
-                    ((Internal*) __Instance)->LineNumber = value;
+                    ((Internal*) __Instance)->Abi = value;
                 }
             }
 
-            public int ColumnNumber
+            public bool MicrosoftMode
             {
                 get
                 {
-                    return ((Internal*) __Instance)->ColumnNumber;
+                    return ((Internal*) __Instance)->MicrosoftMode != 0;
                 }
 
                 set
                 {
-                    ((Internal*) __Instance)->ColumnNumber = value;
+                    ((Internal*) __Instance)->MicrosoftMode = (byte) (value ? 1 : 0);
                 }
             }
         }
 
-        public unsafe partial class ParserResult : IDisposable
+        public unsafe partial class CppParserOptions : IDisposable
         {
-            [StructLayout(LayoutKind.Explicit, Size = 28)]
+            [StructLayout(LayoutKind.Explicit, Size = 288)]
             public partial struct Internal
             {
                 [FieldOffset(0)]
-                public global::CppSharp.Parser.ParserResultKind Kind;
+                internal global::std.vector.Internal Arguments;
 
-                [FieldOffset(4)]
-                internal global::std.vector.Internal Diagnostics;
+                [FieldOffset(12)]
+                public global::std.basic_string.Internal LibraryFile;
 
-                [FieldOffset(16)]
-                public global::System.IntPtr ASTContext;
+                [FieldOffset(36)]
+                internal global::std.vector.Internal LibraryFiles;
 
-                [FieldOffset(20)]
-                public global::System.IntPtr Library;
+                [FieldOffset(48)]
+                internal global::std.vector.Internal SourceFiles;
 
-                [FieldOffset(24)]
-                public global::System.IntPtr CodeParser;
+                [FieldOffset(60)]
+                internal global::std.vector.Internal IncludeDirs;
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0ParserResult@CppParser@CppSharp@@QAE@XZ")]
-                internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
+                [FieldOffset(72)]
+                internal global::std.vector.Internal SystemIncludeDirs;
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0ParserResult@CppParser@CppSharp@@QAE@ABU012@@Z")]
-                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
+                [FieldOffset(84)]
+                internal global::std.vector.Internal Defines;
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??1ParserResult@CppParser@CppSharp@@QAE@XZ")]
-                internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+                [FieldOffset(96)]
+                internal global::std.vector.Internal Undefines;
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                [FieldOffset(108)]
+                internal global::std.vector.Internal LibraryDirs;
+
+                [FieldOffset(120)]
+                internal global::std.vector.Internal VirtualFiles;
+
+                [FieldOffset(132)]
+                public global::System.IntPtr ASTContext;
+
+                [FieldOffset(136)]
+                public int ToolSetToUse;
+
+                [FieldOffset(140)]
+                public global::std.basic_string.Internal TargetTriple;
+
+                [FieldOffset(164)]
+                public global::CppSharp.Parser.AST.CppAbi Abi;
+
+                [FieldOffset(168)]
+                internal global::std.vector.Internal Targets;
+
+                [FieldOffset(180)]
+                public byte NoStandardIncludes;
+
+                [FieldOffset(181)]
+                public byte NoBuiltinIncludes;
+
+                [FieldOffset(182)]
+                public byte MicrosoftMode;
+
+                [FieldOffset(183)]
+                public byte Verbose;
+
+                [FieldOffset(184)]
+                public global::CppSharp.Parser.LanguageVersion LanguageVersion;
+
+                [FieldOffset(188)]
+                public byte MappedSymbols;
+
+                [FieldOffset(189)]
+                public byte Incremental;
+
+                [FieldOffset(190)]
+                public byte Modules;
+
+                [FieldOffset(192)]
+                public global::std.basic_string.Internal ModuleCachePath;
+
+                [FieldOffset(216)]
+                internal global::std.vector.Internal ModuleMapFiles;
+
+                [FieldOffset(228)]
+                public byte PrecompiledPreamble;
+
+                [FieldOffset(229)]
+                public byte SkipFullComments;
+
+                [FieldOffset(230)]
+                public byte UserSpecializationsOnly;
+
+                [FieldOffset(232)]
+                public uint MaxSpecializations;
+
+                [FieldOffset(236)]
+                internal global::std.vector.Internal SpecializedTemplates;
+
+                [FieldOffset(248)]
+                public global::CppSharp.Parser.ParserDiagnosticLevel MinDiagnosticLevel;
+
+                [FieldOffset(252)]
+                public uint ErrorLimit;
+
+                [FieldOffset(256)]
+                public global::System.IntPtr DiagnosticHandler;
+
+                [FieldOffset(260)]
+                public global::System.IntPtr TargetInfo;
+
+                [FieldOffset(264)]
+                public global::std.basic_string.Internal ParserServerSocket;
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0CppParserOptions@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0CppParserOptions@CppParser@CppSharp@@QAE@ABU012@@Z")]
+                internal static extern global::System.IntPtr cctor_2(global::System.IntPtr instance, global::System.IntPtr _0);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??1CppParserOptions@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getArguments@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getArguments_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addArguments@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addArguments_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearArguments@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearArguments_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getArgumentsData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getArgumentsData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryFiles@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getLibraryFiles_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addLibraryFiles@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addLibraryFiles_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearLibraryFiles@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearLibraryFiles_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryFilesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getLibraryFilesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getSourceFiles_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addSourceFiles_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearSourceFiles@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearSourceFiles_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSourceFilesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getSourceFilesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getIncludeDirs_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addIncludeDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearIncludeDirs_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getIncludeDirsData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getIncludeDirsData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getSystemIncludeDirs_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addSystemIncludeDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearSystemIncludeDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearSystemIncludeDirs_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSystemIncludeDirsData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getSystemIncludeDirsData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getDefines@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getDefines_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addDefines@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addDefines_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearDefines@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearDefines_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getDefinesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getDefinesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getUndefines@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getUndefines_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addUndefines@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addUndefines_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearUndefines@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearUndefines_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getUndefinesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getUndefinesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getLibraryDirs_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addLibraryDirs_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearLibraryDirs@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearLibraryDirs_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryDirsData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getLibraryDirsData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getVirtualFiles@CppParserOptions@CppParser@CppSharp@@QAE?AUVirtualFile@23@I@Z")]
+                internal static extern void getVirtualFiles_0(global::System.IntPtr instance, global::System.IntPtr @return, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addVirtualFiles@CppParserOptions@CppParser@CppSharp@@QAEXAAUVirtualFile@23@@Z")]
+                internal static extern void addVirtualFiles_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearVirtualFiles@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearVirtualFiles_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getTargets@CppParserOptions@CppParser@CppSharp@@QAE?AUParserTarget@23@I@Z")]
+                internal static extern void getTargets_0(global::System.IntPtr instance, global::System.IntPtr @return, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addTargets@CppParserOptions@CppParser@CppSharp@@QAEXAAUParserTarget@23@@Z")]
+                internal static extern void addTargets_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearTargets@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearTargets_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getModuleMapFiles@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getModuleMapFiles_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addModuleMapFiles@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addModuleMapFiles_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearModuleMapFiles@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearModuleMapFiles_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getModuleMapFilesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getModuleMapFilesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSpecializedTemplates@CppParserOptions@CppParser@CppSharp@@QAEPBDI@Z")]
+                internal static extern global::System.IntPtr getSpecializedTemplates_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addSpecializedTemplates@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void addSpecializedTemplates_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearSpecializedTemplates@CppParserOptions@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearSpecializedTemplates_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSpecializedTemplatesData@CppParserOptions@CppParser@CppSharp@@QAEXPAPBD@Z")]
+                internal static extern void getSpecializedTemplatesData_0(global::System.IntPtr instance, global::System.IntPtr Strings);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getArgumentsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getArgumentsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryFile@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getLibraryFile_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setLibraryFile@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setLibraryFile_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryFilesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getLibraryFilesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSourceFilesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getSourceFilesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getIncludeDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getIncludeDirsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSystemIncludeDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getSystemIncludeDirsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getDefinesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getDefinesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getUndefinesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getUndefinesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraryDirsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getLibraryDirsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getVirtualFilesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getVirtualFilesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getVirtualFilesData@CppParserOptions@CppParser@CppSharp@@QAEPAUVirtualFile@23@XZ")]
+                internal static extern global::System.IntPtr getVirtualFilesData_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getTargetTriple@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getTargetTriple_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setTargetTriple@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setTargetTriple_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getTargetsCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getTargetsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getTargetsData@CppParserOptions@CppParser@CppSharp@@QAEPAUParserTarget@23@XZ")]
+                internal static extern global::System.IntPtr getTargetsData_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getModuleCachePath@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getModuleCachePath_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setModuleCachePath@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setModuleCachePath_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getModuleMapFilesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getModuleMapFilesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getSpecializedTemplatesCount@CppParserOptions@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getSpecializedTemplatesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getParserServerSocket@CppParserOptions@CppParser@CppSharp@@QAEPBDXZ")]
+                internal static extern global::System.IntPtr getParserServerSocket_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?setParserServerSocket@CppParserOptions@CppParser@CppSharp@@QAEXPBD@Z")]
+                internal static extern void setParserServerSocket_0(global::System.IntPtr instance, [MarshalAs(UnmanagedType.LPStr)] string s);
+            }
+
+            public global::System.IntPtr __Instance { get; protected set; }
+
+            protected int __PointerAdjustment;
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, CppParserOptions> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, CppParserOptions>();
+            protected void*[] __OriginalVTables;
+
+            protected bool __ownsNativeInstance;
+
+            public static CppParserOptions __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+            {
+                return new CppParserOptions(native.ToPointer(), skipVTables);
+            }
+
+            public static CppParserOptions __CreateInstance(CppParserOptions.Internal native, bool skipVTables = false)
+            {
+                return new CppParserOptions(native, skipVTables);
+            }
+
+            private static void* __CopyValue(CppParserOptions.Internal native)
+            {
+                var ret = Marshal.AllocHGlobal(288);
+                global::CppSharp.Parser.CppParserOptions.Internal.cctor_2(ret, new global::System.IntPtr(&native));
+                return ret.ToPointer();
+            }
+
+            private CppParserOptions(CppParserOptions.Internal native, bool skipVTables = false)
+                : this(__CopyValue(native), skipVTables)
+            {
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+            }
+
+            protected CppParserOptions(void* native, bool skipVTables = false)
+            {
+                if (native == null)
+                    return;
+                __Instance = new global::System.IntPtr(native);
+            }
+
+            public CppParserOptions()
+            {
+                __Instance = Marshal.AllocHGlobal(288);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                Internal.ctor_0((__Instance + __PointerAdjustment));
+            }
+
+            public CppParserOptions(global::CppSharp.Parser.CppParserOptions _0)
+            {
+                __Instance = Marshal.AllocHGlobal(288);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                if (ReferenceEquals(_0, null))
+                    throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = _0.__Instance;
+                Internal.cctor_2((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void Dispose()
+            {
+                Dispose(disposing: true);
+            }
+
+            public virtual void Dispose(bool disposing)
+            {
+                global::CppSharp.Parser.CppParserOptions __dummy;
+                NativeToManagedMap.TryRemove(__Instance, out __dummy);
+                if (disposing)
+                    Internal.dtor_0((__Instance + __PointerAdjustment), 0);
+                if (__ownsNativeInstance)
+                    Marshal.FreeHGlobal(__Instance);
+            }
+
+            public string getArguments(uint i)
+            {
+                var __ret = Internal.getArguments_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addArguments(string s)
+            {
+                var __arg0 = s;
+                Internal.addArguments_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearArguments()
+            {
+                Internal.clearArguments_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getArgumentsData(global::System.IntPtr Strings)
+            {
+                Internal.getArgumentsData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getLibraryFiles(uint i)
+            {
+                var __ret = Internal.getLibraryFiles_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addLibraryFiles(string s)
+            {
+                var __arg0 = s;
+                Internal.addLibraryFiles_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearLibraryFiles()
+            {
+                Internal.clearLibraryFiles_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getLibraryFilesData(global::System.IntPtr Strings)
+            {
+                Internal.getLibraryFilesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getSourceFiles(uint i)
+            {
+                var __ret = Internal.getSourceFiles_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addSourceFiles(string s)
+            {
+                var __arg0 = s;
+                Internal.addSourceFiles_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearSourceFiles()
+            {
+                Internal.clearSourceFiles_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getSourceFilesData(global::System.IntPtr Strings)
+            {
+                Internal.getSourceFilesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getIncludeDirs(uint i)
+            {
+                var __ret = Internal.getIncludeDirs_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addIncludeDirs(string s)
+            {
+                var __arg0 = s;
+                Internal.addIncludeDirs_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearIncludeDirs()
+            {
+                Internal.clearIncludeDirs_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getIncludeDirsData(global::System.IntPtr Strings)
+            {
+                Internal.getIncludeDirsData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getSystemIncludeDirs(uint i)
+            {
+                var __ret = Internal.getSystemIncludeDirs_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addSystemIncludeDirs(string s)
+            {
+                var __arg0 = s;
+                Internal.addSystemIncludeDirs_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearSystemIncludeDirs()
+            {
+                Internal.clearSystemIncludeDirs_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getSystemIncludeDirsData(global::System.IntPtr Strings)
+            {
+                Internal.getSystemIncludeDirsData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getDefines(uint i)
+            {
+                var __ret = Internal.getDefines_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addDefines(string s)
+            {
+                var __arg0 = s;
+                Internal.addDefines_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearDefines()
+            {
+                Internal.clearDefines_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getDefinesData(global::System.IntPtr Strings)
+            {
+                Internal.getDefinesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getUndefines(uint i)
+            {
+                var __ret = Internal.getUndefines_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addUndefines(string s)
+            {
+                var __arg0 = s;
+                Internal.addUndefines_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearUndefines()
+            {
+                Internal.clearUndefines_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getUndefinesData(global::System.IntPtr Strings)
+            {
+                Internal.getUndefinesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getLibraryDirs(uint i)
+            {
+                var __ret = Internal.getLibraryDirs_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addLibraryDirs(string s)
+            {
+                var __arg0 = s;
+                Internal.addLibraryDirs_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearLibraryDirs()
+            {
+                Internal.clearLibraryDirs_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getLibraryDirsData(global::System.IntPtr Strings)
+            {
+                Internal.getLibraryDirsData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public global::CppSharp.Parser.VirtualFile getVirtualFiles(uint i)
+            {
+                var __ret = new global::CppSharp.Parser.VirtualFile.Internal();
+                Internal.getVirtualFiles_0((__Instance + __PointerAdjustment), new IntPtr(&__ret), i);
+                return global::CppSharp.Parser.VirtualFile.__CreateInstance(__ret);
+            }
+
+            public void addVirtualFiles(global::CppSharp.Parser.VirtualFile s)
+            {
+                if (ReferenceEquals(s, null))
+                    throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = s.__Instance;
+                Internal.addVirtualFiles_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearVirtualFiles()
+            {
+                Internal.clearVirtualFiles_0((__Instance + __PointerAdjustment));
+            }
+
+            public global::CppSharp.Parser.ParserTarget getTargets(uint i)
+            {
+                var __ret = new global::CppSharp.Parser.ParserTarget.Internal();
+                Internal.getTargets_0((__Instance + __PointerAdjustment), new IntPtr(&__ret), i);
+                return global::CppSharp.Parser.ParserTarget.__CreateInstance(__ret);
+            }
+
+            public void addTargets(global::CppSharp.Parser.ParserTarget s)
+            {
+                if (ReferenceEquals(s, null))
+                    throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = s.__Instance;
+                Internal.addTargets_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearTargets()
+            {
+                Internal.clearTargets_0((__Instance + __PointerAdjustment));
+            }
+
+            public string getModuleMapFiles(uint i)
+            {
+                var __ret = Internal.getModuleMapFiles_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addModuleMapFiles(string s)
+            {
+                var __arg0 = s;
+                Internal.addModuleMapFiles_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearModuleMapFiles()
+            {
+                Internal.clearModuleMapFiles_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getModuleMapFilesData(global::System.IntPtr Strings)
+            {
+                Internal.getModuleMapFilesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public string getSpecializedTemplates(uint i)
+            {
+                var __ret = Internal.getSpecializedTemplates_0((__Instance + __PointerAdjustment), i);
+                return Marshal.PtrToStringAnsi(__ret);
+            }
+
+            public void addSpecializedTemplates(string s)
+            {
+                var __arg0 = s;
+                Internal.addSpecializedTemplates_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearSpecializedTemplates()
+            {
+                Internal.clearSpecializedTemplates_0((__Instance + __PointerAdjustment));
+            }
+
+            public void getSpecializedTemplatesData(global::System.IntPtr Strings)
+            {
+                Internal.getSpecializedTemplatesData_0((__Instance + __PointerAdjustment), Strings);
+            }
+
+            public uint ArgumentsCount
+            {
+                get
+                {
+                    var __ret = Internal.getArgumentsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public string LibraryFile
+            {
+                get
+                {
+                    var __ret = Internal.getLibraryFile_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setLibraryFile_0((__Instance + __PointerAdjustment), __arg0);
+                }
+            }
+
+            public uint LibraryFilesCount
+            {
+                get
+                {
+                    var __ret = Internal.getLibraryFilesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint SourceFilesCount
+            {
+                get
+                {
+                    var __ret = Internal.getSourceFilesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint IncludeDirsCount
+            {
+                get
+                {
+                    var __ret = Internal.getIncludeDirsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint SystemIncludeDirsCount
+            {
+                get
+                {
+                    var __ret = Internal.getSystemIncludeDirsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint DefinesCount
+            {
+                get
+                {
+                    var __ret = Internal.getDefinesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint UndefinesCount
+            {
+                get
+                {
+                    var __ret = Internal.getUndefinesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint LibraryDirsCount
+            {
+                get
+                {
+                    var __ret = Internal.getLibraryDirsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint VirtualFilesCount
+            {
+                get
+                {
+                    var __ret = Internal.getVirtualFilesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public global::System.IntPtr VirtualFilesData
+            {
+                get
+                {
+                    var __ret = Internal.getVirtualFilesData_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public string TargetTriple
+            {
+                get
+                {
+                    var __ret = Internal.getTargetTriple_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setTargetTriple_0((__Instance + __PointerAdjustment), __arg0);
+                }
+            }
+
+            public uint TargetsCount
+            {
+                get
+                {
+                    var __ret = Internal.getTargetsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public global::System.IntPtr TargetsData
+            {
+                get
+                {
+                    var __ret = Internal.getTargetsData_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public string ModuleCachePath
+            {
+                get
+                {
+                    var __ret = Internal.getModuleCachePath_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setModuleCachePath_0((__Instance + __PointerAdjustment), __arg0);
+                }
+            }
+
+            public uint ModuleMapFilesCount
+            {
+                get
+                {
+                    var __ret = Internal.getModuleMapFilesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint SpecializedTemplatesCount
+            {
+                get
+                {
+                    var __ret = Internal.getSpecializedTemplatesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public string ParserServerSocket
+            {
+                get
+                {
+                    var __ret = Internal.getParserServerSocket_0((__Instance + __PointerAdjustment));
+                    return Marshal.PtrToStringAnsi(__ret);
+                }
+
+                set
+                {
+                    var __arg0 = value;
+                    Internal.setParserServerSocket_0((__Instance + __PointerAdjustment), __arg0);
+                }
+            }
+
+            public global::CppSharp.Parser.AST.ASTContext ASTContext
+            {
+                get
+                {
+                    global::CppSharp.Parser.AST.ASTContext __result0;
+                    if (((Internal*) __Instance)->ASTContext == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->ASTContext))
+                        __result0 = (global::CppSharp.Parser.AST.ASTContext) global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap[((Internal*) __Instance)->ASTContext];
+                    else __result0 = global::CppSharp.Parser.AST.ASTContext.__CreateInstance(((Internal*) __Instance)->ASTContext);
+                    return __result0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->ASTContext = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
+                }
+            }
+
+            public int ToolSetToUse
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->ToolSetToUse;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->ToolSetToUse = value;
+                }
+            }
+
+            public global::CppSharp.Parser.AST.CppAbi Abi
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->Abi;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Abi = value;
+                }
+            }
+
+            public bool NoStandardIncludes
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->NoStandardIncludes != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->NoStandardIncludes = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool NoBuiltinIncludes
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->NoBuiltinIncludes != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->NoBuiltinIncludes = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool MicrosoftMode
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->MicrosoftMode != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->MicrosoftMode = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool Verbose
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->Verbose != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Verbose = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public global::CppSharp.Parser.LanguageVersion LanguageVersion
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->LanguageVersion;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->LanguageVersion = value;
+                }
+            }
+
+            public bool MappedSymbols
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->MappedSymbols != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->MappedSymbols = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool Incremental
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->Incremental != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Incremental = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool Modules
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->Modules != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Modules = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool PrecompiledPreamble
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->PrecompiledPreamble != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->PrecompiledPreamble = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool SkipFullComments
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->SkipFullComments != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->SkipFullComments = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public bool UserSpecializationsOnly
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->UserSpecializationsOnly != 0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->UserSpecializationsOnly = (byte) (value ? 1 : 0);
+                }
+            }
+
+            public uint MaxSpecializations
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->MaxSpecializations;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->MaxSpecializations = value;
+                }
+            }
+
+            public global::CppSharp.Parser.ParserDiagnosticLevel MinDiagnosticLevel
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->MinDiagnosticLevel;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->MinDiagnosticLevel = value;
+                }
+            }
+
+            public uint ErrorLimit
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->ErrorLimit;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->ErrorLimit = value;
+                }
+            }
+
+            public global::CppSharp.Parser.ParserDiagnosticHandler DiagnosticHandler
+            {
+                get
+                {
+                    var __ptr0 = ((Internal*) __Instance)->DiagnosticHandler;
+                    return (global::CppSharp.Parser.ParserDiagnosticHandler)Marshal.GetDelegateForFunctionPointer(__ptr0, typeof(global::CppSharp.Parser.ParserDiagnosticHandler));
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->DiagnosticHandler = value == null ? global::System.IntPtr.Zero : Marshal.GetFunctionPointerForDelegate(value);
+                }
+            }
+
+            public global::CppSharp.Parser.ParserTargetInfo TargetInfo
+            {
+                get
+                {
+                    global::CppSharp.Parser.ParserTargetInfo __result0;
+                    if (((Internal*) __Instance)->TargetInfo == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->TargetInfo))
+                        __result0 = (global::CppSharp.Parser.ParserTargetInfo) global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap[((Internal*) __Instance)->TargetInfo];
+                    else __result0 = global::CppSharp.Parser.ParserTargetInfo.__CreateInstance(((Internal*) __Instance)->TargetInfo);
+                    return __result0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->TargetInfo = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
+                }
+            }
+        }
+
+        public unsafe partial class ParserResult : IDisposable
+        {
+            [StructLayout(LayoutKind.Explicit, Size = 48)]
+            public partial struct Internal
+            {
+                [FieldOffset(0)]
+                public global::CppSharp.Parser.ParserResultKind Kind;
+
+                [FieldOffset(4)]
+                internal global::std.vector.Internal Diagnostics;
+
+                [FieldOffset(16)]
+                public global::System.IntPtr ASTContext;
+
+                [FieldOffset(20)]
+                public global::System.IntPtr Library;
+
+                [FieldOffset(24)]
+                internal global::std.vector.Internal Libraries;
+
+                [FieldOffset(36)]
+                public global::System.IntPtr CodeParser;
+
+                [FieldOffset(40)]
+                public uint CodeGenInfoLookups;
+
+                [FieldOffset(44)]
+                public uint CodeGenInfoCacheHits;
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0ParserResult@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern global::System.IntPtr ctor_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0ParserResult@CppParser@CppSharp@@QAE@ABU012@@Z")]
+                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??1ParserResult@CppParser@CppSharp@@QAE@XZ")]
+                internal static extern void dtor_0(global::System.IntPtr instance, int delete);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
                     EntryPoint="?getDiagnostics@ParserResult@CppParser@CppSharp@@QAE?AUParserDiagnostic@23@I@Z")]
                 internal static extern void getDiagnostics_0(global::System.IntPtr instance, global::System.IntPtr @return, uint i);
 
                 [SuppressUnmanagedCodeSecurity]
                 [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?addDiagnostics@ParserResult@CppParser@CppSharp@@QAEXAAUParserDiagnostic@23@@Z")]
-                internal static extern void addDiagnostics_0(global::System.IntPtr instance, global::System.IntPtr s);
+                    EntryPoint="?addDiagnostics@ParserResult@CppParser@CppSharp@@QAEXAAUParserDiagnostic@23@@Z")]
+                internal static extern void addDiagnostics_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearDiagnostics@ParserResult@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearDiagnostics_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibraries@ParserResult@CppParser@CppSharp@@QAEPAVNativeLibrary@AST@23@I@Z")]
+                internal static extern global::System.IntPtr getLibraries_0(global::System.IntPtr instance, uint i);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?addLibraries@ParserResult@CppParser@CppSharp@@QAEXAAPAVNativeLibrary@AST@23@@Z")]
+                internal static extern void addLibraries_0(global::System.IntPtr instance, global::System.IntPtr s);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?clearLibraries@ParserResult@CppParser@CppSharp@@QAEXXZ")]
+                internal static extern void clearLibraries_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getDiagnosticsCount@ParserResult@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getDiagnosticsCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getDiagnosticsData@ParserResult@CppParser@CppSharp@@QAEPAUParserDiagnostic@23@XZ")]
+                internal static extern global::System.IntPtr getDiagnosticsData_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibrariesCount@ParserResult@CppParser@CppSharp@@QAEIXZ")]
+                internal static extern uint getLibrariesCount_0(global::System.IntPtr instance);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="?getLibrariesData@ParserResult@CppParser@CppSharp@@QAEPAPAVNativeLibrary@AST@23@XZ")]
+                internal static extern global::System.IntPtr getLibrariesData_0(global::System.IntPtr instance);
+            }
+
+            public global::System.IntPtr __Instance { get; protected set; }
+
+            protected int __PointerAdjustment;
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserResult> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserResult>();
+            protected void*[] __OriginalVTables;
+
+            protected bool __ownsNativeInstance;
+
+            public static ParserResult __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+            {
+                return new ParserResult(native.ToPointer(), skipVTables);
+            }
+
+            public static ParserResult __CreateInstance(ParserResult.Internal native, bool skipVTables = false)
+            {
+                return new ParserResult(native, skipVTables);
+            }
+
+            private static void* __CopyValue(ParserResult.Internal native)
+            {
+                var ret = Marshal.AllocHGlobal(48);
+                global::CppSharp.Parser.ParserResult.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                return ret.ToPointer();
+            }
+
+            private ParserResult(ParserResult.Internal native, bool skipVTables = false)
+                : this(__CopyValue(native), skipVTables)
+            {
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+            }
+
+            protected ParserResult(void* native, bool skipVTables = false)
+            {
+                if (native == null)
+                    return;
+                __Instance = new global::System.IntPtr(native);
+            }
+
+            public ParserResult()
+            {
+                __Instance = Marshal.AllocHGlobal(48);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                Internal.ctor_0((__Instance + __PointerAdjustment));
+            }
+
+            public ParserResult(global::CppSharp.Parser.ParserResult _0)
+            {
+                __Instance = Marshal.AllocHGlobal(48);
+                __ownsNativeInstance = true;
+                NativeToManagedMap[__Instance] = this;
+                if (ReferenceEquals(_0, null))
+                    throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = _0.__Instance;
+                Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void Dispose()
+            {
+                Dispose(disposing: true);
+            }
+
+            public virtual void Dispose(bool disposing)
+            {
+                global::CppSharp.Parser.ParserResult __dummy;
+                NativeToManagedMap.TryRemove(__Instance, out __dummy);
+                if (disposing)
+                    Internal.dtor_0((__Instance + __PointerAdjustment), 0);
+                if (__ownsNativeInstance)
+                    Marshal.FreeHGlobal(__Instance);
+            }
+
+            public global::CppSharp.Parser.ParserDiagnostic getDiagnostics(uint i)
+            {
+                var __ret = new global::CppSharp.Parser.ParserDiagnostic.Internal();
+                Internal.getDiagnostics_0((__Instance + __PointerAdjustment), new IntPtr(&__ret), i);
+                return global::CppSharp.Parser.ParserDiagnostic.__CreateInstance(__ret);
+            }
+
+            public void addDiagnostics(global::CppSharp.Parser.ParserDiagnostic s)
+            {
+                if (ReferenceEquals(s, null))
+                    throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = s.__Instance;
+                Internal.addDiagnostics_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearDiagnostics()
+            {
+                Internal.clearDiagnostics_0((__Instance + __PointerAdjustment));
+            }
+
+            public global::CppSharp.Parser.AST.NativeLibrary getLibraries(uint i)
+            {
+                var __ret = Internal.getLibraries_0((__Instance + __PointerAdjustment), i);
+                global::CppSharp.Parser.AST.NativeLibrary __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(__ret);
+                return __result0;
+            }
+
+            public void addLibraries(global::CppSharp.Parser.AST.NativeLibrary s)
+            {
+                if (ReferenceEquals(s, null))
+                    throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
+                var __arg0 = s.__Instance;
+                Internal.addLibraries_0((__Instance + __PointerAdjustment), __arg0);
+            }
+
+            public void clearLibraries()
+            {
+                Internal.clearLibraries_0((__Instance + __PointerAdjustment));
+            }
+
+            public uint DiagnosticsCount
+            {
+                get
+                {
+                    var __ret = Internal.getDiagnosticsCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public global::System.IntPtr DiagnosticsData
+            {
+                get
+                {
+                    var __ret = Internal.getDiagnosticsData_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public uint LibrariesCount
+            {
+                get
+                {
+                    var __ret = Internal.getLibrariesCount_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public global::System.IntPtr LibrariesData
+            {
+                get
+                {
+                    var __ret = Internal.getLibrariesData_0((__Instance + __PointerAdjustment));
+                    return __ret;
+                }
+            }
+
+            public global::CppSharp.Parser.ParserResultKind Kind
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->Kind;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Kind = value;
+                }
+            }
+
+            public global::CppSharp.Parser.AST.ASTContext ASTContext
+            {
+                get
+                {
+                    global::CppSharp.Parser.AST.ASTContext __result0;
+                    if (((Internal*) __Instance)->ASTContext == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->ASTContext))
+                        __result0 = (global::CppSharp.Parser.AST.ASTContext) global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap[((Internal*) __Instance)->ASTContext];
+                    else __result0 = global::CppSharp.Parser.AST.ASTContext.__CreateInstance(((Internal*) __Instance)->ASTContext);
+                    return __result0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->ASTContext = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
+                }
+            }
+
+            public global::CppSharp.Parser.AST.NativeLibrary Library
+            {
+                get
+                {
+                    global::CppSharp.Parser.AST.NativeLibrary __result0;
+                    if (((Internal*) __Instance)->Library == IntPtr.Zero) __result0 = null;
+                    else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->Library))
+                        __result0 = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[((Internal*) __Instance)->Library];
+                    else __result0 = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(((Internal*) __Instance)->Library);
+                    return __result0;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->Library = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
+                }
+            }
+
+            public uint CodeGenInfoLookups
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->CodeGenInfoLookups;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->CodeGenInfoLookups = value;
+                }
+            }
+
+            public uint CodeGenInfoCacheHits
+            {
+                get
+                {
+                    return ((Internal*) __Instance)->CodeGenInfoCacheHits;
+                }
+
+                set
+                {
+                    ((Internal*) __Instance)->CodeGenInfoCacheHits = value;
+                }
+            }
+        }
+
+        public unsafe partial class ClangParser : IDisposable
+        {
+            [StructLayout(LayoutKind.Explicit, Size = 0)]
+            public partial struct Internal
+            {
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
+                    EntryPoint="??0ClangParser@CppParser@CppSharp@@QAE@ABV012@@Z")]
+                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
 
                 [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?clearDiagnostics@ParserResult@CppParser@CppSharp@@QAEXXZ")]
-                internal static extern void clearDiagnostics_0(global::System.IntPtr instance);
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
+                    EntryPoint="?ParseHeader@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
+                internal static extern global::System.IntPtr ParseHeader_0(global::System.IntPtr Opts);
 
                 [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="?getDiagnosticsCount@ParserResult@CppParser@CppSharp@@QAEIXZ")]
-                internal static extern uint getDiagnosticsCount_0(global::System.IntPtr instance);
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
+                    EntryPoint="?PrecompileHeader@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
+                internal static extern global::System.IntPtr PrecompileHeader_0(global::System.IntPtr Opts);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
+                    EntryPoint="?ParseLibrary@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
+                internal static extern global::System.IntPtr ParseLibrary_0(global::System.IntPtr Opts);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
+                    EntryPoint="?ParseLibraries@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
+                internal static extern global::System.IntPtr ParseLibraries_0(global::System.IntPtr Opts);
+
+                [SuppressUnmanagedCodeSecurity]
+                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
+                    EntryPoint="?GetTargetInfo@ClangParser@CppParser@CppSharp@@SAPAUParserTargetInfo@23@PAUCppParserOptions@23@@Z")]
+                internal static extern global::System.IntPtr GetTargetInfo_0(global::System.IntPtr Opts);
             }
 
             public global::System.IntPtr __Instance { get; protected set; }
 
             protected int __PointerAdjustment;
-            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserResult> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ParserResult>();
+            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ClangParser> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ClangParser>();
             protected void*[] __OriginalVTables;
 
             protected bool __ownsNativeInstance;
 
-            public static ParserResult __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+            public static ClangParser __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
             {
-                return new ParserResult(native.ToPointer(), skipVTables);
+                return new ClangParser(native.ToPointer(), skipVTables);
             }
 
-            public static ParserResult __CreateInstance(ParserResult.Internal native, bool skipVTables = false)
+            public static ClangParser __CreateInstance(ClangParser.Internal native, bool skipVTables = false)
             {
-                return new ParserResult(native, skipVTables);
+                return new ClangParser(native, skipVTables);
             }
 
-            private static void* __CopyValue(ParserResult.Internal native)
+            private static void* __CopyValue(ClangParser.Internal native)
             {
-                var ret = Marshal.AllocHGlobal(28);
-                global::CppSharp.Parser.ParserResult.Internal.cctor_1(ret, new global::System.IntPtr(&native));
+                var ret = Marshal.AllocHGlobal(0);
+                *(ClangParser.Internal*) ret = native;
                 return ret.ToPointer();
             }
 
-            private ParserResult(ParserResult.Internal native, bool skipVTables = false)
+            private ClangParser(ClangParser.Internal native, bool skipVTables = false)
                 : this(__CopyValue(native), skipVTables)
             {
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
             }
 
-            protected ParserResult(void* native, bool skipVTables = false)
+            protected ClangParser(void* native, bool skipVTables = false)
             {
                 if (native == null)
                     return;
                 __Instance = new global::System.IntPtr(native);
             }
 
-            public ParserResult()
+            public ClangParser()
             {
-                __Instance = Marshal.AllocHGlobal(28);
+                __Instance = Marshal.AllocHGlobal(0);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
-                Internal.ctor_0((__Instance + __PointerAdjustment));
             }
 
-            public ParserResult(global::CppSharp.Parser.ParserResult _0)
+            public ClangParser(global::CppSharp.Parser.ClangParser _0)
             {
-                __Instance = Marshal.AllocHGlobal(28);
+                __Instance = Marshal.AllocHGlobal(0);
                 __ownsNativeInstance = true;
                 NativeToManagedMap[__Instance] = this;
-                if (ReferenceEquals(_0, null))
-                    throw new global::System.ArgumentNullException("_0", "Cannot be null because it is a C++ reference (&).");
-                var __arg0 = _0.__Instance;
-                Internal.cctor_1((__Instance + __PointerAdjustment), __arg0);
+                *((ClangParser.Internal*) __Instance) = *((ClangParser.Internal*) _0.__Instance);
             }
 
             public void Dispose()
@@ -17819,221 +20423,935 @@ public void Dispose()
 
             public virtual void Dispose(bool disposing)
             {
-                global::CppSharp.Parser.ParserResult __dummy;
+                global::CppSharp.Parser.ClangParser __dummy;
                 NativeToManagedMap.TryRemove(__Instance, out __dummy);
-                if (disposing)
-                    Internal.dtor_0((__Instance + __PointerAdjustment), 0);
                 if (__ownsNativeInstance)
                     Marshal.FreeHGlobal(__Instance);
             }
 
-            public global::CppSharp.Parser.ParserDiagnostic getDiagnostics(uint i)
+            public static global::CppSharp.Parser.ParserResult ParseHeader(global::CppSharp.Parser.CppParserOptions Opts)
             {
-                var __ret = new global::CppSharp.Parser.ParserDiagnostic.Internal();
-                Internal.getDiagnostics_0((__Instance + __PointerAdjustment), new IntPtr(&__ret), i);
-                return global::CppSharp.Parser.ParserDiagnostic.__CreateInstance(__ret);
+                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
+                var __ret = Internal.ParseHeader_0(__arg0);
+                global::CppSharp.Parser.ParserResult __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
+                return __result0;
             }
 
-            public void addDiagnostics(global::CppSharp.Parser.ParserDiagnostic s)
+            public static global::CppSharp.Parser.ParserResult PrecompileHeader(global::CppSharp.Parser.CppParserOptions Opts)
             {
-                if (ReferenceEquals(s, null))
-                    throw new global::System.ArgumentNullException("s", "Cannot be null because it is a C++ reference (&).");
-                var __arg0 = s.__Instance;
-                Internal.addDiagnostics_0((__Instance + __PointerAdjustment), __arg0);
+                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
+                var __ret = Internal.PrecompileHeader_0(__arg0);
+                global::CppSharp.Parser.ParserResult __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
+                return __result0;
             }
 
-            public void clearDiagnostics()
+            public static global::CppSharp.Parser.ParserResult ParseLibrary(global::CppSharp.Parser.CppParserOptions Opts)
             {
-                Internal.clearDiagnostics_0((__Instance + __PointerAdjustment));
+                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
+                var __ret = Internal.ParseLibrary_0(__arg0);
+                global::CppSharp.Parser.ParserResult __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
+                return __result0;
             }
 
-            public uint DiagnosticsCount
+            public static global::CppSharp.Parser.ParserResult ParseLibraries(global::CppSharp.Parser.CppParserOptions Opts)
             {
-                get
-                {
-                    var __ret = Internal.getDiagnosticsCount_0((__Instance + __PointerAdjustment));
-                    return __ret;
-                }
+                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
+                var __ret = Internal.ParseLibraries_0(__arg0);
+                global::CppSharp.Parser.ParserResult __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
+                return __result0;
             }
 
-            public global::CppSharp.Parser.ParserResultKind Kind
+            public static global::CppSharp.Parser.ParserTargetInfo GetTargetInfo(global::CppSharp.Parser.CppParserOptions Opts)
             {
-                get
-                {
-                    return ((Internal*) __Instance)->Kind;
-                }
+                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
+                var __ret = Internal.GetTargetInfo_0(__arg0);
+                global::CppSharp.Parser.ParserTargetInfo __result0;
+                if (__ret == IntPtr.Zero) __result0 = null;
+                else if (global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap.ContainsKey(__ret))
+                    __result0 = (global::CppSharp.Parser.ParserTargetInfo) global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap[__ret];
+                else __result0 = global::CppSharp.Parser.ParserTargetInfo.__CreateInstance(__ret);
+                return __result0;
+            }
+        }
+    }
+}
 
-                set
-                {
-                    ((Internal*) __Instance)->Kind = value;
-                }
+namespace CppSharp.Parser.AST
+{
+    public unsafe partial class FunctionType
+    {
+        public global::CppSharp.Parser.AST.Parameter[] GetParametersArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Parameter[(int) ParametersCount];
+            var __data = (global::System.IntPtr*) ParametersData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Parameter.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Parameter) global::CppSharp.Parser.AST.Parameter.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Parameter.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public global::CppSharp.Parser.AST.ASTContext ASTContext
+    public unsafe partial class TemplateSpecializationType
+    {
+        public global::CppSharp.Parser.AST.TemplateArgument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TemplateArgument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.TemplateArgument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.TemplateArgument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class DependentTemplateSpecializationType
+    {
+        public global::CppSharp.Parser.AST.TemplateArgument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TemplateArgument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.TemplateArgument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.TemplateArgument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class VTableLayout
+    {
+        public global::CppSharp.Parser.AST.VTableComponent[] GetComponentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.VTableComponent[(int) ComponentsCount];
+            var __data = (byte*) ComponentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.VTableComponent.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.VTableComponent.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class ClassLayout
+    {
+        public global::CppSharp.Parser.AST.VFTableInfo[] GetVFTablesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.VFTableInfo[(int) VFTablesCount];
+            var __data = (byte*) VFTablesData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.VFTableInfo.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.VFTableInfo.Internal)));
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.LayoutField[] GetFieldsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.LayoutField[(int) FieldsCount];
+            var __data = (byte*) FieldsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.LayoutField.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.LayoutField.Internal)));
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.LayoutBase[] GetBasesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.LayoutBase[(int) BasesCount];
+            var __data = (byte*) BasesData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.LayoutBase.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.LayoutBase.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class Declaration
+    {
+        public global::CppSharp.Parser.AST.PreprocessedEntity[] GetPreprocessedEntitiesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.PreprocessedEntity[(int) PreprocessedEntitiesCount];
+            var __data = (global::System.IntPtr*) PreprocessedEntitiesData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                get
-                {
-                    global::CppSharp.Parser.AST.ASTContext __result0;
-                    if (((Internal*) __Instance)->ASTContext == IntPtr.Zero) __result0 = null;
-                    else if (global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->ASTContext))
-                        __result0 = (global::CppSharp.Parser.AST.ASTContext) global::CppSharp.Parser.AST.ASTContext.NativeToManagedMap[((Internal*) __Instance)->ASTContext];
-                    else __result0 = global::CppSharp.Parser.AST.ASTContext.__CreateInstance(((Internal*) __Instance)->ASTContext);
-                    return __result0;
-                }
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.PreprocessedEntity.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.PreprocessedEntity) global::CppSharp.Parser.AST.PreprocessedEntity.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.PreprocessedEntity.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+    }
 
-                set
-                {
-                    ((Internal*) __Instance)->ASTContext = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
-                }
+    public unsafe partial class DeclarationContext
+    {
+        public global::CppSharp.Parser.AST.Namespace[] GetNamespacesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Namespace[(int) NamespacesCount];
+            var __data = (global::System.IntPtr*) NamespacesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Namespace.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Namespace) global::CppSharp.Parser.AST.Namespace.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Namespace.__CreateInstance(__ret);
             }
+            return __result;
+        }
 
-            public global::CppSharp.Parser.AST.NativeLibrary Library
+        public global::CppSharp.Parser.AST.Enumeration[] GetEnumsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Enumeration[(int) EnumsCount];
+            var __data = (global::System.IntPtr*) EnumsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                get
-                {
-                    global::CppSharp.Parser.AST.NativeLibrary __result0;
-                    if (((Internal*) __Instance)->Library == IntPtr.Zero) __result0 = null;
-                    else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(((Internal*) __Instance)->Library))
-                        __result0 = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[((Internal*) __Instance)->Library];
-                    else __result0 = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(((Internal*) __Instance)->Library);
-                    return __result0;
-                }
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Enumeration.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Enumeration) global::CppSharp.Parser.AST.Enumeration.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Enumeration.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.Function[] GetFunctionsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Function[(int) FunctionsCount];
+            var __data = (global::System.IntPtr*) FunctionsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Function.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Function) global::CppSharp.Parser.AST.Function.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Function.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.Class[] GetClassesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Class[(int) ClassesCount];
+            var __data = (global::System.IntPtr*) ClassesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Class.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Class) global::CppSharp.Parser.AST.Class.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Class.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.Template[] GetTemplatesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Template[(int) TemplatesCount];
+            var __data = (global::System.IntPtr*) TemplatesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Template.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Template) global::CppSharp.Parser.AST.Template.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Template.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.TypedefDecl[] GetTypedefsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TypedefDecl[(int) TypedefsCount];
+            var __data = (global::System.IntPtr*) TypedefsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.TypedefDecl.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.TypedefDecl) global::CppSharp.Parser.AST.TypedefDecl.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.TypedefDecl.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.TypeAlias[] GetTypeAliasesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TypeAlias[(int) TypeAliasesCount];
+            var __data = (global::System.IntPtr*) TypeAliasesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.TypeAlias.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.TypeAlias) global::CppSharp.Parser.AST.TypeAlias.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.TypeAlias.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.Variable[] GetVariablesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Variable[(int) VariablesCount];
+            var __data = (global::System.IntPtr*) VariablesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Variable.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Variable) global::CppSharp.Parser.AST.Variable.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Variable.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.Friend[] GetFriendsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Friend[(int) FriendsCount];
+            var __data = (global::System.IntPtr*) FriendsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Friend.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Friend) global::CppSharp.Parser.AST.Friend.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Friend.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+    }
+
+    public unsafe partial class CallExpr
+    {
+        public global::CppSharp.Parser.AST.Expression[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Expression[(int) ArgumentsCount];
+            var __data = (global::System.IntPtr*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Expression.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Expression) global::CppSharp.Parser.AST.Expression.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Expression.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+    }
 
-                set
-                {
-                    ((Internal*) __Instance)->Library = ReferenceEquals(value, null) ? global::System.IntPtr.Zero : value.__Instance;
-                }
+    public unsafe partial class CXXConstructExpr
+    {
+        public global::CppSharp.Parser.AST.Expression[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Expression[(int) ArgumentsCount];
+            var __data = (global::System.IntPtr*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Expression.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Expression) global::CppSharp.Parser.AST.Expression.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Expression.__CreateInstance(__ret);
             }
+            return __result;
         }
+    }
 
-        public unsafe partial class ClangParser : IDisposable
+    public unsafe partial class FunctionTargetLayout
+    {
+        public uint[] GetIndirectParametersArray()
         {
-            [StructLayout(LayoutKind.Explicit, Size = 0)]
-            public partial struct Internal
+            var __result = new uint[(int) IndirectParametersCount];
+            var __data = IndirectParametersData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = __data[i];
+            return __result;
+        }
+    }
+
+    public unsafe partial class Function
+    {
+        public global::CppSharp.Parser.AST.Parameter[] GetParametersArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Parameter[(int) ParametersCount];
+            var __data = (global::System.IntPtr*) ParametersData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.ThisCall,
-                    EntryPoint="??0ClangParser@CppParser@CppSharp@@QAE@ABV012@@Z")]
-                internal static extern global::System.IntPtr cctor_1(global::System.IntPtr instance, global::System.IntPtr _0);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Parameter.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Parameter) global::CppSharp.Parser.AST.Parameter.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Parameter.__CreateInstance(__ret);
+            }
+            return __result;
+        }
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
-                    EntryPoint="?ParseHeader@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
-                internal static extern global::System.IntPtr ParseHeader_0(global::System.IntPtr Opts);
+        public global::CppSharp.Parser.AST.FunctionTargetLayout[] GetTargetLayoutsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.FunctionTargetLayout[(int) TargetLayoutsCount];
+            var __data = (byte*) TargetLayoutsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.FunctionTargetLayout.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.FunctionTargetLayout.Internal)));
+            return __result;
+        }
+    }
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
-                    EntryPoint="?ParseLibrary@ClangParser@CppParser@CppSharp@@SAPAUParserResult@23@PAUCppParserOptions@23@@Z")]
-                internal static extern global::System.IntPtr ParseLibrary_0(global::System.IntPtr Opts);
+    public unsafe partial class Enumeration
+    {
+        public global::CppSharp.Parser.AST.Enumeration.Item[] GetItemsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Enumeration.Item[(int) ItemsCount];
+            var __data = (global::System.IntPtr*) ItemsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Enumeration.Item.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Enumeration.Item) global::CppSharp.Parser.AST.Enumeration.Item.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Enumeration.Item.__CreateInstance(__ret);
+            }
+            return __result;
+        }
+    }
 
-                [SuppressUnmanagedCodeSecurity]
-                [DllImport("CppSharp.CppParser.dll", CallingConvention = global::System.Runtime.InteropServices.CallingConvention.Cdecl,
-                    EntryPoint="?GetTargetInfo@ClangParser@CppParser@CppSharp@@SAPAUParserTargetInfo@23@PAUCppParserOptions@23@@Z")]
-                internal static extern global::System.IntPtr GetTargetInfo_0(global::System.IntPtr Opts);
+    public unsafe partial class Class
+    {
+        public global::CppSharp.Parser.AST.BaseClassSpecifier[] GetBasesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.BaseClassSpecifier[(int) BasesCount];
+            var __data = (global::System.IntPtr*) BasesData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.BaseClassSpecifier.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.BaseClassSpecifier) global::CppSharp.Parser.AST.BaseClassSpecifier.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.BaseClassSpecifier.__CreateInstance(__ret);
             }
+            return __result;
+        }
 
-            public global::System.IntPtr __Instance { get; protected set; }
+        public global::CppSharp.Parser.AST.Field[] GetFieldsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Field[(int) FieldsCount];
+            var __data = (global::System.IntPtr*) FieldsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Field.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Field) global::CppSharp.Parser.AST.Field.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Field.__CreateInstance(__ret);
+            }
+            return __result;
+        }
 
-            protected int __PointerAdjustment;
-            public static readonly System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ClangParser> NativeToManagedMap = new System.Collections.Concurrent.ConcurrentDictionary<IntPtr, ClangParser>();
-            protected void*[] __OriginalVTables;
+        public global::CppSharp.Parser.AST.Method[] GetMethodsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Method[(int) MethodsCount];
+            var __data = (global::System.IntPtr*) MethodsData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Method.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Method) global::CppSharp.Parser.AST.Method.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Method.__CreateInstance(__ret);
+            }
+            return __result;
+        }
 
-            protected bool __ownsNativeInstance;
+        public global::CppSharp.Parser.AST.AccessSpecifierDecl[] GetSpecifiersArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.AccessSpecifierDecl[(int) SpecifiersCount];
+            var __data = (global::System.IntPtr*) SpecifiersData;
+            for (var i = 0; i < __result.Length; i++)
+            {
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.AccessSpecifierDecl.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.AccessSpecifierDecl) global::CppSharp.Parser.AST.AccessSpecifierDecl.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.AccessSpecifierDecl.__CreateInstance(__ret);
+            }
+            return __result;
+        }
 
-            public static ClangParser __CreateInstance(global::System.IntPtr native, bool skipVTables = false)
+        public global::CppSharp.Parser.AST.ClassLayout[] GetTargetLayoutsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.ClassLayout[(int) TargetLayoutsCount];
+            var __data = (global::System.IntPtr*) TargetLayoutsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                return new ClangParser(native.ToPointer(), skipVTables);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.ClassLayout.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.ClassLayout) global::CppSharp.Parser.AST.ClassLayout.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.ClassLayout.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public static ClangParser __CreateInstance(ClangParser.Internal native, bool skipVTables = false)
+    public unsafe partial class Template
+    {
+        public global::CppSharp.Parser.AST.Declaration[] GetParametersArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.Declaration[(int) ParametersCount];
+            var __data = (global::System.IntPtr*) ParametersData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                return new ClangParser(native, skipVTables);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.Declaration.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.Declaration) global::CppSharp.Parser.AST.Declaration.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.Declaration.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            private static void* __CopyValue(ClangParser.Internal native)
+    public unsafe partial class ClassTemplate
+    {
+        public global::CppSharp.Parser.AST.ClassTemplateSpecialization[] GetSpecializationsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.ClassTemplateSpecialization[(int) SpecializationsCount];
+            var __data = (global::System.IntPtr*) SpecializationsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                var ret = Marshal.AllocHGlobal(0);
-                *(ClangParser.Internal*) ret = native;
-                return ret.ToPointer();
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.ClassTemplateSpecialization.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.ClassTemplateSpecialization) global::CppSharp.Parser.AST.ClassTemplateSpecialization.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.ClassTemplateSpecialization.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            private ClangParser(ClangParser.Internal native, bool skipVTables = false)
-                : this(__CopyValue(native), skipVTables)
+    public unsafe partial class ClassTemplateSpecialization
+    {
+        public global::CppSharp.Parser.AST.TemplateArgument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TemplateArgument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.TemplateArgument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.TemplateArgument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class FunctionTemplate
+    {
+        public global::CppSharp.Parser.AST.FunctionTemplateSpecialization[] GetSpecializationsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.FunctionTemplateSpecialization[(int) SpecializationsCount];
+            var __data = (global::System.IntPtr*) SpecializationsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                __ownsNativeInstance = true;
-                NativeToManagedMap[__Instance] = this;
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.FunctionTemplateSpecialization.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.FunctionTemplateSpecialization) global::CppSharp.Parser.AST.FunctionTemplateSpecialization.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.FunctionTemplateSpecialization.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            protected ClangParser(void* native, bool skipVTables = false)
+    public unsafe partial class FunctionTemplateSpecialization
+    {
+        public global::CppSharp.Parser.AST.TemplateArgument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TemplateArgument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.TemplateArgument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.TemplateArgument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class VarTemplate
+    {
+        public global::CppSharp.Parser.AST.VarTemplateSpecialization[] GetSpecializationsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.VarTemplateSpecialization[(int) SpecializationsCount];
+            var __data = (global::System.IntPtr*) SpecializationsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                if (native == null)
-                    return;
-                __Instance = new global::System.IntPtr(native);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.VarTemplateSpecialization.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.VarTemplateSpecialization) global::CppSharp.Parser.AST.VarTemplateSpecialization.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.VarTemplateSpecialization.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public ClangParser()
+    public unsafe partial class VarTemplateSpecialization
+    {
+        public global::CppSharp.Parser.AST.TemplateArgument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TemplateArgument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.TemplateArgument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.TemplateArgument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class TranslationUnit
+    {
+        public global::CppSharp.Parser.AST.MacroDefinition[] GetMacrosArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.MacroDefinition[(int) MacrosCount];
+            var __data = (global::System.IntPtr*) MacrosData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                __Instance = Marshal.AllocHGlobal(0);
-                __ownsNativeInstance = true;
-                NativeToManagedMap[__Instance] = this;
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.MacroDefinition.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.MacroDefinition) global::CppSharp.Parser.AST.MacroDefinition.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.MacroDefinition.__CreateInstance(__ret);
             }
+            return __result;
+        }
 
-            public ClangParser(global::CppSharp.Parser.ClangParser _0)
+        public string[] GetIncludesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) IncludesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getIncludesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+    }
+
+    public unsafe partial class NativeLibrary
+    {
+        public string[] GetDependenciesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) DependenciesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getDependenciesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+    }
+
+    public unsafe partial class SymbolContext
+    {
+        public global::CppSharp.Parser.AST.NativeLibrary[] GetLibrariesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.NativeLibrary[(int) LibrariesCount];
+            var __data = (global::System.IntPtr*) LibrariesData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                __Instance = Marshal.AllocHGlobal(0);
-                __ownsNativeInstance = true;
-                NativeToManagedMap[__Instance] = this;
-                *((ClangParser.Internal*) __Instance) = *((ClangParser.Internal*) _0.__Instance);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public void Dispose()
+    public unsafe partial class ASTContext
+    {
+        public global::CppSharp.Parser.AST.TranslationUnit[] GetTranslationUnitsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.TranslationUnit[(int) TranslationUnitsCount];
+            var __data = (global::System.IntPtr*) TranslationUnitsData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                Dispose(disposing: true);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.TranslationUnit.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.TranslationUnit) global::CppSharp.Parser.AST.TranslationUnit.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.TranslationUnit.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public virtual void Dispose(bool disposing)
+    public unsafe partial class FullComment
+    {
+        public global::CppSharp.Parser.AST.BlockContentComment[] GetBlocksArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.BlockContentComment[(int) BlocksCount];
+            var __data = (global::System.IntPtr*) BlocksData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                global::CppSharp.Parser.ClangParser __dummy;
-                NativeToManagedMap.TryRemove(__Instance, out __dummy);
-                if (__ownsNativeInstance)
-                    Marshal.FreeHGlobal(__Instance);
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.BlockContentComment.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.BlockContentComment) global::CppSharp.Parser.AST.BlockContentComment.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.BlockContentComment.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public static global::CppSharp.Parser.ParserResult ParseHeader(global::CppSharp.Parser.CppParserOptions Opts)
+    public unsafe partial class ParagraphComment
+    {
+        public global::CppSharp.Parser.AST.InlineContentComment[] GetContentArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.InlineContentComment[(int) ContentCount];
+            var __data = (global::System.IntPtr*) ContentData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
-                var __ret = Internal.ParseHeader_0(__arg0);
-                global::CppSharp.Parser.ParserResult __result0;
-                if (__ret == IntPtr.Zero) __result0 = null;
-                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
-                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
-                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
-                return __result0;
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.InlineContentComment.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.InlineContentComment) global::CppSharp.Parser.AST.InlineContentComment.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.InlineContentComment.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public static global::CppSharp.Parser.ParserResult ParseLibrary(global::CppSharp.Parser.CppParserOptions Opts)
+    public unsafe partial class BlockCommandComment
+    {
+        public global::CppSharp.Parser.AST.BlockCommandComment.Argument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.BlockCommandComment.Argument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.BlockCommandComment.Argument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.BlockCommandComment.Argument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class TParamCommandComment
+    {
+        public uint[] GetPositionArray()
+        {
+            var __result = new uint[(int) PositionCount];
+            var __data = PositionData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = __data[i];
+            return __result;
+        }
+    }
+
+    public unsafe partial class VerbatimBlockComment
+    {
+        public global::CppSharp.Parser.AST.VerbatimBlockLineComment[] GetLinesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.VerbatimBlockLineComment[(int) LinesCount];
+            var __data = (global::System.IntPtr*) LinesData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
-                var __ret = Internal.ParseLibrary_0(__arg0);
-                global::CppSharp.Parser.ParserResult __result0;
-                if (__ret == IntPtr.Zero) __result0 = null;
-                else if (global::CppSharp.Parser.ParserResult.NativeToManagedMap.ContainsKey(__ret))
-                    __result0 = (global::CppSharp.Parser.ParserResult) global::CppSharp.Parser.ParserResult.NativeToManagedMap[__ret];
-                else __result0 = global::CppSharp.Parser.ParserResult.__CreateInstance(__ret);
-                return __result0;
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.VerbatimBlockLineComment.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.VerbatimBlockLineComment) global::CppSharp.Parser.AST.VerbatimBlockLineComment.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.VerbatimBlockLineComment.__CreateInstance(__ret);
             }
+            return __result;
+        }
+    }
 
-            public static global::CppSharp.Parser.ParserTargetInfo GetTargetInfo(global::CppSharp.Parser.CppParserOptions Opts)
+    public unsafe partial class InlineCommandComment
+    {
+        public global::CppSharp.Parser.AST.InlineCommandComment.Argument[] GetArgumentsArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.InlineCommandComment.Argument[(int) ArgumentsCount];
+            var __data = (byte*) ArgumentsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.InlineCommandComment.Argument.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.InlineCommandComment.Argument.Internal)));
+            return __result;
+        }
+    }
+
+    public unsafe partial class HTMLStartTagComment
+    {
+        public global::CppSharp.Parser.AST.HTMLStartTagComment.Attribute[] GetAttributesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.HTMLStartTagComment.Attribute[(int) AttributesCount];
+            var __data = (byte*) AttributesData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.AST.HTMLStartTagComment.Attribute.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.AST.HTMLStartTagComment.Attribute.Internal)));
+            return __result;
+        }
+    }
+}
+
+namespace CppSharp.Parser
+{
+    public unsafe partial class CppParserOptions
+    {
+        public string[] GetArgumentsArray()
+        {
+            var __strings = new global::System.IntPtr[(int) ArgumentsCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getArgumentsData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetLibraryFilesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) LibraryFilesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getLibraryFilesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetSourceFilesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) SourceFilesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getSourceFilesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetIncludeDirsArray()
+        {
+            var __strings = new global::System.IntPtr[(int) IncludeDirsCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getIncludeDirsData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetSystemIncludeDirsArray()
+        {
+            var __strings = new global::System.IntPtr[(int) SystemIncludeDirsCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getSystemIncludeDirsData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetDefinesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) DefinesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getDefinesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetUndefinesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) UndefinesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getUndefinesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetLibraryDirsArray()
+        {
+            var __strings = new global::System.IntPtr[(int) LibraryDirsCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getLibraryDirsData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public global::CppSharp.Parser.VirtualFile[] GetVirtualFilesArray()
+        {
+            var __result = new global::CppSharp.Parser.VirtualFile[(int) VirtualFilesCount];
+            var __data = (byte*) VirtualFilesData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.VirtualFile.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.VirtualFile.Internal)));
+            return __result;
+        }
+
+        public global::CppSharp.Parser.ParserTarget[] GetTargetsArray()
+        {
+            var __result = new global::CppSharp.Parser.ParserTarget[(int) TargetsCount];
+            var __data = (byte*) TargetsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.ParserTarget.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.ParserTarget.Internal)));
+            return __result;
+        }
+
+        public string[] GetModuleMapFilesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) ModuleMapFilesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getModuleMapFilesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+
+        public string[] GetSpecializedTemplatesArray()
+        {
+            var __strings = new global::System.IntPtr[(int) SpecializedTemplatesCount];
+            fixed (global::System.IntPtr* __data = __strings)
+                getSpecializedTemplatesData((global::System.IntPtr) __data);
+            var __result = new string[__strings.Length];
+            for (var i = 0; i < __strings.Length; i++)
+                __result[i] = Marshal.PtrToStringAnsi(__strings[i]);
+            return __result;
+        }
+    }
+
+    public unsafe partial class ParserResult
+    {
+        public global::CppSharp.Parser.ParserDiagnostic[] GetDiagnosticsArray()
+        {
+            var __result = new global::CppSharp.Parser.ParserDiagnostic[(int) DiagnosticsCount];
+            var __data = (byte*) DiagnosticsData;
+            for (var i = 0; i < __result.Length; i++)
+                __result[i] = global::CppSharp.Parser.ParserDiagnostic.__CreateInstance(new global::System.IntPtr(__data + i * sizeof(global::CppSharp.Parser.ParserDiagnostic.Internal)));
+            return __result;
+        }
+
+        public global::CppSharp.Parser.AST.NativeLibrary[] GetLibrariesArray()
+        {
+            var __result = new global::CppSharp.Parser.AST.NativeLibrary[(int) LibrariesCount];
+            var __data = (global::System.IntPtr*) LibrariesData;
+            for (var i = 0; i < __result.Length; i++)
             {
-                var __arg0 = ReferenceEquals(Opts, null) ? global::System.IntPtr.Zero : Opts.__Instance;
-                var __ret = Internal.GetTargetInfo_0(__arg0);
-                global::CppSharp.Parser.ParserTargetInfo __result0;
-                if (__ret == IntPtr.Zero) __result0 = null;
-                else if (global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap.ContainsKey(__ret))
-                    __result0 = (global::CppSharp.Parser.ParserTargetInfo) global::CppSharp.Parser.ParserTargetInfo.NativeToManagedMap[__ret];
-                else __result0 = global::CppSharp.Parser.ParserTargetInfo.__CreateInstance(__ret);
-                return __result0;
+                var __ret = __data[i];
+                if (__ret == IntPtr.Zero) __result[i] = null;
+                else if (global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap.ContainsKey(__ret))
+                    __result[i] = (global::CppSharp.Parser.AST.NativeLibrary) global::CppSharp.Parser.AST.NativeLibrary.NativeToManagedMap[__ret];
+                else __result[i] = global::CppSharp.Parser.AST.NativeLibrary.__CreateInstance(__ret);
             }
+            return __result;
         }
     }
 }
@@ -27,4 +27,6 @@ template class vector<CppSharp::CppParser::AST::VarTemplateSpecialization*>;
 template class vector<CppSharp::CppParser::AST::MacroDefinition*>;
 template class vector<CppSharp::CppParser::AST::TranslationUnit*>;
 template class vector<CppSharp::CppParser::AST::InlineContentComment*>;
-template class vector<CppSharp::CppParser::AST::VerbatimBlockLineComment*>;
\ No newline at end of file
+template class vector<CppSharp::CppParser::AST::VerbatimBlockLineComment*>;
+template class vector<CppSharp::CppParser::AST::ClassLayout*>;
+template class vector<CppSharp::CppParser::AST::NativeLibrary*>;
\ No newline at end of file
@@ -267,9 +267,52 @@ void Parser::HandleComments(const clang::Decl* D, Declaration* Decl)
     auto RawComment = WalkRawComment(RC);
     Decl->Comment = RawComment;
 
-    if (clang::comments::FullComment* FC = RC->parse(*AST, &C->getPreprocessor(), D))
+    // The full comments are built once the declarations are walked.
+    if (!Opts->SkipFullComments)
+        PendingComments.emplace_back(D, RawComment);
+}
+
+// Computes the whitespace flags clang caches on first use, so the parsed
+// comments are only read once they are converted.
+static void CacheWhitespace(clang::comments::Comment* C)
+{
+    if (!C)
+        return;
+
+    if (auto PC = llvm::dyn_cast<clang::comments::ParagraphComment>(C))
+        PC->isWhitespace();
+
+    for (auto I = C->child_begin(), E = C->child_end(); I != E; ++I)
+        CacheWhitespace(*I);
+}
+
+std::vector<clang::comments::FullComment*> Parser::ParseFullComments()
+{
+    std::vector<clang::comments::FullComment*> FullComments(PendingComments.size());
+    for (size_t I = 0, E = PendingComments.size(); I != E; ++I)
     {
-        auto CB = static_cast<FullComment*>(ConvertCommentBlock(FC));
-        RawComment->FullCommentBlock = CB;
+        auto D = PendingComments[I].first;
+        auto RC = AST->getRawCommentForAnyRedecl(D);
+        if (!RC)
+            continue;
+
+        FullComments[I] = RC->parse(*AST, &C->getPreprocessor(), D);
+        CacheWhitespace(FullComments[I]);
+    }
+
+    return FullComments;
+}
+
+void Parser::ConvertFullComments(
+    const std::vector<clang::comments::FullComment*>& FullComments,
+    size_t Begin, size_t End)
+{
+    for (auto I = Begin; I != End; ++I)
+    {
+        if (!FullComments[I])
+            continue;
+
+        auto CB = static_cast<FullComment*>(ConvertCommentBlock(FullComments[I]));
+        PendingComments[I].second->FullCommentBlock = CB;
     }
 }
@@ -19,25 +19,69 @@ CppParserOptions::CppParserOptions()
     , MicrosoftMode(false)
     , Verbose(false)
     , LanguageVersion(CppParser::LanguageVersion::GNUPlusPlus11)
+    , MappedSymbols(false)
+    , Incremental(false)
+    , Modules(false)
+    , PrecompiledPreamble(false)
+    , SkipFullComments(false)
+    , UserSpecializationsOnly(false)
+    , MaxSpecializations(0)
+    , MinDiagnosticLevel(ParserDiagnosticLevel::Note)
+    , ErrorLimit(0)
+    , DiagnosticHandler(0)
     , TargetInfo(0)
 {
 }
 
 DEF_VECTOR_STRING(CppParserOptions, Arguments)
 DEF_STRING(CppParserOptions, LibraryFile)
+DEF_VECTOR_STRING(CppParserOptions, LibraryFiles)
 DEF_VECTOR_STRING(CppParserOptions, SourceFiles)
 DEF_VECTOR_STRING(CppParserOptions, IncludeDirs)
 DEF_VECTOR_STRING(CppParserOptions, SystemIncludeDirs)
 DEF_VECTOR_STRING(CppParserOptions, Defines)
 DEF_VECTOR_STRING(CppParserOptions, Undefines)
 DEF_VECTOR_STRING(CppParserOptions, LibraryDirs)
+DEF_VECTOR(CppParserOptions, VirtualFile, VirtualFiles)
+DEF_VECTOR(CppParserOptions, ParserTarget, Targets)
 DEF_STRING(CppParserOptions, TargetTriple)
+DEF_STRING(CppParserOptions, ModuleCachePath)
+DEF_VECTOR_STRING(CppParserOptions, ModuleMapFiles)
+DEF_VECTOR_STRING(CppParserOptions, SpecializedTemplates)
+DEF_STRING(CppParserOptions, ParserServerSocket)
 DEF_STRING(ParserTargetInfo, ABI)
 
+VirtualFile::VirtualFile() {}
+
+VirtualFile::VirtualFile(const VirtualFile& rhs)
+    : FileName(rhs.FileName)
+    , Contents(rhs.Contents)
+{}
+
+DEF_STRING(VirtualFile, FileName)
+DEF_STRING(VirtualFile, Contents)
+
+ParserTarget::ParserTarget()
+    : Abi(CppAbi::Itanium)
+    , MicrosoftMode(false)
+{
+}
+
+ParserTarget::ParserTarget(const ParserTarget& rhs)
+    : TargetTriple(rhs.TargetTriple)
+    , Abi(rhs.Abi)
+    , MicrosoftMode(rhs.MicrosoftMode)
+{
+}
+
+DEF_STRING(ParserTarget, TargetTriple)
+
 ParserResult::ParserResult()
     : ASTContext(0)
     , Library(0)
     , CodeParser(0)
+    , CodeGenInfoLookups(0)
+    , CodeGenInfoCacheHits(0)
 {
 }
 
@@ -46,7 +90,10 @@ ParserResult::ParserResult(const ParserResult& rhs)
     , Diagnostics(rhs.Diagnostics)
     , ASTContext(rhs.ASTContext)
     , Library(rhs.Library)
+    , Libraries(rhs.Libraries)
     , CodeParser(rhs.CodeParser)
+    , CodeGenInfoLookups(rhs.CodeGenInfoLookups)
+    , CodeGenInfoCacheHits(rhs.CodeGenInfoCacheHits)
 {}
 
 ParserResult::~ParserResult()
@@ -68,5 +115,6 @@ DEF_STRING(ParserDiagnostic, FileName)
 DEF_STRING(ParserDiagnostic, Message)
 
 DEF_VECTOR(ParserResult, ParserDiagnostic, Diagnostics)
+DEF_VECTOR(ParserResult, NativeLibrary*, Libraries)
 
 } }
\ No newline at end of file
@@ -43,6 +43,51 @@ enum class LanguageVersion
     GNUPlusPlus11
 };
 
+// File given to the parser from memory, which shadows any file with the
+// same path on disk.
+struct CS_API VirtualFile
+{
+    VirtualFile();
+    VirtualFile(const VirtualFile&);
+
+    STRING(FileName)
+    STRING(Contents)
+};
+
+enum class ParserDiagnosticLevel
+{
+    Ignored,
+    Note,
+    Warning,
+    Error,
+    Fatal
+};
+
+struct CS_API ParserDiagnostic
+{
+    ParserDiagnostic();
+    ParserDiagnostic(const ParserDiagnostic&);
+
+    STRING(FileName)
+    STRING(Message)
+    ParserDiagnosticLevel Level;
+    int LineNumber;
+    int ColumnNumber;
+};
+
+typedef void (*ParserDiagnosticHandler)(ParserDiagnostic* Diagnostic);
+
+// Additional target of a parse, see CppParserOptions::Targets.
+struct CS_API ParserTarget
+{
+    ParserTarget();
+    ParserTarget(const ParserTarget&);
+
+    STRING(TargetTriple)
+    CppAbi Abi;
+    bool MicrosoftMode;
+};
+
 struct CS_API CppParserOptions
 {
     CppParserOptions();
@@ -50,6 +95,8 @@ struct CS_API CppParserOptions
     VECTOR_STRING(Arguments)
 
     STRING(LibraryFile)
+    // Library file names for ClangParser::ParseLibraries.
+    VECTOR_STRING(LibraryFiles)
     // C/C++ header file names.
     VECTOR_STRING(SourceFiles)
 
@@ -60,40 +107,78 @@ struct CS_API CppParserOptions
     VECTOR_STRING(Undefines)
     VECTOR_STRING(LibraryDirs)
 
+    // In-memory files layered over the real file system.
+    VECTOR(VirtualFile, VirtualFiles)
+
     CppSharp::CppParser::AST::ASTContext* ASTContext;
 
     int ToolSetToUse;
     STRING(TargetTriple)
     CppAbi Abi;
 
+    // Additional targets parsed along with the one above. Each is parsed
+    // concurrently into its own context and its class layouts and function
+    // ABI details are attached to the declarations of the main target, in
+    // Class::TargetLayouts and Function::TargetLayouts.
+    VECTOR(ParserTarget, Targets)
+
     bool NoStandardIncludes;
     bool NoBuiltinIncludes;
     bool MicrosoftMode;
     bool Verbose;
     LanguageVersion LanguageVersion;
 
-    ParserTargetInfo* TargetInfo;
-};
+    // Keep parsed libraries memory-mapped and read their symbols as ranges
+    // into the string tables instead of copying each of them.
+    bool MappedSymbols;
+
+    // Skip source files whose transitive includes did not change since they
+    // were parsed into ASTContext, and drop the units made stale by the
+    // changed headers so that only those get reparsed. The include graph
+    // and content hashes this relies on are only recorded when it is set.
+    bool Incremental;
+
+    // Compile the headers described by module maps into clang modules,
+    // cached in ModuleCachePath (a temporary directory if empty) and
+    // reused by later parses. ModuleMapFiles are loaded in addition to the
+    // module maps found next to the headers.
+    bool Modules;
+    STRING(ModuleCachePath)
+    VECTOR_STRING(ModuleMapFiles)
+
+    // Precompile the includes of all but the last source file into a
+    // preamble, reused by the parses of the same headers for as long as
+    // the files it was built from do not change.
+    bool PrecompiledPreamble;
+
+    // Only keep the raw text of comments, without parsing them into
+    // RawComment::FullCommentBlock, when the comments are not generated.
+    bool SkipFullComments;
+
+    // Limits on the implicit class template specializations which are
+    // walked in full, the others being kept as incomplete declarations:
+    // only the ones instantiated outside of system headers, at most
+    // MaxSpecializations per parse (0 for no limit) and, if any are given,
+    // only those of the SpecializedTemplates (qualified names).
+    bool UserSpecializationsOnly;
+    unsigned MaxSpecializations;
+    VECTOR_STRING(SpecializedTemplates)
+
+    // Diagnostics below this level are dropped before being formatted.
+    ParserDiagnosticLevel MinDiagnosticLevel;
+    // Number of errors after which the parse stops (0 for no limit).
+    unsigned ErrorLimit;
+    // Called for each diagnostic as soon as it is reported. Only the errors
+    // passed to the handler are also kept in the ParserResult.
+    ParserDiagnosticHandler DiagnosticHandler;
 
-enum class ParserDiagnosticLevel
-{
-    Ignored,
-    Note,
-    Warning,
-    Error,
-    Fatal
-};
-
-struct CS_API ParserDiagnostic
-{
-    ParserDiagnostic();
-    ParserDiagnostic(const ParserDiagnostic&);
+    ParserTargetInfo* TargetInfo;
 
-    STRING(FileName)
-    STRING(Message)
-    ParserDiagnosticLevel Level;
-    int LineNumber;
-    int ColumnNumber;
+    // Socket of a parser server (CppSharp.CppParser.Worker --server) to
+    // forward ClangParser::ParseHeader and ClangParser::ParseLibrary to.
+    // Falls back to the CPPSHARP_PARSER_SERVER environment variable if
+    // empty, and to parsing in-process if no server is listening.
+    STRING(ParserServerSocket)
 };
 
 enum class ParserResultKind
@@ -116,7 +201,14 @@ struct CS_API ParserResult
 
     CppSharp::CppParser::AST::ASTContext* ASTContext;
     CppSharp::CppParser::AST::NativeLibrary* Library;
+    VECTOR(NativeLibrary*, Libraries)
     Parser* CodeParser;
+
+    // Parse statistics: the number of functions whose ABI details were
+    // looked up and how many of them reused those of an earlier function
+    // with the same signature.
+    unsigned CodeGenInfoLookups;
+    unsigned CodeGenInfoCacheHits;
 };
 
 enum class SourceLocationKind
@@ -133,7 +225,11 @@ class CS_API ClangParser
 public:
 
     static ParserResult* ParseHeader(CppParserOptions* Opts);
+    // Precompiles the source files into the file given with -o, which can
+    // then be parsed with -include-pch, e.g. in another process.
+    static ParserResult* PrecompileHeader(CppParserOptions* Opts);
     static ParserResult* ParseLibrary(CppParserOptions* Opts);
+    static ParserResult* ParseLibraries(CppParserOptions* Opts);
     static ParserTargetInfo* GetTargetInfo(CppParserOptions* Opts);
 };
 
@@ -16,15 +16,33 @@ class ELFDumper {
 public:
     ELFDumper(const llvm::object::ELFFile<ELFT> *Obj);
 
+    typedef llvm::object::ELFFile<ELFT> ELFO;
+    typedef typename ELFO::Elf_Sym Elf_Sym;
+
     std::vector<llvm::StringRef> getNeededLibraries() const;
 
+    /// \brief Returns true if the library has a .gnu.hash or .hash table.
+    bool hasHashTable() const { return GnuHashTable || SysVHashTable; }
+
+    /// \brief Looks up a defined, visible dynamic symbol through the hash
+    /// table of the library, preferring its default version.
+    const Elf_Sym *findExportedSymbol(llvm::StringRef Name) const;
+
+    /// \brief Returns the version defined for an exported symbol, if any.
+    llvm::StringRef getSymbolVersion(const Elf_Sym *Sym) const;
+
 private:
-    typedef llvm::object::ELFFile<ELFT> ELFO;
-    typedef typename ELFO::Elf_Sym Elf_Sym;
     typedef typename ELFO::Elf_Dyn Elf_Dyn;
     typedef typename ELFO::Elf_Dyn_Range Elf_Dyn_Range;
     typedef typename ELFO::Elf_Phdr Elf_Phdr;
+    typedef typename ELFO::Elf_Versym Elf_Versym;
+    typedef typename ELFO::Elf_Verdef Elf_Verdef;
+    typedef typename ELFO::Elf_Verdaux Elf_Verdaux;
     typedef typename ELFO::uintX_t uintX_t;
+    typedef llvm::support::detail::packed_endian_specific_integral<
+        uint32_t, ELFT::TargetEndianness, llvm::support::aligned> Elf_Word32;
+    typedef llvm::support::detail::packed_endian_specific_integral<
+        uintX_t, ELFT::TargetEndianness, llvm::support::aligned> Elf_BloomWord;
 
     /// \brief Represents a region described by entries in the .dynamic table.
     struct DynRegionInfo {
@@ -44,9 +62,24 @@ private:
         return llvm::make_range(dynamic_table_begin(), dynamic_table_end());
     }
 
+    bool isInFile(const void *Ptr, uint64_t Size) const;
+    const Elf_Sym *getDynamicSymbol(uint32_t Index) const;
+    bool isExported(const Elf_Sym *Sym) const;
+    bool isDefaultVersion(uint32_t Index) const;
+    bool matchSymbol(uint32_t Index, llvm::StringRef Name,
+                     const Elf_Sym *&Found) const;
+    const Elf_Sym *findGnuHashSymbol(llvm::StringRef Name) const;
+    const Elf_Sym *findSysVHashSymbol(llvm::StringRef Name) const;
+
     const ELFO *Obj;
     DynRegionInfo DynamicRegion;
     llvm::StringRef DynamicStringTable;
+    const Elf_Sym *DynamicSymbolTable = nullptr;
+    const Elf_Word32 *GnuHashTable = nullptr;
+    const Elf_Word32 *SysVHashTable = nullptr;
+    const Elf_Versym *VersymTable = nullptr;
+    const uint8_t *VerdefTable = nullptr;
+    uint64_t VerdefCount = 0;
 };
 
 template <typename ELFT>
@@ -90,10 +123,36 @@ ELFDumper<ELFT>::ELFDumper(const llvm::object::ELFFile<ELFT> *Obj) {
         case llvm::ELF::DT_STRSZ:
             StringTableSize = Dyn.getVal();
             break;
+        case llvm::ELF::DT_SYMTAB:
+            DynamicSymbolTable = (const Elf_Sym *)toMappedAddr(Dyn.getPtr());
+            break;
+        case llvm::ELF::DT_GNU_HASH:
+            GnuHashTable = (const Elf_Word32 *)toMappedAddr(Dyn.getPtr());
+            break;
+        case llvm::ELF::DT_HASH:
+            SysVHashTable = (const Elf_Word32 *)toMappedAddr(Dyn.getPtr());
+            break;
+        case llvm::ELF::DT_VERSYM:
+            VersymTable = (const Elf_Versym *)toMappedAddr(Dyn.getPtr());
+            break;
+        case llvm::ELF::DT_VERDEF:
+            VerdefTable = toMappedAddr(Dyn.getPtr());
+            break;
+        case llvm::ELF::DT_VERDEFNUM:
+            VerdefCount = Dyn.getVal();
+            break;
         }
     }
     if (StringTableBegin)
         DynamicStringTable = StringRef(StringTableBegin, StringTableSize);
+
+    // The hash tables are useless without the symbols and their names.
+    if (!DynamicSymbolTable || DynamicStringTable.empty())
+        GnuHashTable = SysVHashTable = nullptr;
+    if (GnuHashTable && !isInFile(GnuHashTable, 4 * sizeof(Elf_Word32)))
+        GnuHashTable = nullptr;
+    if (SysVHashTable && !isInFile(SysVHashTable, 2 * sizeof(Elf_Word32)))
+        SysVHashTable = nullptr;
 }
 
 template <typename ELFT>
@@ -125,4 +184,193 @@ std::vector<llvm::StringRef> ELFDumper<ELFT>::getNeededLibraries() const {
     return Libs;
 }
 
+template <class ELFT>
+bool ELFDumper<ELFT>::isInFile(const void *Ptr, uint64_t Size) const {
+    auto Begin = Obj->base();
+    auto End = Begin + Obj->getBufSize();
+    auto P = reinterpret_cast<const uint8_t *>(Ptr);
+    return P >= Begin && P <= End && Size <= uint64_t(End - P);
+}
+
+template <class ELFT>
+const typename ELFDumper<ELFT>::Elf_Sym *
+ELFDumper<ELFT>::getDynamicSymbol(uint32_t Index) const {
+    auto Sym = DynamicSymbolTable + Index;
+    return isInFile(Sym, sizeof(Elf_Sym)) ? Sym : nullptr;
+}
+
+template <class ELFT>
+bool ELFDumper<ELFT>::isExported(const Elf_Sym *Sym) const {
+    if (Sym->st_shndx == llvm::ELF::SHN_UNDEF)
+        return false;
+
+    switch (Sym->getBinding()) {
+    case llvm::ELF::STB_GLOBAL:
+    case llvm::ELF::STB_WEAK:
+    case llvm::ELF::STB_GNU_UNIQUE:
+        break;
+    default:
+        return false;
+    }
+
+    auto Visibility = Sym->getVisibility();
+    return Visibility == llvm::ELF::STV_DEFAULT ||
+           Visibility == llvm::ELF::STV_PROTECTED;
+}
+
+template <class ELFT>
+bool ELFDumper<ELFT>::isDefaultVersion(uint32_t Index) const {
+    if (!VersymTable || !isInFile(VersymTable + Index, sizeof(Elf_Versym)))
+        return true;
+    return !(VersymTable[Index].vs_index & llvm::ELF::VERSYM_HIDDEN);
+}
+
+/// Returns true once the lookup can stop, which is when a default version
+/// of the symbol was found.
+template <class ELFT>
+bool ELFDumper<ELFT>::matchSymbol(uint32_t Index, llvm::StringRef Name,
+                                  const Elf_Sym *&Found) const {
+    auto Sym = getDynamicSymbol(Index);
+    if (!Sym || Sym->st_name >= DynamicStringTable.size())
+        return false;
+
+    if (getDynamicString(Sym->st_name) != Name || !isExported(Sym))
+        return false;
+
+    if (!Found || isDefaultVersion(Index))
+        Found = Sym;
+
+    return isDefaultVersion(Index);
+}
+
+template <class ELFT>
+const typename ELFDumper<ELFT>::Elf_Sym *
+ELFDumper<ELFT>::findGnuHashSymbol(llvm::StringRef Name) const {
+    uint32_t NumBuckets = GnuHashTable[0];
+    uint32_t SymOffset = GnuHashTable[1];
+    uint32_t BloomSize = GnuHashTable[2];
+    uint32_t BloomShift = GnuHashTable[3];
+    if (NumBuckets == 0 || BloomSize == 0)
+        return nullptr;
+
+    auto Bloom = reinterpret_cast<const Elf_BloomWord *>(GnuHashTable + 4);
+    auto Buckets = reinterpret_cast<const Elf_Word32 *>(Bloom + BloomSize);
+    auto Chains = Buckets + NumBuckets;
+    if (!isInFile(Bloom, uint64_t(BloomSize) * sizeof(Elf_BloomWord) +
+                         uint64_t(NumBuckets) * sizeof(Elf_Word32)))
+        return nullptr;
+
+    uint32_t Hash = 5381;
+    for (unsigned char C : Name)
+        Hash = Hash * 33 + C;
+
+    // Reject most missing symbols with the bloom filter.
+    const unsigned WordBits = sizeof(uintX_t) * 8;
+    uintX_t Word = Bloom[(Hash / WordBits) % BloomSize];
+    uintX_t Mask = (uintX_t(1) << (Hash % WordBits)) |
+                   (uintX_t(1) << ((Hash >> BloomShift) % WordBits));
+    if ((Word & Mask) != Mask)
+        return nullptr;
+
+    const Elf_Sym *Found = nullptr;
+    uint32_t Index = Buckets[Hash % NumBuckets];
+    if (Index < SymOffset)
+        return nullptr;
+
+    for (;; ++Index) {
+        auto Chain = Chains + (Index - SymOffset);
+        if (!isInFile(Chain, sizeof(Elf_Word32)))
+            break;
+
+        uint32_t ChainHash = *Chain;
+        if ((Hash | 1) == (ChainHash | 1) && matchSymbol(Index, Name, Found))
+            break;
+
+        if (ChainHash & 1)
+            break;
+    }
+
+    return Found;
+}
+
+template <class ELFT>
+const typename ELFDumper<ELFT>::Elf_Sym *
+ELFDumper<ELFT>::findSysVHashSymbol(llvm::StringRef Name) const {
+    uint32_t NumBuckets = SysVHashTable[0];
+    uint32_t NumChains = SysVHashTable[1];
+    auto Buckets = SysVHashTable + 2;
+    auto Chains = Buckets + NumBuckets;
+    if (NumBuckets == 0 || !isInFile(Buckets,
+            (uint64_t(NumBuckets) + NumChains) * sizeof(Elf_Word32)))
+        return nullptr;
+
+    uint32_t Hash = 0;
+    for (unsigned char C : Name) {
+        Hash = (Hash << 4) + C;
+        uint32_t High = Hash & 0xf0000000;
+        if (High)
+            Hash ^= High >> 24;
+        Hash &= ~High;
+    }
+
+    const Elf_Sym *Found = nullptr;
+    // Bound the walk by the chain count to be safe against cycles.
+    uint32_t Steps = 0;
+    for (uint32_t Index = Buckets[Hash % NumBuckets];
+         Index != 0 && Index < NumChains && Steps++ < NumChains;
+         Index = Chains[Index]) {
+        if (matchSymbol(Index, Name, Found))
+            break;
+    }
+
+    return Found;
+}
+
+template <class ELFT>
+const typename ELFDumper<ELFT>::Elf_Sym *
+ELFDumper<ELFT>::findExportedSymbol(llvm::StringRef Name) const {
+    if (GnuHashTable)
+        return findGnuHashSymbol(Name);
+    if (SysVHashTable)
+        return findSysVHashSymbol(Name);
+    return nullptr;
+}
+
+template <class ELFT>
+llvm::StringRef ELFDumper<ELFT>::getSymbolVersion(const Elf_Sym *Sym) const {
+    if (!Sym || !VersymTable || !VerdefTable)
+        return llvm::StringRef();
+
+    auto Versym = VersymTable + (Sym - DynamicSymbolTable);
+    if (!isInFile(Versym, sizeof(Elf_Versym)))
+        return llvm::StringRef();
+
+    // Indices 0 and 1 are the local and global (unversioned) scopes.
+    unsigned Index = Versym->vs_index & llvm::ELF::VERSYM_VERSION;
+    if (Index <= llvm::ELF::VER_NDX_GLOBAL)
+        return llvm::StringRef();
+
+    auto Ptr = VerdefTable;
+    for (uint64_t I = 0; I != VerdefCount; ++I) {
+        auto Verdef = reinterpret_cast<const Elf_Verdef *>(Ptr);
+        if (!isInFile(Verdef, sizeof(Elf_Verdef)))
+            break;
+
+        if (Verdef->vd_ndx == Index) {
+            auto Verdaux = reinterpret_cast<const Elf_Verdaux *>(
+                Ptr + Verdef->vd_aux);
+            if (!isInFile(Verdaux, sizeof(Elf_Verdaux)) ||
+                Verdaux->vda_name >= DynamicStringTable.size())
+                break;
+            return getDynamicString(Verdaux->vda_name);
+        }
+
+        if (Verdef->vd_next == 0)
+            break;
+        Ptr += Verdef->vd_next;
+    }
+
+    return llvm::StringRef();
+}
+
 } }
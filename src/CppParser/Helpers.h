@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 #include <map>
 #include <string>
@@ -26,33 +27,43 @@
 
 
 /** We use these macros to workaround the lack of good standard C++
- * containers/string support in the C# binding backend. */
+ * containers/string support in the C# binding backend.
+ *
+ * The Data accessors give bulk access to a whole vector in a single call:
+ * get##name##Data() returns the contiguous element storage (valid until the
+ * vector is modified) and, for string vectors, get##name##Data(Strings)
+ * fills a caller allocated array of get##name##Count() string pointers. */
 
 #define VECTOR(type, name) \
     std::vector<type> name; \
     type get##name (unsigned i); \
     void add##name (type& s); \
     unsigned get##name##Count (); \
-    void clear##name();
+    void clear##name(); \
+    type* get##name##Data();
 
 #define DEF_VECTOR(klass, type, name) \
     type klass::get##name (unsigned i) { return name[i]; } \
     void klass::add##name (type& s) { return name.push_back(s); } \
     unsigned klass::get##name##Count () { return name.size(); } \
-    void klass::clear##name() { name.clear(); }
+    void klass::clear##name() { name.clear(); } \
+    type* klass::get##name##Data() { return name.data(); }
 
 #define VECTOR_STRING(name) \
     std::vector<std::string> name; \
     const char* get##name (unsigned i); \
     void add##name (const char* s); \
     unsigned get##name##Count (); \
-    void clear##name();
+    void clear##name(); \
+    void get##name##Data(const char** Strings);
 
 #define DEF_VECTOR_STRING(klass, name) \
     const char* klass::get##name (unsigned i) { return name[i].c_str(); } \
     void klass::add##name (const char* s) { return name.push_back(std::string(s)); } \
     unsigned klass::get##name##Count () { return name.size(); } \
-    void klass::clear##name() { name.clear(); }
+    void klass::clear##name() { name.clear(); } \
+    void klass::get##name##Data(const char** Strings) \
+    { for (unsigned i = 0; i < name.size(); ++i) Strings[i] = name[i].c_str(); }
 
 #define STRING(name) \
     std::string name; \
@@ -63,3 +74,76 @@
     const char* klass::get##name() { return name.c_str(); } \
     void klass::set##name(const char* s) { name = s; }
 
+
+/** Hashed index over a vector of pointers, finding its elements by a key of
+ * theirs. It only holds the positions of the elements in one std::vector, so
+ * the bindings lay it out like the VECTOR members and it stays valid when the
+ * indexed vector grows. The owner updates it on every change of the vector:
+ * appended elements are added and any other change invalidates it, so the
+ * next lookup builds it again. The first of the elements sharing a key is the
+ * one found. */
+template<typename T, typename Key>
+class HashIndex
+{
+public:
+    void invalidate() { Slots.clear(); }
+
+    template<typename KeyOf>
+    void add(const std::vector<T*>& Items, unsigned Position, KeyOf GetKey)
+    {
+        if (Slots.empty())
+            return;
+
+        if (Items.size() * 2 > Slots.size())
+            invalidate();
+        else
+            insert(Items, Position, GetKey);
+    }
+
+    template<typename KeyOf>
+    T* find(const std::vector<T*>& Items, const Key& K, KeyOf GetKey)
+    {
+        if (Slots.empty())
+            build(Items, GetKey);
+
+        auto Mask = Slots.size() - 1;
+        for (auto Slot = std::hash<Key>()(K) & Mask; Slots[Slot] != 0;
+            Slot = (Slot + 1) & Mask)
+        {
+            auto Item = Items[Slots[Slot] - 1];
+            if (GetKey(Item) == K)
+                return Item;
+        }
+
+        return nullptr;
+    }
+
+private:
+    template<typename KeyOf>
+    void build(const std::vector<T*>& Items, KeyOf GetKey)
+    {
+        size_t Size = 16;
+        while (Size < Items.size() * 2)
+            Size <<= 1;
+
+        Slots.assign(Size, 0);
+        for (unsigned I = 0, E = Items.size(); I != E; ++I)
+            insert(Items, I, GetKey);
+    }
+
+    // Positions are stored one-based, zero marks the empty slots.
+    template<typename KeyOf>
+    void insert(const std::vector<T*>& Items, unsigned Position, KeyOf GetKey)
+    {
+        const Key& K = GetKey(Items[Position]);
+        auto Mask = Slots.size() - 1;
+        auto Slot = std::hash<Key>()(K) & Mask;
+        for (; Slots[Slot] != 0; Slot = (Slot + 1) & Mask)
+            if (GetKey(Items[Slots[Slot] - 1]) == K)
+                return;
+
+        Slots[Slot] = Position + 1;
+    }
+
+    std::vector<unsigned> Slots;
+};
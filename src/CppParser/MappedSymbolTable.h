@@ -0,0 +1,49 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#pragma once
+
+#include "AST.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace CppSharp { namespace CppParser { namespace AST {
+
+/// Symbols of a library read with CppParserOptions::MappedSymbols. They are
+/// kept as ranges into the string tables of the mapped library instead of
+/// owned strings, and the table keeps the library mapped for as long as a
+/// copy of the NativeLibrary refers to it.
+struct MappedSymbolTable
+{
+    struct Range
+    {
+        unsigned Offset;
+        unsigned Length;
+    };
+
+    MappedSymbolTable(const char* Data, size_t Size)
+        : References(1), Data(Data), Size(Size) {}
+
+    std::atomic<unsigned> References;
+
+    // Owner of the memory the ranges point into.
+    std::shared_ptr<void> Storage;
+    // Names assembled while reading, when they are not in the file as is.
+    std::string Pool;
+
+    const char* Data;
+    size_t Size;
+    std::vector<Range> Symbols;
+
+    // Queries the library's own symbol hash table instead of the symbol
+    // index, returning the version of the symbol if it is exported.
+    std::function<bool(const char* Symbol, unsigned Length,
+        const char** Version)> ExportedSymbolLookup;
+};
+
+} } }
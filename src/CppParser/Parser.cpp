@@ -11,10 +11,14 @@
 
 #include "Parser.h"
 #include "ELFDumper.h"
+#include "MappedSymbolTable.h"
+#include "ParserServer.h"
 
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
 #include <llvm/Support/Path.h>
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/ThreadPool.h>
 #include <llvm/Object/Archive.h>
 #include <llvm/Object/COFF.h>
 #include <llvm/Object/ObjectFile.h>
@@ -25,6 +29,7 @@
 #include <llvm/IR/Module.h>
 #include <llvm/IR/DataLayout.h>
 #include <clang/Basic/Version.h>
+#include <clang/Basic/VirtualFileSystem.h>
 #include <clang/Config/config.h>
 #include <clang/AST/ASTContext.h>
 #include <clang/AST/Comment.h>
@@ -38,6 +43,8 @@
 #include <clang/Parse/ParseAST.h>
 #include <clang/Sema/Sema.h>
 #include <clang/Sema/SemaConsumer.h>
+#include <clang/Serialization/ASTWriter.h>
+#include <clang/Frontend/PCHContainerOperations.h>
 #include <clang/Frontend/Utils.h>
 #include <clang/Driver/Driver.h>
 #include <clang/Driver/ToolChain.h>
@@ -50,6 +57,12 @@
 #include <CodeGen/CGCXXABI.h>
 #include <Driver/ToolChains.h>
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
 #if defined(__APPLE__) || defined(__linux__)
 #ifndef _GNU_SOURCE
 #define _GNU_SOURCE
@@ -62,12 +75,67 @@
 using namespace CppSharp::CppParser;
 
 // We use this as a placeholder for pointer values that should be ignored.
-void* IgnorePtr = (void*) 0x1;
+static void* const IgnorePtr = (void*) 0x1;
 
 //-----------------------------------//
 
-Parser::Parser(CppParserOptions* Opts) : Lib(Opts->ASTContext), Opts(Opts), Index(0)
+Parser::Parser(CppParserOptions* Opts) : Lib(Opts->ASTContext), Opts(Opts), Index(0),
+    WalkedSpecializations(0), CodeGenInfoLookups(0), CodeGenInfoCacheHits(0)
+{
+}
+
+Parser::~Parser()
 {
+    ReleaseOriginalPointers();
+}
+
+// The original pointers of the nodes walked by this parser point to Clang
+// objects which are freed along with the compiler instance. Once that memory
+// is reused by the next parse, a new declaration could end up with the same
+// original pointer as an unrelated one, so rebase them to the address of
+// the (never freed) first node created for each Clang object. This allows
+// releasing each parse as soon as it is done instead of keeping every
+// compiler instance alive until the whole AST has been converted.
+void Parser::ReleaseOriginalPointers()
+{
+    // Parsers without a context (libraries, precompiled headers) walk no
+    // declarations.
+    if (!Lib)
+        return;
+
+    // Other parses look up the same declarations by their original pointers.
+    std::lock_guard<ASTContext> LibLock(*Lib);
+
+    std::unordered_map<const void*, void*> Rebased;
+
+    for (auto Decl : HandledDeclarations)
+        if (Decl->OriginalPtr != IgnorePtr)
+            Rebased.emplace(Decl->OriginalPtr, Decl);
+
+    for (auto Decl : HandledDeclarations)
+        if (Decl->OriginalPtr != IgnorePtr)
+            Decl->OriginalPtr = Rebased[Decl->OriginalPtr];
+
+    for (auto Class : LayoutClasses)
+    {
+        // The layouts of additional targets are moved to the main classes.
+        if (!Class->Layout)
+            continue;
+
+        for (auto& Field : Class->Layout->Fields)
+        {
+            auto It = Rebased.find(Field.FieldPtr);
+            if (It != Rebased.end())
+                Field.FieldPtr = It->second;
+        }
+    }
+
+    for (auto Entity : HandledEntities)
+        Entity->OriginalPtr = Entity;
+
+    HandledDeclarations.clear();
+    HandledEntities.clear();
+    LayoutClasses.clear();
 }
 
 //-----------------------------------//
@@ -98,6 +166,8 @@ void Parser::ReadClassLayout(Class* Class, const clang::RecordDecl* RD,
 {
     using namespace clang;
 
+    LayoutClasses.push_back(Class);
+
     const auto &Layout = C->getASTContext().getASTRecordLayout(RD);
     auto CXXRD = dyn_cast<CXXRecordDecl>(RD);
 
@@ -240,10 +310,8 @@ ConvertToClangTargetCXXABI(CppSharp::CppParser::AST::CppAbi abi)
     llvm_unreachable("Unsupported C++ ABI.");
 }
 
-void Parser::SetupHeader()
+static std::vector<const char*> GetCompilerArguments(const CppParserOptions* Opts)
 {
-    using namespace clang;
-
     std::vector<const char*> args;
     args.push_back("-cc1");
 
@@ -287,34 +355,87 @@ void Parser::SetupHeader()
         args.push_back(Arg.c_str());
     }
 
-    C.reset(new CompilerInstance());
-    C->createDiagnostics();
-
-    CompilerInvocation* Inv = new CompilerInvocation();
-    CompilerInvocation::CreateFromArgs(*Inv, args.data(), args.data() + args.size(),
-      C->getDiagnostics());
-    C->setInvocation(Inv);
+    return args;
+}
 
-    auto& TO = Inv->TargetOpts;
-    TargetABI = ConvertToClangTargetCXXABI(Opts->Abi);
+static clang::TargetInfo* CreateTargetInfo(const CppParserOptions* Opts,
+    clang::DiagnosticsEngine& Diags, std::shared_ptr<clang::TargetOptions>& TO)
+{
+    using namespace clang;
 
     TO->Triple = llvm::sys::getDefaultTargetTriple();
     if (!Opts->TargetTriple.empty())
         TO->Triple = llvm::Triple::normalize(Opts->TargetTriple);
 
-    TargetInfo* TI = TargetInfo::CreateTargetInfo(C->getDiagnostics(), TO);
+    TargetInfo* TI = TargetInfo::CreateTargetInfo(Diags, TO);
     if (!TI)
     {
         // We might have no target info due to an invalid user-provided triple.
         // Try again with the default triple.
         TO->Triple = llvm::sys::getDefaultTargetTriple();
-        TI = TargetInfo::CreateTargetInfo(C->getDiagnostics(), TO);
+        TI = TargetInfo::CreateTargetInfo(Diags, TO);
     }
 
     assert(TI && "Expected valid target info");
+    return TI;
+}
+
+static llvm::IntrusiveRefCntPtr<clang::vfs::FileSystem>
+CreateVirtualFileSystem(const CppParserOptions* Opts)
+{
+    using namespace clang;
+
+    llvm::IntrusiveRefCntPtr<vfs::OverlayFileSystem> Overlay(
+        new vfs::OverlayFileSystem(vfs::getRealFileSystem()));
+    llvm::IntrusiveRefCntPtr<vfs::InMemoryFileSystem> InMemory(
+        new vfs::InMemoryFileSystem());
+    Overlay->pushOverlay(InMemory);
+
+    // Relative file names are resolved against the current directory.
+    llvm::SmallString<128> CurrentPath;
+    if (!llvm::sys::fs::current_path(CurrentPath))
+        Overlay->setCurrentWorkingDirectory(CurrentPath);
+
+    for (const auto& File : Opts->VirtualFiles)
+        InMemory->addFile(File.FileName, /*ModificationTime=*/0,
+            llvm::MemoryBuffer::getMemBufferCopy(File.Contents, File.FileName));
+
+    return Overlay;
+}
+
+void Parser::SetupHeader()
+{
+    using namespace clang;
+
+    auto args = GetCompilerArguments(Opts);
+
+    C.reset(new CompilerInstance());
+    C->createDiagnostics();
+
+    CompilerInvocation* Inv = new CompilerInvocation();
+    CompilerInvocation::CreateFromArgs(*Inv, args.data(), args.data() + args.size(),
+      C->getDiagnostics());
+    C->setInvocation(Inv);
+
+    // Headers precompiled by PrecompileHeader have no original source file
+    // for -include-pch to include, so they are loaded as an external AST
+    // source by ParseHeader instead.
+    PrecompiledHeader = Inv->getPreprocessorOpts().ImplicitPCHInclude;
+    Inv->getPreprocessorOpts().ImplicitPCHInclude.clear();
+
+    // Clang stops after a fatal error once the limit is reached, which also
+    // skips the remaining includes.
+    C->getDiagnostics().setErrorLimit(Opts->ErrorLimit);
+
+    auto& TO = Inv->TargetOpts;
+    TargetABI = ConvertToClangTargetCXXABI(Opts->Abi);
 
+    TargetInfo* TI = CreateTargetInfo(Opts, C->getDiagnostics(), TO);
     C->setTarget(TI);
 
+    if (!Opts->VirtualFiles.empty())
+        C->setVirtualFileSystem(CreateVirtualFileSystem(Opts));
+
     C->createFileManager();
     C->createSourceManager(C->getFileManager());
 
@@ -396,6 +517,25 @@ void Parser::SetupHeader()
         }
     }
 
+    if (Opts->Modules)
+    {
+        // Headers covered by module maps are compiled into modules once and
+        // loaded from the cache by the parses that follow.
+        LangOpts.Modules = true;
+        LangOpts.ImplicitModules = true;
+        HSOpts.ImplicitModuleMaps = true;
+        HSOpts.ModuleCachePath = Opts->ModuleCachePath;
+
+        if (HSOpts.ModuleCachePath.empty())
+        {
+            llvm::SmallString<128> CachePath;
+            llvm::sys::path::system_temp_directory(/*erasedOnReboot=*/false,
+                CachePath);
+            llvm::sys::path::append(CachePath, "CppSharp", "ModuleCache");
+            HSOpts.ModuleCachePath = CachePath.str();
+        }
+    }
+
     // Enable preprocessing record.
     PPOpts.DetailedRecord = true;
 
@@ -405,6 +545,16 @@ void Parser::SetupHeader()
     PP.getBuiltinInfo().initializeBuiltins(PP.getIdentifierTable(),
         PP.getLangOpts());
 
+    if (Opts->Modules)
+    {
+        for (const auto& ModuleMapFile : Opts->ModuleMapFiles)
+        {
+            auto File = C->getFileManager().getFile(ModuleMapFile);
+            if (File)
+                PP.getHeaderSearchInfo().loadModuleMapFile(File, /*IsSystem=*/false);
+        }
+    }
+
     C->createASTContext();
 }
 
@@ -862,8 +1012,6 @@ Class* Parser::WalkRecordCXX(const clang::CXXRecordDecl* Record)
     return RC;
 }
 
-static int I = 0;
-
 void Parser::WalkRecord(const clang::RecordDecl* Record, Class* RC)
 {
     using namespace clang;
@@ -1043,6 +1191,34 @@ WalkTemplateSpecializationKind(clang::TemplateSpecializationKind Kind)
     llvm_unreachable("Unknown template specialization kind");
 }
 
+bool Parser::ShouldWalkSpecialization(const clang::ClassTemplateSpecializationDecl* CTS)
+{
+    // Explicit specializations are declared by the user so always walk them.
+    if (CTS->getSpecializationKind() == clang::TSK_ExplicitSpecialization)
+        return true;
+
+    if (Opts->UserSpecializationsOnly)
+    {
+        auto POI = CTS->getPointOfInstantiation();
+        if (POI.isValid() && C->getSourceManager().isInSystemHeader(POI))
+            return false;
+    }
+
+    const auto& Templates = Opts->SpecializedTemplates;
+    if (!Templates.empty() && std::find(Templates.begin(), Templates.end(),
+        CTS->getSpecializedTemplate()->getQualifiedNameAsString()) == Templates.end())
+        return false;
+
+    if (Opts->MaxSpecializations &&
+        WalkedSpecializations >= Opts->MaxSpecializations)
+        return false;
+
+    WalkedSpecializations++;
+    return true;
+}
+
+//-----------------------------------//
+
 ClassTemplateSpecialization*
 Parser::WalkClassTemplateSpecialization(const clang::ClassTemplateSpecializationDecl* CTS)
 {
@@ -1078,7 +1254,12 @@ Parser::WalkClassTemplateSpecialization(const clang::ClassTemplateSpecialization
         TS->Arguments = WalkTemplateArgumentList(&TAL, (clang::TemplateSpecializationTypeLoc*) 0);
     }
 
-    if (CTS->isCompleteDefinition())
+    if (CTS->isCompleteDefinition() && !ShouldWalkSpecialization(CTS))
+    {
+        // Keep a stub which other declarations can still refer to.
+        TS->IsIncomplete = true;
+    }
+    else if (CTS->isCompleteDefinition())
     {
         WalkRecordCXX(CTS, TS);
     }
@@ -1281,8 +1462,15 @@ Parser::WalkTemplateArgumentList(const clang::TemplateArgumentList* TAL,
     for (size_t i = 0, e = TAL->size(); i < e; i++)
     {
         auto TA = TAL->get(i);
-        auto ArgLoc = TALI->operator[](i);
-        auto TP = WalkTemplateArgument(TA, &ArgLoc);
+        TemplateArgumentLoc ArgLoc;
+        TemplateArgumentLoc *ArgLocPtr = 0;
+        // Deduced arguments are not written so there can be fewer locations.
+        if (TALI && i < TALI->NumTemplateArgs)
+        {
+            ArgLoc = TALI->operator[](i);
+            ArgLocPtr = &ArgLoc;
+        }
+        auto TP = WalkTemplateArgument(TA, ArgLocPtr);
         params.push_back(TP);
     }
 
@@ -1301,7 +1489,9 @@ Parser::WalkTemplateArgument(const clang::TemplateArgument& TA, clang::TemplateA
     case clang::TemplateArgument::Type:
     {
         Arg.Kind = CppSharp::CppParser::TemplateArgument::ArgumentKind::Type;
-        if (ArgLoc && ArgLoc->getTypeSourceInfo())
+        // The written argument can be of another kind, i.e. a pack expansion.
+        if (ArgLoc && ArgLoc->getArgument().getKind() == clang::TemplateArgument::Type &&
+            ArgLoc->getTypeSourceInfo())
         {
             auto ArgTL = ArgLoc->getTypeSourceInfo()->getTypeLoc();
             Arg.Type = GetQualifiedType(TA.getAsType(), &ArgTL);
@@ -1414,15 +1604,17 @@ Parser::WalkFunctionTemplateSpec(clang::FunctionTemplateSpecializationInfo* FTSI
 {
     using namespace clang;
 
+    auto FT = WalkFunctionTemplate(FTSI->getTemplate());
+    if (auto FTS = FT->FindSpecialization(Function->USR))
+        return FTS;
+
     auto FTS = new CppSharp::CppParser::FunctionTemplateSpecialization();
     FTS->SpecializationKind = WalkTemplateSpecializationKind(FTSI->getTemplateSpecializationKind());
     FTS->SpecializedFunction = Function;
-    // HACK: walking template arguments crashes when generating the parser bindings for OS X
-    // so let's disable it for function templates which we do not support yet anyway 
-    //if (auto TALI = FTSI->TemplateArgumentsAsWritten)
-    //    FTS->Arguments = WalkTemplateArgumentList(FTSI->TemplateArguments, TALI);
-    FTS->Template = WalkFunctionTemplate(FTSI->getTemplate());
-    FTS->Template->Specializations.push_back(FTS);
+    FTS->Template = FT;
+    FT->addSpecializations(FTS);
+    FTS->Arguments = WalkTemplateArgumentList(FTSI->TemplateArguments,
+        FTSI->TemplateArgumentsAsWritten);
 
     return FTS;
 }
@@ -1820,9 +2012,9 @@ DeclarationContext* Parser::GetNamespace(const clang::Decl* D,
         }
         default:
         {
-            StringRef Kind = Ctx->getDeclKindName();
-            printf("Unhandled declaration context kind: %s\n", Kind.str().c_str());
-            assert(0 && "Unhandled declaration context kind");
+            HandleUnsupported(D->getLocation(),
+                std::string("Unhandled declaration context kind: ") + Ctx->getDeclKindName());
+            continue;
         } }
     }
 
@@ -2563,7 +2755,8 @@ Type* Parser::WalkType(clang::QualType QualType, clang::TypeLoc* TL,
     }
     default:
     {   
-        Debug("Unhandled type class '%s'\n", Type->getTypeClassName());
+        HandleUnsupported(clang::SourceLocation(),
+            std::string("Unhandled type class '") + Type->getTypeClassName() + "'");
         return nullptr;
     } }
 
@@ -2848,31 +3041,75 @@ void Parser::WalkFunction(const clang::FunctionDecl* FD, Function* F,
     if (auto FTSI = FD->getTemplateSpecializationInfo())
         F->SpecializationInfo = WalkFunctionTemplateSpec(FTSI, F);
 
+    // Functions with the same signature are classified the same way, as long
+    // as they are members of the same class and of the same kind.
+    const clang::Type* ThisType = nullptr;
+    auto MD = dyn_cast<CXXMethodDecl>(FD);
+    if (MD && !MD->isStatic())
+        ThisType = C->getASTContext().getRecordType(MD->getParent()).getTypePtr();
+
+    int StructorKind = isa<CXXConstructorDecl>(FD) ? 1 :
+        isa<CXXDestructorDecl>(FD) ? 2 : 0;
+    auto Key = std::make_tuple(FD->getType().getCanonicalType().getTypePtr(),
+        ThisType, StructorKind);
+
+    CodeGenInfoLookups++;
+    auto It = CodeGenInfoCache.find(Key);
+    if (It != CodeGenInfoCache.end())
+        CodeGenInfoCacheHits++;
+    else
+    {
+        // Types that are incomplete now may be completed later in the
+        // translation unit, so only valid classifications are kept.
+        auto Info = GetCodeGenInfo(FD);
+        if (!Info.IsValid)
+            return;
+        It = CodeGenInfoCache.emplace(Key, std::move(Info)).first;
+    }
+
+    const auto& CGInfo = It->second;
+    F->IsReturnIndirect = CGInfo.IsReturnIndirect;
+    for (unsigned I = 0, E = CGInfo.IndirectArguments.size(); I != E; ++I)
+    {
+        if (I >= F->Parameters.size())
+            break;
+        F->Parameters[I]->IsIndirect = CGInfo.IndirectArguments[I];
+    }
+}
+
+Parser::CodeGenInfo Parser::GetCodeGenInfo(const clang::FunctionDecl* FD)
+{
+    using namespace clang;
+
+    CodeGenInfo Info;
+    Info.IsValid = false;
+    Info.IsReturnIndirect = false;
+
     const CXXMethodDecl* MD;
     if ((MD = dyn_cast<CXXMethodDecl>(FD)) && !MD->isStatic() &&
         !CanCheckCodeGenInfo(C->getSema(), MD->getThisType(C->getASTContext()).getTypePtr()))
-        return;
+        return Info;
 
     if (!CanCheckCodeGenInfo(C->getSema(), FD->getReturnType().getTypePtr()))
-        return;
+        return Info;
 
     for (const auto& P : FD->parameters())
         if (!CanCheckCodeGenInfo(C->getSema(), P->getType().getTypePtr()))
-            return;
+            return Info;
 
     auto& CGInfo = GetCodeGenFuntionInfo(CodeGenTypes, FD);
-    F->IsReturnIndirect = CGInfo.getReturnInfo().isIndirect();
+    Info.IsValid = true;
+    Info.IsReturnIndirect = CGInfo.getReturnInfo().isIndirect();
 
-    unsigned Index = 0;
     for (auto I = CGInfo.arg_begin(), E = CGInfo.arg_end(); I != E; I++)
     {
         // Skip the first argument as it's the return type.
         if (I == CGInfo.arg_begin())
             continue;
-        if (Index >= F->Parameters.size())
-            continue;
-        F->Parameters[Index++]->IsIndirect = I->info.isIndirect();
+        Info.IndirectArguments.push_back(I->info.isIndirect());
     }
+
+    return Info;
 }
 
 Function* Parser::WalkFunction(const clang::FunctionDecl* FD, bool IsDependent,
@@ -3059,10 +3296,13 @@ PreprocessedEntity* Parser::WalkPreprocessedEntity(
                 WalkPreprocessedEntity(Decl, ME->getDefinition());
         Entity = Expansion;
 
-        std::string Text;
-        GetDeclText(PPEntity->getSourceRange(), Text);
-
-        static_cast<MacroExpansion*>(Entity)->Text = Text;
+        // The text is copied out of the source buffer after the walk.
+        auto Range = CharSourceRange::getTokenRange(PPEntity->getSourceRange());
+        bool Invalid;
+        StringRef Text = Lexer::getSourceText(Range, C->getSourceManager(),
+            C->getLangOpts(), &Invalid);
+        if (!Invalid)
+            PendingMacroTexts.emplace_back(&Expansion->Text, Text);
         break;
     }
     case clang::PreprocessedEntity::MacroDefinitionKind:
@@ -3107,10 +3347,11 @@ PreprocessedEntity* Parser::WalkPreprocessedEntity(
         Entity = Definition;
 
         Definition->Name = II->getName().trim();
-        Definition->Expression = Expression.trim();
+        PendingMacroTexts.emplace_back(&Definition->Expression, Expression.trim());
     }
     case clang::PreprocessedEntity::InclusionDirectiveKind:
-        // nothing to be done for InclusionDirectiveKind
+        // Inclusion directives are recorded in the include graph of the
+        // translation units, see HandleIncludes.
         break;
     default:
         llvm_unreachable("Unknown PreprocessedEntity");
@@ -3120,6 +3361,7 @@ PreprocessedEntity* Parser::WalkPreprocessedEntity(
         return nullptr;
 
     Entity->OriginalPtr = PPEntity;
+    HandledEntities.push_back(Entity);
     auto Namespace = GetTranslationUnit(PPEntity->getSourceRange().getBegin());
 
     if (Decl->Kind == CppSharp::CppParser::AST::DeclarationKind::TranslationUnit)
@@ -3134,6 +3376,50 @@ PreprocessedEntity* Parser::WalkPreprocessedEntity(
     return Entity;
 }
 
+void Parser::CopyMacroTexts(size_t Begin, size_t End)
+{
+    for (auto I = Begin; I != End; ++I)
+        *PendingMacroTexts[I].first = PendingMacroTexts[I].second.str();
+}
+
+void Parser::HandleEnrichmentPasses()
+{
+    // Parsing the comments allocates in the clang AST context and fills the
+    // caches of the comment nodes, so it is done before the threads start.
+    // Each chunk then only reads clang's state and writes to the nodes it was
+    // queued for, which keeps the result independent of the thread order.
+    auto FullComments = ParseFullComments();
+
+    const size_t ChunkSize = 256;
+    std::vector<std::function<void()>> Chunks;
+    for (size_t Begin = 0; Begin < FullComments.size(); Begin += ChunkSize)
+        Chunks.push_back([&, Begin]() {
+            ConvertFullComments(FullComments, Begin,
+                std::min(Begin + ChunkSize, FullComments.size()));
+        });
+    for (size_t Begin = 0; Begin < PendingMacroTexts.size(); Begin += ChunkSize)
+        Chunks.push_back([&, Begin]() {
+            CopyMacroTexts(Begin,
+                std::min(Begin + ChunkSize, PendingMacroTexts.size()));
+        });
+
+    if (Chunks.size() <= 1)
+    {
+        for (auto& Chunk : Chunks)
+            Chunk();
+    }
+    else
+    {
+        llvm::ThreadPool Pool;
+        for (auto& Chunk : Chunks)
+            Pool.async(Chunk);
+        Pool.wait();
+    }
+
+    PendingComments.clear();
+    PendingMacroTexts.clear();
+}
+
 void Parser::HandlePreprocessedEntities(Declaration* Decl)
 {
     using namespace clang;
@@ -3147,6 +3433,13 @@ void Parser::HandlePreprocessedEntities(Declaration* Decl)
 }
 
 AST::Expression* Parser::WalkExpression(clang::Expr* Expr)
+{
+    auto Expression = WalkExpressionStatement(Expr);
+    EvaluateExpression(Expr, Expression);
+    return Expression;
+}
+
+AST::Expression* Parser::WalkExpressionStatement(clang::Expr* Expr)
 {
     using namespace clang;
 
@@ -3232,14 +3525,73 @@ AST::Expression* Parser::WalkExpression(clang::Expr* Expr)
     return new AST::Expression(GetStringFromStatement(Expr));
 }
 
-std::string Parser::GetStringFromStatement(const clang::Stmt* Statement)
+/// Folds a constant expression into the typed value of the expression node.
+void Parser::EvaluateExpression(clang::Expr* Expr, AST::Expression* Expression)
 {
     using namespace clang;
 
-    PrintingPolicy Policy(C->getLangOpts());
+    if (Expr->isTypeDependent() || Expr->isValueDependent())
+        return;
+
+    auto& AST = C->getASTContext();
+    auto Type = Expr->getType();
+
+    if (auto String = dyn_cast<clang::StringLiteral>(Expr->IgnoreParenImpCasts()))
+    {
+        if (String->getCharByteWidth() == 1)
+        {
+            Expression->ValueKind = ExpressionValueKind::String;
+            Expression->StringValue = String->getString();
+        }
+        return;
+    }
+
+    if ((Type->isAnyPointerType() || Type->isNullPtrType() || Type->isMemberPointerType()) &&
+        Expr->isNullPointerConstant(AST, clang::Expr::NPC_ValueDependentIsNotNull) !=
+            clang::Expr::NPCK_NotNull)
+    {
+        Expression->ValueKind = ExpressionValueKind::NullPtr;
+        return;
+    }
+
+    // Also folds references to enumerators and calls to constexpr functions.
+    clang::Expr::EvalResult Result;
+    if (!Expr->EvaluateAsRValue(Result, AST) || Result.HasSideEffects)
+        return;
+
+    auto& Value = Result.Val;
+    if (Value.isInt())
+    {
+        auto& Integer = Value.getInt();
+        if ((Integer.isSigned() ? Integer.getMinSignedBits() : Integer.getActiveBits()) > 64)
+            return;
+
+        if (Type->isBooleanType())
+            Expression->ValueKind = ExpressionValueKind::Boolean;
+        else if (Type->isAnyCharacterType())
+            Expression->ValueKind = ExpressionValueKind::Character;
+        else
+            Expression->ValueKind = Integer.isSigned() ? ExpressionValueKind::SignedInteger
+                : ExpressionValueKind::UnsignedInteger;
+        Expression->IntegerValue = Integer.isSigned() ? Integer.getSExtValue()
+            : Integer.getZExtValue();
+    }
+    else if (Value.isFloat())
+    {
+        auto Float = Value.getFloat();
+        bool LosesInfo;
+        Float.convert(llvm::APFloat::IEEEdouble, llvm::APFloat::rmNearestTiesToEven,
+            &LosesInfo);
+        Expression->ValueKind = ExpressionValueKind::Float;
+        Expression->FloatValue = Float.convertToDouble();
+    }
+}
+
+std::string Parser::GetStringFromStatement(const clang::Stmt* Statement)
+{
     std::string s;
     llvm::raw_string_ostream as(s);
-    Statement->printPretty(as, 0, Policy);
+    Statement->printPretty(as, 0, C->getASTContext().getPrintingPolicy());
     return as.str();
 }
 
@@ -3293,6 +3645,7 @@ void Parser::HandleDeclaration(const clang::Decl* D, Declaration* Decl)
         return;
 
     Decl->OriginalPtr = (void*) D;
+    HandledDeclarations.push_back(Decl);
     Decl->USR = GetDeclUSR(D);
     Decl->IsImplicit = D->isImplicit();
     Decl->Location = SourceLocation(D->getLocation().getRawEncoding());
@@ -3379,7 +3732,6 @@ Declaration* Parser::WalkDeclaration(const clang::Decl* D,
             RD->isCompleteDefinition())
         {
             Record->DefinitionOrder = Index++;
-            //Debug("%d: %s\n", Index++, GetTagDeclName(RD).c_str());
         }
 
         Decl = Record;
@@ -3400,7 +3752,6 @@ Declaration* Parser::WalkDeclaration(const clang::Decl* D,
             RD->isCompleteDefinition())
         {
             Class->DefinitionOrder = Index++;
-            //Debug("%d: %s\n", Index++, GetTagDeclName(RD).c_str());
         }
 
         Decl = Class;
@@ -3633,15 +3984,8 @@ Declaration* Parser::WalkDeclaration(const clang::Decl* D,
         break;
     default:
     {
-        Debug("Unhandled declaration kind: %s\n", D->getDeclKindName());
-
-        auto& SM = C->getSourceManager();
-        auto Loc = D->getLocation();
-        auto FileName = SM.getFilename(Loc);
-        auto Offset = SM.getFileOffset(Loc);
-        auto LineNo = SM.getLineNumber(SM.getFileID(Loc), Offset);
-        Debug("  %s (line %u)\n", FileName.str().c_str(), LineNo);
-
+        HandleUnsupported(D->getLocation(),
+            std::string("Unhandled declaration kind: ") + D->getDeclKindName());
         break;
     } };
 
@@ -3650,15 +3994,29 @@ Declaration* Parser::WalkDeclaration(const clang::Decl* D,
 
 //-----------------------------------//
 
-struct Diagnostic
+static ParserDiagnosticLevel ConvertDiagnosticLevel(clang::DiagnosticsEngine::Level Level)
 {
-    clang::SourceLocation Location;
-    llvm::SmallString<100> Message;
-    clang::DiagnosticsEngine::Level Level;
-};
+    switch (Level)
+    {
+    case clang::DiagnosticsEngine::Ignored:
+        return ParserDiagnosticLevel::Ignored;
+    case clang::DiagnosticsEngine::Note:
+    case clang::DiagnosticsEngine::Remark:
+        return ParserDiagnosticLevel::Note;
+    case clang::DiagnosticsEngine::Warning:
+        return ParserDiagnosticLevel::Warning;
+    case clang::DiagnosticsEngine::Error:
+        return ParserDiagnosticLevel::Error;
+    case clang::DiagnosticsEngine::Fatal:
+        return ParserDiagnosticLevel::Fatal;
+    }
+
+    llvm_unreachable("Unknown diagnostic level");
+}
 
 struct DiagnosticConsumer : public clang::DiagnosticConsumer
 {
+    DiagnosticConsumer(const CppParserOptions* Opts) : Opts(Opts) { }
     virtual ~DiagnosticConsumer() { }
 
     virtual void HandleDiagnostic(clang::DiagnosticsEngine::Level Level,
@@ -3671,135 +4029,463 @@ struct DiagnosticConsumer : public clang::DiagnosticConsumer
             Level == clang::DiagnosticsEngine::Fatal)
             NumErrors++;
 
-        auto Diag = Diagnostic();
-        Diag.Location = Info.getLocation();
-        Diag.Level = Level;
-        Info.FormatDiagnostic(Diag.Message);
-        Diagnostics.push_back(Diag);
-    }
-
-    std::vector<Diagnostic> Diagnostics;
-};
-
-void Parser::HandleDiagnostics(ParserResult* res)
-{
-    auto DiagClient = (DiagnosticConsumer&) C->getDiagnosticClient();
-    auto& Diags = DiagClient.Diagnostics;
+        auto DiagLevel = ConvertDiagnosticLevel(Level);
+        if (DiagLevel < Opts->MinDiagnosticLevel)
+            return;
 
-    // Convert the diagnostics to the managed types
-    for (unsigned I = 0, E = Diags.size(); I != E; ++I)
-    {
-        auto& Diag = DiagClient.Diagnostics[I];
-        auto& Source = C->getSourceManager();
-        auto FileName = Source.getFilename(Source.getFileLoc(Diag.Location));
+        llvm::SmallString<100> Message;
+        Info.FormatDiagnostic(Message);
 
         auto PDiag = ParserDiagnostic();
-        PDiag.FileName = FileName.str();
-        PDiag.Message = Diag.Message.str();
+        PDiag.Message = Message.str();
+        PDiag.Level = DiagLevel;
         PDiag.LineNumber = 0;
         PDiag.ColumnNumber = 0;
 
-        if( !Diag.Location.isInvalid() )
+        auto Location = Info.getLocation();
+        if (Info.hasSourceManager() && Location.isValid())
         {
-             clang::PresumedLoc PLoc = Source.getPresumedLoc(Diag.Location);
-             if( PLoc.isValid() )
-             {
+            auto& Source = Info.getSourceManager();
+            PDiag.FileName = Source.getFilename(Source.getFileLoc(Location)).str();
+
+            clang::PresumedLoc PLoc = Source.getPresumedLoc(Location);
+            if (PLoc.isValid())
+            {
                 PDiag.LineNumber = PLoc.getLine();
                 PDiag.ColumnNumber = PLoc.getColumn();
-             }
+            }
         }
 
-        switch( Diag.Level )
-        {
-        case clang::DiagnosticsEngine::Ignored: 
-            PDiag.Level = ParserDiagnosticLevel::Ignored;
-            break;
-        case clang::DiagnosticsEngine::Note:
-            PDiag.Level = ParserDiagnosticLevel::Note;
-            break;
-        case clang::DiagnosticsEngine::Warning:
-            PDiag.Level = ParserDiagnosticLevel::Warning;
-            break;
-        case clang::DiagnosticsEngine::Error:
-            PDiag.Level = ParserDiagnosticLevel::Error;
-            break;
-        case clang::DiagnosticsEngine::Fatal:
-            PDiag.Level = ParserDiagnosticLevel::Fatal;
-            break;
-        default:
-            assert(0);
-        }
+        if (Opts->DiagnosticHandler)
+            Opts->DiagnosticHandler(&PDiag);
 
-        res->Diagnostics.push_back(PDiag);
+        // Errors are kept even when handled so the result still explains
+        // why the parse failed.
+        if (!Opts->DiagnosticHandler || DiagLevel >= ParserDiagnosticLevel::Error)
+            Diagnostics.push_back(PDiag);
     }
+
+    const CppParserOptions* Opts;
+    std::vector<ParserDiagnostic> Diagnostics;
+};
+
+// Reported as a remark through the diagnostics of the parse, instead of
+// being printed, so concurrent parses keep their reports apart.
+void Parser::HandleUnsupported(clang::SourceLocation Loc, const std::string& Message)
+{
+    auto& Diags = C->getDiagnostics();
+    auto DiagID = Diags.getCustomDiagID(clang::DiagnosticsEngine::Remark, "%0");
+    Diags.Report(Loc, DiagID) << Message;
 }
 
-ParserResult* Parser::ParseHeader(const std::vector<std::string>& SourceFiles, ParserResult* res)
+void Parser::HandleDiagnostics(ParserResult* res)
 {
-    assert(Opts->ASTContext && "Expected a valid ASTContext");
+    auto& DiagClient = (DiagnosticConsumer&) C->getDiagnosticClient();
+    auto& Diags = DiagClient.Diagnostics;
 
-    res->ASTContext = Lib;
+    res->Diagnostics.insert(res->Diagnostics.end(), Diags.begin(), Diags.end());
+    Diags.clear();
+}
 
-    if (SourceFiles.empty())
-    {
-        res->Kind = ParserResultKind::FileNotFound;
-        return res;
-    }
+static std::string GetContentHash(llvm::StringRef Contents)
+{
+    llvm::MD5 Hash;
+    Hash.update(Contents);
 
-    SetupHeader();
+    llvm::MD5::MD5Result Result;
+    Hash.final(Result);
 
-    std::unique_ptr<clang::SemaConsumer> SC(new clang::SemaConsumer());
-    C->setASTConsumer(std::move(SC));
+    llvm::SmallString<32> Text;
+    llvm::MD5::stringifyResult(Result, Text);
+    return Text.str();
+}
 
-    C->createSema(clang::TU_Complete, 0);
+void Parser::HandleIncludes()
+{
+    auto& SM = C->getSourceManager();
 
-    auto DiagClient = new DiagnosticConsumer();
-    C->getDiagnostics().setClient(DiagClient);
+    // Record the include graph, skipping the virtual main files (of the
+    // parse and of its preamble) which only include the source files.
+    for (auto PPEntity : *C->getPreprocessor().getPreprocessingRecord())
+    {
+        auto ID = llvm::dyn_cast<clang::InclusionDirective>(PPEntity);
+        if (!ID || !ID->getFile())
+            continue;
 
-    // Check that the file is reachable.
-    const clang::DirectoryLookup *Dir;
-    llvm::SmallVector<
-        std::pair<const clang::FileEntry *, const clang::DirectoryEntry *>,
-        0> Includers;
+        auto Loc = ID->getSourceRange().getBegin();
+        if (GetLocationKind(Loc) == SourceLocationKind::Invalid ||
+            SM.getFilename(Loc).empty())
+            continue;
 
-    std::vector<const clang::FileEntry*> FileEntries;
-    for (const auto& SourceFile : SourceFiles)
-    {
-        auto FileEntry = C->getPreprocessor().getHeaderSearchInfo().LookupFile(SourceFile,
-            clang::SourceLocation(), /*isAngled*/true,
-            nullptr, Dir, Includers, nullptr, nullptr, nullptr, nullptr);
-        if (!FileEntry)
-        {
-            res->Kind = ParserResultKind::FileNotFound;
-            return res;
-        }
-        FileEntries.push_back(FileEntry);
-    }
+        auto FID = SM.translateFile(ID->getFile());
+        if (FID.isInvalid())
+            continue;
 
-    // Create a virtual file that includes the header. This gets rid of some
-    // Clang warnings about parsing an header file as the main file.
+        auto Includer = GetTranslationUnit(Loc);
+        auto Included = GetTranslationUnit(SM.getLocForStartOfFile(FID));
+        if (Includer == Included)
+            continue;
 
-    std::string str;
-    for (const auto& SourceFile : SourceFiles)
-    {
-        str += "#include \"" + SourceFile + "\"" + "\n";
+        auto& Includes = Includer->Includes;
+        if (std::find(Includes.begin(), Includes.end(), Included->FileName) ==
+            Includes.end())
+            Includes.push_back(Included->FileName);
     }
-    str += "\0";
 
-    auto buffer = llvm::MemoryBuffer::getMemBuffer(str);
-    auto& SM = C->getSourceManager();
-    SM.setMainFileID(SM.createFileID(std::move(buffer)));
+    for (auto It = SM.fileinfo_begin(); It != SM.fileinfo_end(); ++It)
+    {
+        auto Buffer = It->second->getRawBuffer();
+        if (!Buffer)
+            continue;
 
-    clang::DiagnosticConsumer* client = C->getDiagnostics().getClient();
-    client->BeginSourceFile(C->getLangOpts(), &C->getPreprocessor());
+        auto FID = SM.translateFile(It->first);
+        if (FID.isInvalid())
+            continue;
 
-    ParseAST(C->getSema(), /*PrintStats=*/false, /*SkipFunctionBodies=*/true);
+        auto Unit = GetTranslationUnit(SM.getLocForStartOfFile(FID));
+        Unit->ContentHash = GetContentHash(Buffer->getBuffer());
+    }
+}
 
-    client->EndSourceFile();
+/// Finds a source file the way the header search of the parse would, before
+/// the compiler is set up.
+static std::string FindSourceFile(clang::vfs::FileSystem& FS,
+    const CppParserOptions* Opts, const std::string& File)
+{
+    if (llvm::sys::path::is_absolute(File))
+        return File;
 
-    HandleDiagnostics(res);
+    auto Dirs = Opts->IncludeDirs;
+    Dirs.insert(Dirs.end(), Opts->SystemIncludeDirs.begin(),
+        Opts->SystemIncludeDirs.end());
 
-    if(client->getNumErrors() != 0)
+    for (const auto& Dir : Dirs)
+    {
+        llvm::SmallString<256> Path(Dir);
+        llvm::sys::path::append(Path, File);
+        if (FS.status(Path))
+            return Path.str();
+    }
+
+    return std::string();
+}
+
+/// Checks if the units of the source files and of their transitive includes
+/// match the files on disk. Otherwise the stale units are dropped from the
+/// context so that the reparse replaces them. This runs before the compiler
+/// is set up, so an unchanged reparse costs no more than reading the files.
+bool Parser::IsUpToDate(const std::vector<std::string>& SourceFiles)
+{
+    auto FS = Opts->VirtualFiles.empty() ? clang::vfs::getRealFileSystem() :
+        CreateVirtualFileSystem(Opts);
+
+    std::vector<TranslationUnit*> Pending;
+    bool HasAllUnits = true;
+
+    for (const auto& SourceFile : SourceFiles)
+    {
+        auto Path = FindSourceFile(*FS, Opts, SourceFile);
+        if (auto Unit = Path.empty() ? nullptr : Lib->FindModule(Path))
+            Pending.push_back(Unit);
+        else
+            HasAllUnits = false;
+    }
+
+    // Find the changed files among the transitive includes of the sources.
+    std::unordered_set<TranslationUnit*> Visited;
+    std::vector<TranslationUnit*> Changed;
+
+    while (!Pending.empty())
+    {
+        auto Unit = Pending.back();
+        Pending.pop_back();
+
+        if (!Visited.insert(Unit).second)
+            continue;
+
+        auto Buffer = FS->getBufferForFile(Unit->FileName);
+        bool IsChanged = Unit->ContentHash.empty() || !Buffer ||
+            GetContentHash((*Buffer)->getBuffer()) != Unit->ContentHash;
+
+        for (const auto& Include : Unit->Includes)
+        {
+            if (auto Included = Lib->FindModule(Include))
+                Pending.push_back(Included);
+            else
+                IsChanged = true;
+        }
+
+        if (IsChanged)
+            Changed.push_back(Unit);
+    }
+
+    if (Changed.empty())
+        return HasAllUnits;
+
+    // Drop the changed units and every unit that includes them, directly or
+    // not, so they are created again by the reparse. The context keeps the
+    // dropped units until it is destroyed, as declarations of other units may
+    // still point to them.
+    std::unordered_map<std::string, std::vector<TranslationUnit*>> Includers;
+    for (auto Unit : Lib->TranslationUnits)
+        for (const auto& Include : Unit->Includes)
+            Includers[Include].push_back(Unit);
+
+    std::unordered_set<TranslationUnit*> Stale;
+    while (!Changed.empty())
+    {
+        auto Unit = Changed.back();
+        Changed.pop_back();
+
+        if (!Stale.insert(Unit).second)
+            continue;
+
+        auto It = Includers.find(Unit->FileName);
+        if (It != Includers.end())
+            Changed.insert(Changed.end(), It->second.begin(), It->second.end());
+    }
+
+    auto& Units = Lib->TranslationUnits;
+    auto StaleBegin = std::stable_partition(Units.begin(), Units.end(),
+        [&](TranslationUnit* Unit) { return Stale.count(Unit) == 0; });
+    Lib->StaleUnits.insert(Lib->StaleUnits.end(), StaleBegin, Units.end());
+    Units.erase(StaleBegin, Units.end());
+
+    return false;
+}
+
+static std::string GetIncludes(std::vector<std::string>::const_iterator Begin,
+    std::vector<std::string>::const_iterator End)
+{
+    std::string Includes;
+    for (auto It = Begin; It != End; ++It)
+        Includes += "#include \"" + *It + "\"" + "\n";
+    return Includes;
+}
+
+/// Returns the path of the precompiled preamble for the given includes,
+/// which is keyed on them and on every option that changes how they parse.
+std::string Parser::GetPreamblePath(const std::string& Includes)
+{
+    std::string Key = Includes;
+    for (auto Arg : GetCompilerArguments(Opts))
+        Key += std::string(Arg) + "\n";
+
+    for (const auto& Options : { Opts->IncludeDirs, Opts->SystemIncludeDirs,
+        Opts->Defines, Opts->Undefines })
+        for (const auto& Option : Options)
+            Key += Option + "\n";
+
+    Key += Opts->TargetTriple + "\n" + std::to_string((int)Opts->Abi);
+
+    llvm::SmallString<128> Path;
+    llvm::sys::path::system_temp_directory(/*erasedOnReboot=*/true, Path);
+    llvm::sys::path::append(Path, "CppSharp-" + GetContentHash(Key) + ".pch");
+    return Path.str();
+}
+
+bool Parser::BuildPreamble(const std::string& Includes, const std::string& Path,
+    ParserResult* res)
+{
+    SetupHeader();
+
+    auto Buffer = std::make_shared<clang::PCHBuffer>();
+    C->setASTConsumer(llvm::make_unique<clang::PCHGenerator>(
+        C->getPreprocessor(), Path, /*isysroot=*/"", Buffer,
+        llvm::ArrayRef<llvm::IntrusiveRefCntPtr<clang::ModuleFileExtension>>()));
+    C->createSema(clang::TU_Prefix, 0);
+
+    auto DiagClient = new DiagnosticConsumer(Opts);
+    C->getDiagnostics().setClient(DiagClient);
+
+    auto& SM = C->getSourceManager();
+    SM.setMainFileID(SM.createFileID(llvm::MemoryBuffer::getMemBufferCopy(Includes)));
+
+    DiagClient->BeginSourceFile(C->getLangOpts(), &C->getPreprocessor());
+    ParseAST(C->getSema(), /*PrintStats=*/false, /*SkipFunctionBodies=*/true);
+    DiagClient->EndSourceFile();
+
+    if (res)
+        HandleDiagnostics(res);
+
+    if (DiagClient->getNumErrors() != 0 || !Buffer->IsComplete)
+        return false;
+
+    // Write to a unique file first so concurrent parses never read a
+    // partially written preamble.
+    int FD;
+    llvm::SmallString<128> TempPath;
+    if (llvm::sys::fs::createUniqueFile(Path + "-%%%%%%%%", FD, TempPath))
+        return false;
+
+    {
+        llvm::raw_fd_ostream OS(FD, /*shouldClose=*/true);
+        OS.write(Buffer->Data.data(), Buffer->Data.size());
+    }
+
+    if (llvm::sys::fs::rename(TempPath, Path))
+    {
+        llvm::sys::fs::remove(TempPath);
+        return false;
+    }
+
+    return true;
+}
+
+bool Parser::LoadPreamble(const std::string& Path)
+{
+    // An out of date preamble is rebuilt, so do not report it as an error.
+    auto& Diags = C->getDiagnostics();
+    Diags.setSuppressAllDiagnostics(true);
+
+    C->createPCHExternalASTSource(Path, /*DisablePCHValidation=*/false,
+        /*AllowPCHWithCompilerErrors=*/false, /*DeserializationListener=*/nullptr,
+        /*OwnDeserializationListener=*/false);
+
+    Diags.setSuppressAllDiagnostics(false);
+    return C->getASTContext().getExternalSource() != nullptr;
+}
+
+/// Sets up the compiler with the precompiled preamble of the includes. The
+/// preamble is rebuilt when it is missing or when one of the files it was
+/// built from changed.
+bool Parser::SetupPreamble(const std::string& Includes)
+{
+    auto Path = GetPreamblePath(Includes);
+
+    if (llvm::sys::fs::exists(Path))
+    {
+        SetupHeader();
+        if (LoadPreamble(Path))
+            return true;
+    }
+
+    if (!BuildPreamble(Includes, Path))
+        return false;
+
+    SetupHeader();
+    return LoadPreamble(Path);
+}
+
+ParserResult* Parser::PrecompileHeader(const std::vector<std::string>& SourceFiles,
+    ParserResult* res)
+{
+    res->ASTContext = Lib;
+
+    if (SourceFiles.empty())
+    {
+        res->Kind = ParserResultKind::FileNotFound;
+        return res;
+    }
+
+    SetupHeader();
+    auto OutputFile = C->getFrontendOpts().OutputFile;
+
+    auto Includes = GetIncludes(SourceFiles.begin(), SourceFiles.end());
+    res->Kind = !OutputFile.empty() && BuildPreamble(Includes, OutputFile, res) ?
+        ParserResultKind::Success : ParserResultKind::Error;
+    return res;
+}
+
+ParserResult* Parser::ParseHeader(const std::vector<std::string>& SourceFiles, ParserResult* res)
+{
+    assert(Opts->ASTContext && "Expected a valid ASTContext");
+
+    res->ASTContext = Lib;
+
+    if (SourceFiles.empty())
+    {
+        res->Kind = ParserResultKind::FileNotFound;
+        return res;
+    }
+
+    // Precompile the includes of all but the last source file, so repeated
+    // parses of the same headers only parse the last one.
+    auto Preamble = SourceFiles.size() > 1 && Opts->PrecompiledPreamble &&
+        std::find(Opts->Arguments.begin(), Opts->Arguments.end(),
+            "-include-pch") == Opts->Arguments.end();
+    auto PreambleIncludes = GetIncludes(SourceFiles.begin(), SourceFiles.end() - 1);
+
+    if (Opts->Incremental)
+    {
+        std::lock_guard<ASTContext> LibLock(*Lib);
+        if (IsUpToDate(SourceFiles))
+        {
+            res->Kind = ParserResultKind::Success;
+            return res;
+        }
+    }
+
+    if (!Preamble || !SetupPreamble(PreambleIncludes))
+    {
+        Preamble = false;
+        SetupHeader();
+    }
+
+    // The source files are all in the precompiled header, if one is given.
+    auto Precompiled = !PrecompiledHeader.empty();
+    if (Precompiled && !LoadPreamble(PrecompiledHeader))
+    {
+        auto PDiag = ParserDiagnostic();
+        PDiag.FileName = PrecompiledHeader;
+        PDiag.Message = "Could not load the precompiled header";
+        PDiag.Level = ParserDiagnosticLevel::Error;
+        PDiag.LineNumber = 0;
+        PDiag.ColumnNumber = 0;
+        res->Diagnostics.push_back(PDiag);
+        res->Kind = ParserResultKind::Error;
+        return res;
+    }
+
+    std::unique_ptr<clang::SemaConsumer> SC(new clang::SemaConsumer());
+    C->setASTConsumer(std::move(SC));
+
+    C->createSema(clang::TU_Complete, 0);
+
+    auto DiagClient = new DiagnosticConsumer(Opts);
+    C->getDiagnostics().setClient(DiagClient);
+
+    // Check that the file is reachable.
+    const clang::DirectoryLookup *Dir;
+    llvm::SmallVector<
+        std::pair<const clang::FileEntry *, const clang::DirectoryEntry *>,
+        0> Includers;
+
+    std::vector<const clang::FileEntry*> FileEntries;
+    for (const auto& SourceFile : SourceFiles)
+    {
+        auto FileEntry = C->getPreprocessor().getHeaderSearchInfo().LookupFile(SourceFile,
+            clang::SourceLocation(), /*isAngled*/true,
+            nullptr, Dir, Includers, nullptr, nullptr, nullptr, nullptr);
+        if (!FileEntry)
+        {
+            res->Kind = ParserResultKind::FileNotFound;
+            return res;
+        }
+        FileEntries.push_back(FileEntry);
+    }
+
+    // Create a virtual file that includes the header. This gets rid of some
+    // Clang warnings about parsing an header file as the main file.
+
+    auto FirstSource = Precompiled ? SourceFiles.end() :
+        Preamble ? SourceFiles.end() - 1 : SourceFiles.begin();
+    auto str = GetIncludes(FirstSource, SourceFiles.end());
+
+    auto buffer = llvm::MemoryBuffer::getMemBuffer(str);
+    auto& SM = C->getSourceManager();
+    SM.setMainFileID(SM.createFileID(std::move(buffer)));
+
+    clang::DiagnosticConsumer* client = C->getDiagnostics().getClient();
+    client->BeginSourceFile(C->getLangOpts(), &C->getPreprocessor());
+
+    ParseAST(C->getSema(), /*PrintStats=*/false, /*SkipFunctionBodies=*/true);
+
+    client->EndSourceFile();
+
+    HandleDiagnostics(res);
+
+    if(client->getNumErrors() != 0)
     {
         res->Kind = ParserResultKind::Error;
         return res;
@@ -3807,6 +4493,10 @@ ParserResult* Parser::ParseHeader(const std::vector<std::string>& SourceFiles, P
 
     AST = &C->getASTContext();
 
+    // Parses sharing a context only walk one at a time, the rest of the
+    // parse runs concurrently.
+    std::lock_guard<ASTContext> LibLock(*Lib);
+
     auto FileEntry = FileEntries[0];
     auto FileName = FileEntry->getName();
     auto Unit = Lib->FindOrCreateModule(FileName);
@@ -3815,7 +4505,10 @@ ParserResult* Parser::ParseHeader(const std::vector<std::string>& SourceFiles, P
     HandleDeclaration(TU, Unit);
 
     if (Unit->OriginalPtr == nullptr)
+    {
         Unit->OriginalPtr = (void*)FileEntry;
+        HandledDeclarations.push_back(Unit);
+    }
 
     // Initialize enough Clang codegen machinery so we can get at ABI details.
     llvm::LLVMContext Ctx;
@@ -3834,11 +4527,49 @@ ParserResult* Parser::ParseHeader(const std::vector<std::string>& SourceFiles, P
     CodeGenTypes = CGT.get();
 
     WalkAST();
+    HandleEnrichmentPasses();
+    if (Opts->Incremental)
+        HandleIncludes();
+    HandleDiagnostics(res);
 
+    res->CodeGenInfoLookups = CodeGenInfoLookups;
+    res->CodeGenInfoCacheHits = CodeGenInfoCacheHits;
     res->Kind = ParserResultKind::Success;
     return res;
  }
 
+static MappedSymbolTable* CreateMappedSymbols(const CppParserOptions* Opts,
+    const llvm::object::Binary* Binary)
+{
+    // Symbol ranges are 32-bit so bigger files fall back to copied symbols.
+    auto Data = Binary->getData();
+    if (!Opts->MappedSymbols || Data.size() > std::numeric_limits<unsigned>::max())
+        return nullptr;
+
+    return new MappedSymbolTable(Data.data(), Data.size());
+}
+
+static void AddSymbol(CppSharp::CppParser::NativeLibrary* NativeLib,
+    llvm::StringRef Symbol)
+{
+    if (Symbol.empty())
+        return;
+
+    // Symbols in the mapped library only keep their range, as long as they
+    // are null-terminated there so they can be handed out in place.
+    auto Mapped = NativeLib->MappedSymbols;
+    if (!Mapped || Symbol.data() < Mapped->Data ||
+        Symbol.end() >= Mapped->Data + Mapped->Size || *Symbol.end() != '\0')
+    {
+        NativeLib->Symbols.push_back(Symbol);
+        return;
+    }
+
+    MappedSymbolTable::Range Range = { unsigned(Symbol.data() - Mapped->Data),
+        unsigned(Symbol.size()) };
+    Mapped->Symbols.push_back(Range);
+}
+
 ParserResultKind Parser::ParseArchive(llvm::StringRef File,
                                       llvm::object::Archive* Archive,
                                       CppSharp::CppParser::NativeLibrary*& NativeLib)
@@ -3846,11 +4577,12 @@ ParserResultKind Parser::ParseArchive(llvm::StringRef File,
     auto LibName = File;
     NativeLib = new NativeLibrary();
     NativeLib->FileName = LibName;
+    NativeLib->MappedSymbols = CreateMappedSymbols(Opts, Archive);
 
     for(auto it = Archive->symbol_begin(); it != Archive->symbol_end(); ++it)
     {
         llvm::StringRef SymRef = it->getName();
-        NativeLib->Symbols.push_back(SymRef);
+        AddSymbol(NativeLib, SymRef);
     }
 
     return ParserResultKind::Success;
@@ -3871,9 +4603,39 @@ static ArchType ConvertArchType(unsigned int archType)
 template<class ELFT>
 static void ReadELFDependencies(const llvm::object::ELFFile<ELFT>* ELFFile, CppSharp::CppParser::NativeLibrary*& NativeLib)
 {
-    ELFDumper<ELFT> ELFDumper(ELFFile);
-    for (const auto& Dependency : ELFDumper.getNeededLibraries())
+    auto Dumper = std::make_shared<ELFDumper<ELFT>>(ELFFile);
+    for (const auto& Dependency : Dumper->getNeededLibraries())
         NativeLib->Dependencies.push_back(Dependency);
+
+    // Mapped libraries with a hash table answer symbol queries through it,
+    // which also gives the versions of the symbols.
+    auto Mapped = NativeLib->MappedSymbols;
+    if (!Mapped || !Dumper->hasHashTable())
+        return;
+
+    Mapped->ExportedSymbolLookup = [Dumper](const char* Symbol,
+        unsigned Length, const char** Version) {
+        auto Sym = Dumper->findExportedSymbol(llvm::StringRef(Symbol, Length));
+        if (Sym && Version)
+        {
+            auto SymbolVersion = Dumper->getSymbolVersion(Sym);
+            *Version = SymbolVersion.empty() ? nullptr : SymbolVersion.data();
+        }
+        return Sym != nullptr;
+    };
+}
+
+static void ReadELFDependencies(llvm::object::ObjectFile* ObjectFile,
+    CppSharp::CppParser::NativeLibrary*& NativeLib)
+{
+    if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF32LEObjectFile>(ObjectFile))
+        ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
+    else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF32BEObjectFile>(ObjectFile))
+        ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
+    else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF64LEObjectFile>(ObjectFile))
+        ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
+    else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF64BEObjectFile>(ObjectFile))
+        ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
 }
 
 ParserResultKind Parser::ParseSharedLib(llvm::StringRef File,
@@ -3884,37 +4646,23 @@ ParserResultKind Parser::ParseSharedLib(llvm::StringRef File,
     NativeLib = new NativeLibrary();
     NativeLib->FileName = LibName;
     NativeLib->ArchType = ConvertArchType(ObjectFile->getArch());
+    NativeLib->MappedSymbols = CreateMappedSymbols(Opts, ObjectFile);
 
     if (ObjectFile->isELF())
     {
+        ReadELFDependencies(ObjectFile, NativeLib);
+
         auto IDyn = llvm::cast<llvm::object::ELFObjectFileBase>(ObjectFile)->getDynamicSymbolIterators();
         for (auto it = IDyn.begin(); it != IDyn.end(); ++it)
         {
-            std::string Sym;
-            llvm::raw_string_ostream SymStream(Sym);
-
-            if (it->printName(SymStream))
+            auto SymOrErr = it->getName();
+            if (!SymOrErr)
+            {
+                llvm::consumeError(SymOrErr.takeError());
                 continue;
+            }
 
-            SymStream.flush();
-            if (!Sym.empty())
-                NativeLib->Symbols.push_back(Sym);
-        }
-        if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF32LEObjectFile>(ObjectFile))
-        {
-            ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
-        }
-        else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF32BEObjectFile>(ObjectFile))
-        {
-            ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
-        }
-        else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF64LEObjectFile>(ObjectFile))
-        {
-            ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
-        }
-        else if (auto ELFObjectFile = llvm::dyn_cast<llvm::object::ELF64BEObjectFile>(ObjectFile))
-        {
-            ReadELFDependencies(ELFObjectFile->getELFFile(), NativeLib);
+            AddSymbol(NativeLib, SymOrErr.get());
         }
         return ParserResultKind::Success;
     }
@@ -3926,7 +4674,7 @@ ParserResultKind Parser::ParseSharedLib(llvm::StringRef File,
         {
             llvm::StringRef Symbol;
             if (!ExportedSymbol.getSymbolName(Symbol))
-                NativeLib->Symbols.push_back(Symbol);
+                AddSymbol(NativeLib, Symbol);
         }
         for (auto ImportedSymbol : COFFObjectFile->import_directories())
         {
@@ -3954,9 +4702,27 @@ ParserResultKind Parser::ParseSharedLib(llvm::StringRef File,
                 NativeLib->Dependencies.push_back(lib);
             }
         }
+        // Export trie entries are assembled on the fly so they cannot point
+        // into the mapped file; pack them into the table's own pool.
+        auto Mapped = NativeLib->MappedSymbols;
         for (const auto& Entry : MachOObjectFile->exports())
         {
-            NativeLib->Symbols.push_back(Entry.name());
+            auto Name = Entry.name();
+            if (!Mapped)
+            {
+                NativeLib->Symbols.push_back(Name);
+                continue;
+            }
+            MappedSymbolTable::Range Range = { unsigned(Mapped->Pool.size()),
+                unsigned(Name.size()) };
+            Mapped->Pool.append(Name.data(), Name.size());
+            Mapped->Pool.push_back('\0');
+            Mapped->Symbols.push_back(Range);
+        }
+        if (Mapped)
+        {
+            Mapped->Data = Mapped->Pool.data();
+            Mapped->Size = Mapped->Pool.size();
         }
         return ParserResultKind::Success;
     }
@@ -3989,15 +4755,10 @@ ParserResultKind Parser::ReadSymbols(llvm::StringRef File,
     return ParserResultKind::Success;
 }
 
-ParserResult* Parser::ParseLibrary(const std::string& File, ParserResult* res)
+std::string Parser::FindLibrary(const std::string& File)
 {
     if (File.empty())
-    {
-        res->Kind = ParserResultKind::FileNotFound;
-        return res;
-    }
-
-    llvm::StringRef FileEntry;
+        return std::string();
 
     for (unsigned I = 0, E = Opts->LibraryDirs.size(); I != E; ++I)
     {
@@ -4005,39 +4766,216 @@ ParserResult* Parser::ParseLibrary(const std::string& File, ParserResult* res)
         llvm::SmallString<256> Path(LibDir);
         llvm::sys::path::append(Path, File);
 
-        if (!(FileEntry = Path.str()).empty() && llvm::sys::fs::exists(FileEntry))
-            break;
+        if (llvm::sys::fs::exists(Path.str()))
+            return Path.str();
     }
 
-    if (FileEntry.empty())
+    return std::string();
+}
+
+ParserResultKind Parser::ReadLibrary(llvm::StringRef File, llvm::StringRef Path,
+                                     CppSharp::CppParser::NativeLibrary*& NativeLib)
+{
+    auto BinaryOrErr = llvm::object::createBinary(Path);
+    if (!BinaryOrErr)
+    {
+        llvm::consumeError(BinaryOrErr.takeError());
+        return ParserResultKind::Error;
+    }
+    auto OwningBinary = std::move(BinaryOrErr.get());
+    auto Bin = OwningBinary.getBinary();
+
+    auto Kind = ParserResultKind::Error;
+    if (auto Archive = llvm::dyn_cast<llvm::object::Archive>(Bin))
+        Kind = ParseArchive(File, Archive, NativeLib);
+    else if (auto ObjectFile = llvm::dyn_cast<llvm::object::ObjectFile>(Bin))
+        Kind = ParseSharedLib(File, ObjectFile, NativeLib);
+
+    if (Kind != ParserResultKind::Success)
+        return Kind;
+
+    // Mapped symbols point into the binary so keep it alive with the library.
+    auto Mapped = NativeLib->MappedSymbols;
+    if (Mapped && Mapped->Pool.empty())
+        Mapped->Storage = std::make_shared<
+            llvm::object::OwningBinary<llvm::object::Binary>>(std::move(OwningBinary));
+
+    if (!Mapped || !Mapped->ExportedSymbolLookup)
+        NativeLib->BuildSymbolIndex();
+    return Kind;
+}
+
+ParserResult* Parser::ParseLibrary(const std::string& File, ParserResult* res)
+{
+    auto Path = FindLibrary(File);
+    if (Path.empty())
     {
         res->Kind = ParserResultKind::FileNotFound;
         return res;
     }
 
-    auto BinaryOrErr = llvm::object::createBinary(FileEntry);
-    if (!BinaryOrErr)
+    res->Kind = ReadLibrary(File, Path, res->Library);
+    return res;
+}
+
+ParserResult* Parser::ParseLibraries(const std::vector<std::string>& Files,
+                                     ParserResult* res)
+{
+    res->Kind = ParserResultKind::Success;
+
+    // Resolve every library once up front, the reading is then independent
+    // for each binary and can run on the thread pool.
+    std::vector<std::string> Paths;
+    for (const auto& File : Files)
     {
-        res->Kind = ParserResultKind::Error;
-        return res;
+        Paths.push_back(FindLibrary(File));
+        if (!Paths.back().empty())
+            continue;
+
+        auto PDiag = ParserDiagnostic();
+        PDiag.FileName = File;
+        PDiag.Message = "Library not found in the library directories";
+        PDiag.Level = ParserDiagnosticLevel::Error;
+        PDiag.LineNumber = 0;
+        PDiag.ColumnNumber = 0;
+        res->Diagnostics.push_back(PDiag);
+        res->Kind = ParserResultKind::FileNotFound;
     }
-    auto OwningBinary = std::move(BinaryOrErr.get());
-    auto Bin = OwningBinary.getBinary();
-    if (auto Archive = llvm::dyn_cast<llvm::object::Archive>(Bin)) {
-        res->Kind = ParseArchive(File, Archive, res->Library);
-        if (res->Kind == ParserResultKind::Success)
-            return res;
+
+    std::vector<NativeLibrary*> Libraries(Files.size());
+    std::vector<ParserResultKind> Kinds(Files.size(), ParserResultKind::FileNotFound);
+    {
+        llvm::ThreadPool Pool;
+        for (unsigned I = 0, E = Files.size(); I != E; ++I)
+        {
+            if (Paths[I].empty())
+                continue;
+
+            Pool.async([&, I]() {
+                Parser LibParser(Opts);
+                Kinds[I] = LibParser.ReadLibrary(Files[I], Paths[I], Libraries[I]);
+            });
+        }
+        Pool.wait();
     }
-    if (auto ObjectFile = llvm::dyn_cast<llvm::object::ObjectFile>(Bin))
+
+    for (unsigned I = 0, E = Files.size(); I != E; ++I)
     {
-        res->Kind = ParseSharedLib(File, ObjectFile, res->Library);
+        if (Kinds[I] == ParserResultKind::Success)
+        {
+            res->Libraries.push_back(Libraries[I]);
+            continue;
+        }
+
+        delete Libraries[I];
+        if (Kinds[I] != ParserResultKind::Error)
+            continue;
+
+        auto PDiag = ParserDiagnostic();
+        PDiag.FileName = Files[I];
+        PDiag.Message = "Could not read the symbols of the library";
+        PDiag.Level = ParserDiagnosticLevel::Error;
+        PDiag.LineNumber = 0;
+        PDiag.ColumnNumber = 0;
+        res->Diagnostics.push_back(PDiag);
         if (res->Kind == ParserResultKind::Success)
-            return res;
+            res->Kind = ParserResultKind::Error;
     }
-    res->Kind = ParserResultKind::Error;
+
     return res;
 }
 
+static void CollectTargetDeclarations(DeclarationContext* Context,
+    std::unordered_map<std::string, Declaration*>& Declarations);
+
+static void CollectTargetDeclarations(Class* RC,
+    std::unordered_map<std::string, Declaration*>& Declarations)
+{
+    // Forward declarations share the USR of the definition.
+    if (RC->IsIncomplete)
+        return;
+
+    Declarations.emplace(RC->USR, RC);
+    for (auto Method : RC->Methods)
+        Declarations.emplace(Method->USR, Method);
+
+    CollectTargetDeclarations(static_cast<DeclarationContext*>(RC), Declarations);
+}
+
+/// Collects the declarations with target dependent details by USR.
+static void CollectTargetDeclarations(DeclarationContext* Context,
+    std::unordered_map<std::string, Declaration*>& Declarations)
+{
+    for (auto NS : Context->Namespaces)
+        CollectTargetDeclarations(NS, Declarations);
+
+    for (auto Function : Context->Functions)
+        Declarations.emplace(Function->USR, Function);
+
+    for (auto RC : Context->Classes)
+        CollectTargetDeclarations(RC, Declarations);
+
+    for (auto Template : Context->Templates)
+    {
+        if (Template->Kind != DeclarationKind::ClassTemplate)
+            continue;
+
+        for (auto Spec : static_cast<ClassTemplate*>(Template)->Specializations)
+            CollectTargetDeclarations(Spec, Declarations);
+    }
+}
+
+static void AddTargetLayouts(std::unordered_map<std::string, Declaration*>& Declarations,
+    ASTContext* TargetContext, unsigned Target, unsigned TargetsCount)
+{
+    std::unordered_map<std::string, Declaration*> TargetDeclarations;
+    for (auto Unit : TargetContext->TranslationUnits)
+        CollectTargetDeclarations(Unit, TargetDeclarations);
+
+    for (const auto& Entry : TargetDeclarations)
+    {
+        auto It = Declarations.find(Entry.first);
+        if (Entry.first.empty() || It == Declarations.end() ||
+            It->second->Kind != Entry.second->Kind)
+            continue;
+
+        switch (It->second->Kind)
+        {
+        case DeclarationKind::Class:
+        case DeclarationKind::ClassTemplateSpecialization:
+        case DeclarationKind::ClassTemplatePartialSpecialization:
+        {
+            auto RC = static_cast<Class*>(It->second);
+            auto TargetRC = static_cast<Class*>(Entry.second);
+            RC->TargetLayouts.resize(TargetsCount);
+            RC->TargetLayouts[Target] = TargetRC->Layout;
+            TargetRC->Layout = 0;
+            break;
+        }
+        case DeclarationKind::Function:
+        case DeclarationKind::Method:
+        {
+            auto F = static_cast<Function*>(It->second);
+            auto TargetF = static_cast<Function*>(Entry.second);
+
+            FunctionTargetLayout Layout;
+            Layout.Mangled = TargetF->Mangled;
+            Layout.IsReturnIndirect = TargetF->IsReturnIndirect;
+            Layout.HasThisReturn = TargetF->HasThisReturn;
+            for (unsigned I = 0, E = TargetF->Parameters.size(); I != E; ++I)
+                if (TargetF->Parameters[I]->IsIndirect)
+                    Layout.IndirectParameters.push_back(I);
+
+            F->TargetLayouts.resize(TargetsCount);
+            F->TargetLayouts[Target] = Layout;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
 ParserResult* ClangParser::ParseHeader(CppParserOptions* Opts)
 {
     if (!Opts)
@@ -4045,7 +4983,100 @@ ParserResult* ClangParser::ParseHeader(CppParserOptions* Opts)
 
     auto res = new ParserResult();
     res->CodeParser = new Parser(Opts);
-    return res->CodeParser->ParseHeader(Opts->SourceFiles, res);
+
+    // Let the parser server precompile the source files with its warm
+    // caches, so that only the declarations are read back here.
+    std::string PrecompiledHeader;
+    if (PrecompileOnServer(Opts, res, PrecompiledHeader))
+    {
+        if (res->Kind != ParserResultKind::Success)
+            return res;
+
+        Opts->Arguments.push_back("-include-pch");
+        Opts->Arguments.push_back(PrecompiledHeader);
+        res->CodeParser->ParseHeader(Opts->SourceFiles, res);
+        Opts->Arguments.resize(Opts->Arguments.size() - 2);
+        return res;
+    }
+
+    if (Opts->Targets.empty())
+        return res->CodeParser->ParseHeader(Opts->SourceFiles, res);
+
+    // Every target needs its own compiler instance, so the additional targets
+    // are parsed concurrently into their own contexts and only their target
+    // dependent details are kept.
+    auto TargetsCount = Opts->Targets.size();
+    std::vector<CppParserOptions> TargetOpts(TargetsCount, *Opts);
+    std::vector<std::unique_ptr<ParserResult>> TargetResults(TargetsCount);
+    {
+        llvm::ThreadPool Pool;
+        for (unsigned I = 0; I != TargetsCount; ++I)
+        {
+            auto& TargetOpt = TargetOpts[I];
+            TargetOpt.TargetTriple = Opts->Targets[I].TargetTriple;
+            TargetOpt.Abi = Opts->Targets[I].Abi;
+            TargetOpt.MicrosoftMode = Opts->Targets[I].MicrosoftMode;
+            TargetOpt.Targets.clear();
+            TargetOpt.ASTContext = new ASTContext();
+            TargetOpt.Incremental = false;
+            TargetOpt.DiagnosticHandler = 0;
+
+            Pool.async([&, I]() {
+                TargetResults[I].reset(ClangParser::ParseHeader(&TargetOpts[I]));
+            });
+        }
+
+        res->CodeParser->ParseHeader(Opts->SourceFiles, res);
+        Pool.wait();
+    }
+
+    std::unordered_map<std::string, Declaration*> Declarations;
+    if (res->Kind == ParserResultKind::Success)
+        for (auto Unit : Opts->ASTContext->TranslationUnits)
+            CollectTargetDeclarations(Unit, Declarations);
+
+    for (unsigned I = 0; I != TargetsCount; ++I)
+    {
+        auto TargetRes = TargetResults[I].get();
+        for (auto PDiag : TargetRes->Diagnostics)
+        {
+            PDiag.Message = Opts->Targets[I].TargetTriple + ": " + PDiag.Message;
+            if (Opts->DiagnosticHandler)
+                Opts->DiagnosticHandler(&PDiag);
+            if (!Opts->DiagnosticHandler || PDiag.Level >= ParserDiagnosticLevel::Error)
+                res->Diagnostics.push_back(PDiag);
+        }
+
+        if (TargetRes->Kind != ParserResultKind::Success)
+        {
+            if (res->Kind == ParserResultKind::Success)
+                res->Kind = TargetRes->Kind;
+        }
+        else if (res->Kind == ParserResultKind::Success)
+        {
+            AddTargetLayouts(Declarations, TargetOpts[I].ASTContext, I, TargetsCount);
+        }
+
+        // The parser rebases the pointers of the nodes it walked when it is
+        // destroyed, so it goes before the context they belong to.
+        TargetResults[I].reset();
+
+        for (auto Unit : TargetOpts[I].ASTContext->TranslationUnits)
+            delete Unit;
+        delete TargetOpts[I].ASTContext;
+    }
+
+    return res;
+}
+
+ParserResult* ClangParser::PrecompileHeader(CppParserOptions* Opts)
+{
+    if (!Opts)
+        return nullptr;
+
+    auto res = new ParserResult();
+    res->CodeParser = new Parser(Opts);
+    return res->CodeParser->PrecompileHeader(Opts->SourceFiles, res);
 }
 
 ParserResult* ClangParser::ParseLibrary(CppParserOptions* Opts)
@@ -4055,53 +5086,83 @@ ParserResult* ClangParser::ParseLibrary(CppParserOptions* Opts)
 
     auto res = new ParserResult();
     res->CodeParser = new Parser(Opts);
+    if (ParseLibraryOnServer(Opts, res))
+        return res;
+
     return res->CodeParser->ParseLibrary(Opts->LibraryFile, res);
 }
 
-ParserTargetInfo* ClangParser::GetTargetInfo(CppParserOptions* Opts)
+// Target info only depends on the target triple and the compiler arguments,
+// so we cache it per process to avoid recomputing it on every parse.
+static std::mutex TargetInfoCacheMutex;
+static std::unordered_map<std::string, ParserTargetInfo> TargetInfoCache;
+
+static std::string GetTargetInfoCacheKey(const CppParserOptions* Opts)
+{
+    std::string Key = Opts->TargetTriple;
+    Key += '\n' + std::to_string((int)Opts->Abi);
+    Key += '\n' + std::to_string((int)Opts->LanguageVersion);
+    Key += '\n' + std::to_string(Opts->MicrosoftMode);
+    Key += '\n' + std::to_string(Opts->ToolSetToUse);
+
+    for (const auto& Arg : Opts->Arguments)
+        Key += '\n' + Arg;
+
+    return Key;
+}
+
+ParserResult* ClangParser::ParseLibraries(CppParserOptions* Opts)
 {
     if (!Opts)
         return nullptr;
 
-    Parser parser(Opts);
-    return parser.GetTargetInfo();
+    auto res = new ParserResult();
+    res->CodeParser = new Parser(Opts);
+    return res->CodeParser->ParseLibraries(Opts->LibraryFiles, res);
 }
 
-ParserTargetInfo* Parser::GetTargetInfo()
+ParserTargetInfo* ClangParser::GetTargetInfo(CppParserOptions* Opts)
 {
-    assert(Opts->ASTContext && "Expected a valid ASTContext");
-
-    SetupHeader();
+    if (!Opts)
+        return nullptr;
 
-    std::unique_ptr<clang::SemaConsumer> SC(new clang::SemaConsumer());
-    C->setASTConsumer(std::move(SC));
+    auto Key = GetTargetInfoCacheKey(Opts);
 
-    C->createSema(clang::TU_Complete, 0);
+    std::lock_guard<std::mutex> Lock(TargetInfoCacheMutex);
 
-    auto DiagClient = new DiagnosticConsumer();
-    C->getDiagnostics().setClient(DiagClient);
+    auto It = TargetInfoCache.find(Key);
+    if (It == TargetInfoCache.end())
+    {
+        Parser parser(Opts);
+        std::unique_ptr<ParserTargetInfo> TargetInfo(parser.GetTargetInfo());
+        It = TargetInfoCache.emplace(Key, *TargetInfo).first;
+    }
 
-    AST = &C->getASTContext();
+    return new ParserTargetInfo(It->second);
+}
 
-    // Initialize enough Clang codegen machinery so we can get at ABI details.
-    llvm::LLVMContext Ctx;
-    std::unique_ptr<llvm::Module> M(new llvm::Module("", Ctx));
+ParserTargetInfo* Parser::GetTargetInfo()
+{
+    using namespace clang;
 
-    M->setTargetTriple(AST->getTargetInfo().getTriple().getTriple());
-    M->setDataLayout(AST->getTargetInfo().getDataLayout());
+    // Only the target info is needed here so avoid setting up the whole
+    // compiler instance (header search, preprocessor, Sema and CodeGen).
+    auto args = GetCompilerArguments(Opts);
 
-    std::unique_ptr<clang::CodeGen::CodeGenModule> CGM(
-        new clang::CodeGen::CodeGenModule(C->getASTContext(), C->getHeaderSearchOpts(),
-        C->getPreprocessorOpts(), C->getCodeGenOpts(), *M, C->getDiagnostics()));
+    llvm::IntrusiveRefCntPtr<DiagnosticIDs> DiagID(new DiagnosticIDs());
+    llvm::IntrusiveRefCntPtr<DiagnosticOptions> DiagOpts(new DiagnosticOptions());
+    DiagnosticsEngine Diags(DiagID, &*DiagOpts, new IgnoringDiagConsumer());
 
-    std::unique_ptr<clang::CodeGen::CodeGenTypes> CGT(
-        new clang::CodeGen::CodeGenTypes(*CGM.get()));
+    CompilerInvocation Inv;
+    CompilerInvocation::CreateFromArgs(Inv, args.data(), args.data() + args.size(),
+        Diags);
 
-    CodeGenTypes = CGT.get();
+    llvm::IntrusiveRefCntPtr<clang::TargetInfo> TargetInfo(
+        CreateTargetInfo(Opts, Diags, Inv.TargetOpts));
 
     auto parserTargetInfo = new ParserTargetInfo();
 
-    auto& TI = AST->getTargetInfo();
+    auto& TI = *TargetInfo;
     parserTargetInfo->ABI = TI.getABI();
 
     parserTargetInfo->Char16Type = ConvertIntType(TI.getChar16Type());
@@ -20,12 +20,17 @@
 #include "CXXABI.h"
 #include "CppParser.h"
 
+#include <map>
 #include <string>
+#include <tuple>
 
 namespace clang {
   namespace CodeGen {
     class CodeGenTypes;
   }
+  namespace comments {
+    class FullComment;
+  }
   struct ASTTemplateArgumentListInfo;
   class FunctionTemplateSpecialization;
   class FunctionTemplateSpecializationInfo;
@@ -38,18 +43,19 @@ namespace clang {
   class VTableComponent;
 }
 
-#define Debug printf
-
 namespace CppSharp { namespace CppParser {
 
 class Parser
 {
 public:
     Parser(CppParserOptions* Opts);
+    ~Parser();
 
     void SetupHeader();
     ParserResult* ParseHeader(const std::vector<std::string>& SourceFiles, ParserResult* res);
+    ParserResult* PrecompileHeader(const std::vector<std::string>& SourceFiles, ParserResult* res);
     ParserResult* ParseLibrary(const std::string& File, ParserResult* res);
+    ParserResult* ParseLibraries(const std::vector<std::string>& Files, ParserResult* res);
     ParserResultKind ParseArchive(llvm::StringRef File,
                                   llvm::object::Archive* Archive,
                                   CppSharp::CppParser::NativeLibrary*& NativeLib);
@@ -75,6 +81,7 @@ private:
     void WalkRecordCXX(const clang::CXXRecordDecl* Record, Class* RC);
     ClassTemplateSpecialization*
     WalkClassTemplateSpecialization(const clang::ClassTemplateSpecializationDecl* CTS);
+    bool ShouldWalkSpecialization(const clang::ClassTemplateSpecializationDecl* CTS);
     ClassTemplatePartialSpecialization*
     WalkClassTemplatePartialSpecialization(const clang::ClassTemplatePartialSpecializationDecl* CTS);
     Method* WalkMethodCXX(const clang::CXXMethodDecl* MD);
@@ -111,6 +118,8 @@ private:
     PreprocessedEntity* WalkPreprocessedEntity(Declaration* Decl,
         clang::PreprocessedEntity* PPEntity);
     AST::Expression* WalkExpression(clang::Expr* Expression);
+    AST::Expression* WalkExpressionStatement(clang::Expr* Expression);
+    void EvaluateExpression(clang::Expr* Expr, AST::Expression* Expression);
     std::string GetStringFromStatement(const clang::Stmt* Statement);
 
     // Clang helpers
@@ -119,6 +128,14 @@ private:
     std::string GetDeclMangledName(const clang::Decl* D);
     std::string GetTypeName(const clang::Type* Type);
     bool CanCheckCodeGenInfo(clang::Sema & S, const clang::Type * Ty);
+
+    struct CodeGenInfo
+    {
+        bool IsValid;
+        bool IsReturnIndirect;
+        std::vector<bool> IndirectArguments;
+    };
+    CodeGenInfo GetCodeGenInfo(const clang::FunctionDecl* FD);
     void WalkFunction(const clang::FunctionDecl* FD, Function* F,
         bool IsDependent = false);
     void HandlePreprocessedEntities(Declaration* Decl);
@@ -136,9 +153,25 @@ private:
     void HandleDeclaration(const clang::Decl* D, Declaration* Decl);
     void HandleOriginalText(const clang::Decl* D, Declaration* Decl);
     void HandleComments(const clang::Decl* D, Declaration* Decl);
+    std::vector<clang::comments::FullComment*> ParseFullComments();
+    void ConvertFullComments(
+        const std::vector<clang::comments::FullComment*>& FullComments,
+        size_t Begin, size_t End);
+    void CopyMacroTexts(size_t Begin, size_t End);
+    void HandleEnrichmentPasses();
     void HandleDiagnostics(ParserResult* res);
+    void HandleUnsupported(clang::SourceLocation Loc, const std::string& Message);
+    void HandleIncludes();
+    bool IsUpToDate(const std::vector<std::string>& SourceFiles);
+    void ReleaseOriginalPointers();
+    std::string GetPreamblePath(const std::string& Includes);
+    bool BuildPreamble(const std::string& Includes, const std::string& Path,
+        ParserResult* res = nullptr);
+    bool LoadPreamble(const std::string& Path);
+    bool SetupPreamble(const std::string& Includes);
 
     int Index;
+    unsigned WalkedSpecializations;
     ASTContext* Lib;
     CppParserOptions* Opts;
     std::unique_ptr<clang::CompilerInstance> C;
@@ -146,6 +179,30 @@ private:
     clang::TargetCXXABI::Kind TargetABI;
     clang::CodeGen::CodeGenTypes* CodeGenTypes;
 
+    // ABI classifications by canonical function type, the type of the class
+    // of instance methods and whether the function is a constructor (1) or a
+    // destructor (2).
+    std::map<std::tuple<const clang::Type*, const clang::Type*, int>,
+        CodeGenInfo> CodeGenInfoCache;
+    unsigned CodeGenInfoLookups;
+    unsigned CodeGenInfoCacheHits;
+    std::string PrecompiledHeader;
+
+    // Nodes pointing to Clang objects, rebased when the compiler goes away.
+    std::vector<Declaration*> HandledDeclarations;
+    std::vector<PreprocessedEntity*> HandledEntities;
+    std::vector<Class*> LayoutClasses;
+
+    // Declarations whose raw comment still needs its full comment.
+    std::vector<std::pair<const clang::Decl*, RawComment*>> PendingComments;
+
+    // Macro texts pointing into the source buffers, copied once the
+    // declarations are walked.
+    std::vector<std::pair<std::string*, llvm::StringRef>> PendingMacroTexts;
+
+    std::string FindLibrary(const std::string& File);
+    ParserResultKind ReadLibrary(llvm::StringRef File, llvm::StringRef Path,
+                                 CppSharp::CppParser::NativeLibrary*& NativeLib);
     ParserResultKind ReadSymbols(llvm::StringRef File,
                                  llvm::object::basic_symbol_iterator Begin,
                                  llvm::object::basic_symbol_iterator End,
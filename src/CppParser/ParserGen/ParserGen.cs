@@ -3,9 +3,12 @@
 using System.IO;
 using System.Linq;
 using CppSharp.AST;
+using CppSharp.AST.Extensions;
 using CppSharp.Generators;
+using CppSharp.Generators.CSharp;
 using CppSharp.Passes;
 using CppSharp.Types;
+using Type = CppSharp.AST.Type;
 using CppAbi = CppSharp.Parser.AST.CppAbi;
 using CppSharp.Parser;
 
@@ -160,6 +163,7 @@ public void SetupPasses(Driver driver)
         {
             driver.AddTranslationUnitPass(new CheckMacroPass());
             driver.AddTranslationUnitPass(new IgnoreStdFieldsPass());
+            driver.AddTranslationUnitPass(new VectorDataAccessorsPass(driver.Generator));
             driver.AddTranslationUnitPass(new GetterSetterToPropertyPass());
         }
 
@@ -257,4 +261,209 @@ private bool IsStdType(QualifiedType type)
             return typeName.Contains("std::");
         }
     }
+
+    /// <summary>
+    /// Exposes the bulk Data accessors of the VECTOR/VECTOR_STRING macros
+    /// (see Helpers.h) as managed arrays, so that a whole vector can be read
+    /// with a single native call instead of one call per element.
+    /// </summary>
+    public class VectorDataAccessorsPass : TranslationUnitPass
+    {
+        private class DataAccessor
+        {
+            public Method Method;
+            public string Vector;
+            // The vector element type, or null for string vectors.
+            public Type ElementType;
+        }
+
+        private readonly Generator generator;
+        private readonly Dictionary<Class, List<DataAccessor>> accessors =
+            new Dictionary<Class, List<DataAccessor>>();
+
+        public VectorDataAccessorsPass(Generator generator)
+        {
+            this.generator = generator;
+            generator.OnUnitGenerated += OnUnitGenerated;
+        }
+
+        public override bool VisitMethodDecl(Method method)
+        {
+            if (!base.VisitMethodDecl(method) || !method.IsGenerated)
+                return false;
+
+            var @class = method.Namespace as Class;
+            var vector = GetVectorName(method);
+            if (@class == null || vector == null || !@class.Methods.Any(m =>
+                m.OriginalName == "get" + vector + "Count" && m.Parameters.Count == 0))
+                return false;
+
+            // The C++/CLI backend has its own wrappers for the vectors.
+            if (!Options.IsCSharpGenerator)
+            {
+                method.ExplicitlyIgnore();
+                return false;
+            }
+
+            var accessor = new DataAccessor { Method = method, Vector = vector };
+
+            // The element storage and the caller allocated string table are
+            // passed around as raw pointers and wrapped by the array helpers.
+            var voidPtr = new QualifiedType(new PointerType(
+                new QualifiedType(new BuiltinType(PrimitiveType.Void))));
+            if (method.Parameters.Count == 1)
+            {
+                method.Parameters[0].QualifiedType = voidPtr;
+            }
+            else
+            {
+                accessor.ElementType = ((PointerType) method.ReturnType.Type.Desugar())
+                    .Pointee.Desugar();
+                if (!accessor.ElementType.IsPrimitiveType())
+                    method.ReturnType = voidPtr;
+            }
+
+            List<DataAccessor> classAccessors;
+            if (!accessors.TryGetValue(@class, out classAccessors))
+                accessors[@class] = classAccessors = new List<DataAccessor>();
+            classAccessors.Add(accessor);
+
+            return true;
+        }
+
+        private static string GetVectorName(Method method)
+        {
+            var name = method.OriginalName;
+            if (name.Length <= "getData".Length ||
+                !name.StartsWith("get", StringComparison.Ordinal) ||
+                !name.EndsWith("Data", StringComparison.Ordinal))
+                return null;
+
+            return name.Substring("get".Length, name.Length - "getData".Length);
+        }
+
+        private void OnUnitGenerated(GeneratorOutput output)
+        {
+            foreach (var template in output.Templates.OfType<CSharpSources>())
+            {
+                var classes = accessors.Keys.Where(
+                    c => template.TranslationUnits.Contains(c.TranslationUnit));
+
+                foreach (var group in classes.GroupBy(c => GetNamespace(template, c)))
+                {
+                    var block = new Block(BlockKind.Footer);
+                    block.WriteLine("namespace {0}", group.Key);
+                    block.WriteStartBraceIndent();
+
+                    foreach (var @class in group)
+                    {
+                        block.WriteLine("public unsafe partial class {0}", @class.Name);
+                        block.WriteStartBraceIndent();
+
+                        var first = true;
+                        foreach (var accessor in accessors[@class])
+                        {
+                            if (!first)
+                                block.NewLine();
+                            first = !GenerateArrayAccessor(template, block, accessor) && first;
+                        }
+
+                        block.WriteCloseBraceIndent();
+                    }
+
+                    block.WriteCloseBraceIndent();
+                    template.RootBlock.AddBlock(block);
+                }
+            }
+        }
+
+        private static string GetNamespace(CSharpSources template, Class @class)
+        {
+            var name = @class.Visit(template.TypePrinter).Type;
+            name = name.Substring(0, name.LastIndexOf('.'));
+            return name.StartsWith("global::", StringComparison.Ordinal) ?
+                name.Substring("global::".Length) : name;
+        }
+
+        private static bool GenerateArrayAccessor(CSharpSources template, Block block,
+            DataAccessor accessor)
+        {
+            var vector = accessor.Vector;
+            var count = string.Format("(int) {0}Count", vector);
+            var data = string.Format("{0}Data", vector);
+
+            if (accessor.ElementType == null)
+            {
+                block.WriteLine("public string[] Get{0}Array()", vector);
+                block.WriteStartBraceIndent();
+                block.WriteLine("var __strings = new global::System.IntPtr[{0}];", count);
+                block.WriteLine("fixed (global::System.IntPtr* __data = __strings)");
+                block.WriteLineIndent("{0}((global::System.IntPtr) __data);",
+                    accessor.Method.Name);
+                block.WriteLine("var __result = new string[__strings.Length];");
+                block.WriteLine("for (var i = 0; i < __strings.Length; i++)");
+                block.WriteLineIndent("__result[i] = Marshal.PtrToStringAnsi(__strings[i]);");
+                block.WriteLine("return __result;");
+                block.WriteCloseBraceIndent();
+                return true;
+            }
+
+            if (accessor.ElementType.IsPrimitiveType())
+            {
+                var primitive = accessor.ElementType.Visit(template.TypePrinter).Type;
+                block.WriteLine("public {0}[] Get{1}Array()", primitive, vector);
+                block.WriteStartBraceIndent();
+                block.WriteLine("var __result = new {0}[{1}];", primitive, count);
+                block.WriteLine("var __data = {0};", data);
+                block.WriteLine("for (var i = 0; i < __result.Length; i++)");
+                block.WriteLineIndent("__result[i] = __data[i];");
+                block.WriteLine("return __result;");
+                block.WriteCloseBraceIndent();
+                return true;
+            }
+
+            var pointer = accessor.ElementType as PointerType;
+            var elementType = pointer != null ? pointer.Pointee : accessor.ElementType;
+
+            Class elementClass;
+            if (!elementType.TryGetClass(out elementClass))
+                return false;
+
+            var managed = elementClass.Visit(template.TypePrinter).Type;
+            block.WriteLine("public {0}[] Get{1}Array()", managed, vector);
+            block.WriteStartBraceIndent();
+            block.WriteLine("var __result = new {0}[{1}];", managed, count);
+
+            if (pointer != null)
+            {
+                // Mirror the marshalling of the per element getter.
+                block.WriteLine("var __data = (global::System.IntPtr*) {0};", data);
+                block.WriteLine("for (var i = 0; i < __result.Length; i++)");
+                block.WriteStartBraceIndent();
+                block.WriteLine("var __ret = __data[i];");
+                block.WriteLine("if (__ret == IntPtr.Zero) __result[i] = null;");
+                block.WriteLine("else if ({0}.NativeToManagedMap.ContainsKey(__ret))", managed);
+                block.WriteLineIndent("__result[i] = ({0}) {0}.NativeToManagedMap[__ret];", managed);
+                block.WriteLine("else __result[i] = {0}.__CreateInstance(__ret);", managed);
+                block.WriteCloseBraceIndent();
+            }
+            else
+            {
+                // The elements are stored by value in the vector, so the
+                // wrappers are only valid as long as the vector is unchanged.
+                template.TypePrinter.PushContext(CSharpTypePrinterContextKind.Native);
+                var native = elementClass.Visit(template.TypePrinter).Type;
+                template.TypePrinter.PopContext();
+
+                block.WriteLine("var __data = (byte*) {0};", data);
+                block.WriteLine("for (var i = 0; i < __result.Length; i++)");
+                block.WriteLineIndent("__result[i] = {0}.__CreateInstance(" +
+                    "new global::System.IntPtr(__data + i * sizeof({1})));", managed, native);
+            }
+
+            block.WriteLine("return __result;");
+            block.WriteCloseBraceIndent();
+            return true;
+        }
+    }
 }
@@ -0,0 +1,779 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#include "ParserServer.h"
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Program.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace CppSharp::CppParser;
+
+bool CppSharp::CppParser::ReadInteger(const std::string& Value, int& Integer)
+{
+    if (Value.empty())
+        return false;
+
+    char* End;
+    errno = 0;
+    auto Parsed = strtol(Value.c_str(), &End, 10);
+    if (*End != '\0' || errno == ERANGE || Parsed < INT_MIN || Parsed > INT_MAX)
+        return false;
+
+    Integer = (int)Parsed;
+    return true;
+}
+
+bool CppSharp::CppParser::ReadOptionsCommand(const std::string& Command,
+    const std::string& Value, CppParserOptions& Opts)
+{
+    int Integer;
+
+    if (Command == "argument")
+        Opts.Arguments.push_back(Value);
+    else if (Command == "include")
+        Opts.IncludeDirs.push_back(Value);
+    else if (Command == "system-include")
+        Opts.SystemIncludeDirs.push_back(Value);
+    else if (Command == "define")
+        Opts.Defines.push_back(Value);
+    else if (Command == "undefine")
+        Opts.Undefines.push_back(Value);
+    else if (Command == "triple")
+        Opts.TargetTriple = Value;
+    else if (Command == "abi" && ReadInteger(Value, Integer))
+        Opts.Abi = (CppAbi)Integer;
+    else if (Command == "language" && ReadInteger(Value, Integer))
+        Opts.LanguageVersion = (LanguageVersion)Integer;
+    else if (Command == "toolset" && ReadInteger(Value, Integer))
+        Opts.ToolSetToUse = Integer;
+    else if (Command == "microsoft-mode")
+        Opts.MicrosoftMode = true;
+    else if (Command == "no-standard-includes")
+        Opts.NoStandardIncludes = true;
+    else if (Command == "no-builtin-includes")
+        Opts.NoBuiltinIncludes = true;
+    else if (Command == "source")
+        Opts.SourceFiles.push_back(Value);
+    else if (Command == "library-dir")
+        Opts.LibraryDirs.push_back(Value);
+    else if (Command == "library")
+        Opts.LibraryFile = Value;
+    else
+        return false;
+
+    return true;
+}
+
+std::string CppSharp::CppParser::WriteOptionsCommands(const CppParserOptions& Opts)
+{
+    std::string Commands;
+    auto Write = [&](const char* Command, const std::string& Value) {
+        Commands += Command;
+        Commands += ' ';
+        Commands += Value;
+        Commands += '\n';
+    };
+
+    for (const auto& Arg : Opts.Arguments)
+        Write("argument", Arg);
+    for (const auto& Dir : Opts.IncludeDirs)
+        Write("include", Dir);
+    for (const auto& Dir : Opts.SystemIncludeDirs)
+        Write("system-include", Dir);
+    for (const auto& Define : Opts.Defines)
+        Write("define", Define);
+    for (const auto& Undefine : Opts.Undefines)
+        Write("undefine", Undefine);
+
+    if (!Opts.TargetTriple.empty())
+        Write("triple", Opts.TargetTriple);
+    Write("abi", std::to_string((int)Opts.Abi));
+    Write("language", std::to_string((int)Opts.LanguageVersion));
+    Write("toolset", std::to_string(Opts.ToolSetToUse));
+
+    if (Opts.MicrosoftMode)
+        Commands += "microsoft-mode\n";
+    if (Opts.NoStandardIncludes)
+        Commands += "no-standard-includes\n";
+    if (Opts.NoBuiltinIncludes)
+        Commands += "no-builtin-includes\n";
+
+    for (const auto& File : Opts.SourceFiles)
+        Write("source", File);
+    for (const auto& Dir : Opts.LibraryDirs)
+        Write("library-dir", Dir);
+    if (!Opts.LibraryFile.empty())
+        Write("library", Opts.LibraryFile);
+
+    return Commands;
+}
+
+std::string CppSharp::CppParser::WriteDiagnostic(const ParserDiagnostic& Diag)
+{
+    auto Message = Diag.Message;
+    for (auto& Char : Message)
+        if (Char == '\n' || Char == '\r')
+            Char = ' ';
+
+    return "diagnostic " + std::to_string((int)Diag.Level) + ' ' +
+        std::to_string(Diag.LineNumber) + ' ' +
+        std::to_string(Diag.ColumnNumber) + ' ' + Diag.FileName + '\t' +
+        Message + '\n';
+}
+
+std::string CppSharp::CppParser::WriteDiagnostics(const ParserResult* Result)
+{
+    std::string Diagnostics;
+    for (const auto& Diag : Result->Diagnostics)
+        Diagnostics += WriteDiagnostic(Diag);
+
+    return Diagnostics;
+}
+
+bool CppSharp::CppParser::ReadDiagnostic(const std::string& Value,
+    ParserDiagnostic& Diag)
+{
+    std::istringstream Stream(Value);
+    int Level;
+    if (!(Stream >> Level >> Diag.LineNumber >> Diag.ColumnNumber))
+        return false;
+
+    Stream.get();
+    std::string Location;
+    std::getline(Stream, Location);
+
+    auto Tab = Location.find('\t');
+    Diag.Level = (ParserDiagnosticLevel)Level;
+    Diag.FileName = Location.substr(0, Tab);
+    Diag.Message = Tab != std::string::npos ? Location.substr(Tab + 1) : "";
+    return true;
+}
+
+static std::string GetResultReply(ParserResultKind Kind)
+{
+    return "result " + std::to_string((int)Kind) + '\n';
+}
+
+#ifndef _WIN32
+
+static bool SendAll(int Socket, const std::string& Data)
+{
+#ifdef MSG_NOSIGNAL
+    const int Flags = MSG_NOSIGNAL;
+#else
+    const int Flags = 0;
+#endif
+
+    size_t Sent = 0;
+    while (Sent < Data.size())
+    {
+        auto Count = send(Socket, Data.data() + Sent, Data.size() - Sent, Flags);
+        if (Count < 0 && errno == EINTR)
+            continue;
+        if (Count <= 0)
+            return false;
+        Sent += Count;
+    }
+
+    return true;
+}
+
+class SocketLineReader
+{
+public:
+    SocketLineReader(int Socket) : Socket(Socket) {}
+
+    bool ReadLine(std::string& Line)
+    {
+        for (;;)
+        {
+            auto End = Buffer.find('\n');
+            if (End != std::string::npos)
+            {
+                Line = Buffer.substr(0, End);
+                Buffer.erase(0, End + 1);
+                return true;
+            }
+
+            char Data[4096];
+            auto Count = recv(Socket, Data, sizeof(Data), 0);
+            if (Count < 0 && errno == EINTR)
+                continue;
+            if (Count <= 0)
+                return false;
+            Buffer.append(Data, Count);
+        }
+    }
+
+private:
+    int Socket;
+    std::string Buffer;
+};
+
+static bool GetSocketAddress(const std::string& Path, sockaddr_un& Address)
+{
+    if (Path.empty() || Path.size() >= sizeof(Address.sun_path))
+        return false;
+
+    memset(&Address, 0, sizeof(Address));
+    Address.sun_family = AF_UNIX;
+    memcpy(Address.sun_path, Path.c_str(), Path.size() + 1);
+    return true;
+}
+
+#endif
+
+static void SplitCommand(const std::string& Line, std::string& Command,
+    std::string& Value)
+{
+    auto Space = Line.find(' ');
+    Command = Line.substr(0, Space);
+    Value = Space != std::string::npos ? Line.substr(Space + 1) : "";
+}
+
+ParserServer::ParserServer(const std::string& SocketPath,
+    const std::string& WorkerPath)
+    : SocketPath(SocketPath)
+    , WorkerPath(WorkerPath)
+{
+}
+
+int ParserServer::Run()
+{
+#ifdef _WIN32
+    return 1;
+#else
+    sockaddr_un Address;
+    if (!GetSocketAddress(SocketPath, Address))
+        return 1;
+
+    // The requests run in this process and its workers, so they must not
+    // be forwarded back to it.
+    unsetenv("CPPSHARP_PARSER_SERVER");
+    signal(SIGPIPE, SIG_IGN);
+
+    auto Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (Socket < 0)
+        return 1;
+
+    // Remove the socket of a previous server which did not shut down cleanly.
+    unlink(SocketPath.c_str());
+
+    if (bind(Socket, (sockaddr*)&Address, sizeof(Address)) != 0 ||
+        listen(Socket, SOMAXCONN) != 0)
+    {
+        close(Socket);
+        return 1;
+    }
+
+    for (;;)
+    {
+        auto Connection = accept(Socket, nullptr, nullptr);
+        if (Connection < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+
+        std::thread([this, Connection]() {
+            HandleConnection(Connection);
+            close(Connection);
+        }).detach();
+    }
+
+    close(Socket);
+    return 1;
+#endif
+}
+
+void ParserServer::HandleConnection(int Socket)
+{
+#ifndef _WIN32
+    SocketLineReader Reader(Socket);
+    CppParserOptions Opts;
+    std::string Request;
+    std::string Line, Command, Value;
+
+    while (Reader.ReadLine(Line))
+    {
+        SplitCommand(Line, Command, Value);
+
+        std::string Reply;
+        if (ReadOptionsCommand(Command, Value, Opts))
+        {
+            Request += Line + '\n';
+            continue;
+        }
+        else if (Command == "parse")
+            Reply = ParseHeader(Opts, Request);
+        else if (Command == "parse-library")
+            Reply = ParseLibrary(Opts);
+        else
+            continue;
+
+        if (!SendAll(Socket, Reply))
+            return;
+
+        Opts = CppParserOptions();
+        Request.clear();
+    }
+#endif
+}
+
+std::string ParserServer::ParseHeader(const CppParserOptions& Opts,
+    const std::string& Request)
+{
+    {
+        std::lock_guard<std::mutex> Lock(CacheMutex);
+        auto Header = FindHeader(Request);
+        if (Header)
+            return GetHeaderReply(*Header);
+    }
+
+    // Every build gets its own file, so that replacing a header in the
+    // cache does not overwrite the one a client has open.
+    llvm::SmallString<128> Model;
+    llvm::sys::path::system_temp_directory(/*erasedOnReboot=*/true, Model);
+    llvm::sys::path::append(Model, "CppSharp-server-%%%%%%%%.pch");
+
+    int FD;
+    llvm::SmallString<128> UniquePath;
+    if (llvm::sys::fs::createUniqueFile(Model, FD, UniquePath))
+        return GetResultReply(ParserResultKind::Error);
+#ifndef _WIN32
+    close(FD);
+#endif
+    auto Path = UniquePath.str().str();
+
+    // The worker precompiles the header and walks it, as it does for the
+    // generator, so a header which crashes the parser or the walker only
+    // takes down the worker.
+    std::string WorkerReply;
+    auto Exited = RunWorker(Request + "output " + Path + "\nparse\n",
+        WorkerReply);
+
+    std::string Diagnostics;
+    std::vector<std::string> Files;
+    auto Kind = ParserResultKind::Error;
+    auto Replied = false;
+
+    std::istringstream Stream(WorkerReply);
+    std::string Line, Command, Value;
+
+    while (!Replied && std::getline(Stream, Line))
+    {
+        SplitCommand(Line, Command, Value);
+
+        int Integer;
+        if (Command == "diagnostic")
+            Diagnostics += Line + '\n';
+        else if (Command == "file")
+            Files.push_back(Value);
+        else if (Command == "result" && ReadInteger(Value, Integer))
+        {
+            Kind = (ParserResultKind)Integer;
+            Replied = true;
+        }
+    }
+
+    if (!Exited || !Replied)
+    {
+        Kind = ParserResultKind::Error;
+
+        ParserDiagnostic Diag;
+        Diag.Level = ParserDiagnosticLevel::Fatal;
+        Diag.Message = "The parser worker crashed while parsing";
+        for (const auto& File : Opts.SourceFiles)
+            Diag.Message += ' ' + File;
+        Diag.FileName = !Opts.SourceFiles.empty() ? Opts.SourceFiles[0] : "";
+        Diag.LineNumber = 0;
+        Diag.ColumnNumber = 0;
+        Diagnostics += WriteDiagnostic(Diag);
+    }
+
+    if (Kind != ParserResultKind::Success)
+    {
+        llvm::sys::fs::remove(Path);
+        return Diagnostics + GetResultReply(Kind);
+    }
+
+    CachedHeader Header;
+    Header.PrecompiledHeader = Path;
+    Header.Diagnostics = Diagnostics;
+
+    std::sort(Files.begin(), Files.end());
+    Files.erase(std::unique(Files.begin(), Files.end()), Files.end());
+
+    for (const auto& File : Files)
+    {
+        FileStamp Stamp;
+        if (GetFileStamp(File, Stamp))
+            Header.Files.push_back(Stamp);
+    }
+
+    std::lock_guard<std::mutex> Lock(CacheMutex);
+
+    // Another connection might have built the same header meanwhile, in
+    // which case its file is kept as a client may already be using it.
+    auto Existing = FindHeader(Request);
+    if (Existing)
+    {
+        llvm::sys::fs::remove(Path);
+        return GetHeaderReply(*Existing);
+    }
+
+    return GetHeaderReply(StoreHeader(Request, std::move(Header)));
+}
+
+bool ParserServer::RunWorker(const std::string& Request, std::string& Reply)
+{
+    llvm::SmallString<128> InputPath, OutputPath;
+    if (llvm::sys::fs::createTemporaryFile("CppSharp-request", "txt", InputPath))
+        return false;
+    if (llvm::sys::fs::createTemporaryFile("CppSharp-reply", "txt", OutputPath))
+    {
+        llvm::sys::fs::remove(InputPath);
+        return false;
+    }
+
+    {
+        std::ofstream Input(InputPath.c_str(), std::ios::binary);
+        Input << Request;
+    }
+
+    llvm::StringRef Input(InputPath), Output(OutputPath);
+    const llvm::StringRef* Redirects[] = { &Input, &Output, nullptr };
+    const char* Args[] = { WorkerPath.c_str(), nullptr };
+
+    auto ExitCode = llvm::sys::ExecuteAndWait(WorkerPath, Args,
+        /*env=*/nullptr, Redirects);
+
+    {
+        std::ifstream ReplyStream(OutputPath.c_str(), std::ios::binary);
+        std::ostringstream Contents;
+        Contents << ReplyStream.rdbuf();
+        Reply = Contents.str();
+    }
+
+    llvm::sys::fs::remove(InputPath);
+    llvm::sys::fs::remove(OutputPath);
+    return ExitCode == 0;
+}
+
+ParserServer::CachedHeader* ParserServer::FindHeader(const std::string& Request)
+{
+    auto It = Cache.find(Request);
+    if (It == Cache.end() || !IsUpToDate(It->second))
+        return nullptr;
+
+    UseOrder.splice(UseOrder.begin(), UseOrder, It->second.Use);
+    return &It->second;
+}
+
+ParserServer::CachedHeader& ParserServer::StoreHeader(const std::string& Request,
+    CachedHeader Header)
+{
+    // The precompiled header of an outdated entry is not reused, so it is
+    // deleted along with it.
+    auto It = Cache.find(Request);
+    if (It != Cache.end())
+    {
+        llvm::sys::fs::remove(It->second.PrecompiledHeader);
+        UseOrder.erase(It->second.Use);
+        Cache.erase(It);
+    }
+
+    // Evict the least recently used headers to bound the disk space used.
+    while (Cache.size() >= MaxCachedHeaders)
+    {
+        auto Evicted = Cache.find(UseOrder.back());
+        llvm::sys::fs::remove(Evicted->second.PrecompiledHeader);
+        Cache.erase(Evicted);
+        UseOrder.pop_back();
+    }
+
+    UseOrder.push_front(Request);
+    Header.Use = UseOrder.begin();
+    return Cache[Request] = std::move(Header);
+}
+
+std::string ParserServer::GetHeaderReply(const CachedHeader& Header)
+{
+    return Header.Diagnostics + "precompiled " + Header.PrecompiledHeader + '\n' +
+        GetResultReply(ParserResultKind::Success);
+}
+
+std::string ParserServer::ParseLibrary(CppParserOptions& Opts)
+{
+    // The symbols are sent over the socket, so there is no point in mapping
+    // the library.
+    Opts.MappedSymbols = false;
+
+    std::unique_ptr<ParserResult> Result(ClangParser::ParseLibrary(&Opts));
+    auto Reply = WriteDiagnostics(Result.get());
+
+    if (auto Library = Result->Library)
+    {
+        if (Result->Kind == ParserResultKind::Success)
+        {
+            Reply += "library " + std::to_string((int)Library->ArchType) + ' ' +
+                Library->FileName + '\n';
+            for (const auto& Symbol : Library->Symbols)
+                Reply += "symbol " + Symbol + '\n';
+            for (const auto& Dependency : Library->Dependencies)
+                Reply += "dependency " + Dependency + '\n';
+        }
+
+        delete Library;
+    }
+
+    return Reply + GetResultReply(Result->Kind);
+}
+
+bool ParserServer::GetFileStamp(const std::string& File, FileStamp& Stamp)
+{
+#ifdef _WIN32
+    return false;
+#else
+    struct stat Status;
+    if (stat(File.c_str(), &Status) != 0)
+        return false;
+
+    Stamp.File = File;
+    Stamp.ModificationTime = Status.st_mtime;
+    Stamp.Size = Status.st_size;
+    return true;
+#endif
+}
+
+bool ParserServer::IsUpToDate(const CachedHeader& Header)
+{
+    for (const auto& Stamp : Header.Files)
+    {
+        FileStamp Current;
+        if (!GetFileStamp(Stamp.File, Current) ||
+            Current.ModificationTime != Stamp.ModificationTime ||
+            Current.Size != Stamp.Size)
+            return false;
+    }
+
+    FileStamp Current;
+    return GetFileStamp(Header.PrecompiledHeader, Current);
+}
+
+std::string CppSharp::CppParser::GetParserServerSocket(const CppParserOptions* Opts)
+{
+    if (!Opts->ParserServerSocket.empty())
+        return Opts->ParserServerSocket;
+
+    auto Socket = getenv("CPPSHARP_PARSER_SERVER");
+    return Socket ? Socket : "";
+}
+
+#ifndef _WIN32
+
+static int ConnectToServer(const CppParserOptions* Opts)
+{
+    sockaddr_un Address;
+    if (!GetSocketAddress(GetParserServerSocket(Opts), Address))
+        return -1;
+
+    auto Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (Socket < 0)
+        return -1;
+
+    if (connect(Socket, (sockaddr*)&Address, sizeof(Address)) != 0)
+    {
+        close(Socket);
+        return -1;
+    }
+
+    return Socket;
+}
+
+static std::string MakeAbsolute(const std::string& File)
+{
+    llvm::SmallString<128> Path(File);
+    llvm::sys::fs::make_absolute(Path);
+    return Path.str().str();
+}
+
+static void AddServerDiagnostic(const CppParserOptions* Opts, ParserResult* res,
+    ParserDiagnostic& PDiag)
+{
+    if (PDiag.Level < Opts->MinDiagnosticLevel)
+        return;
+
+    if (Opts->DiagnosticHandler)
+        Opts->DiagnosticHandler(&PDiag);
+    if (!Opts->DiagnosticHandler || PDiag.Level >= ParserDiagnosticLevel::Error)
+        res->Diagnostics.push_back(PDiag);
+}
+
+#endif
+
+bool CppSharp::CppParser::PrecompileOnServer(const CppParserOptions* Opts,
+    ParserResult* res, std::string& PrecompiledHeader)
+{
+#ifdef _WIN32
+    return false;
+#else
+    // The server only sees the files on disk and parses a single target
+    // into its own context.
+    if (Opts->SourceFiles.empty() || !Opts->Targets.empty() ||
+        !Opts->VirtualFiles.empty() || Opts->Incremental || Opts->Modules ||
+        std::find(Opts->Arguments.begin(), Opts->Arguments.end(),
+            "-include-pch") != Opts->Arguments.end())
+        return false;
+
+    auto Socket = ConnectToServer(Opts);
+    if (Socket < 0)
+        return false;
+
+    // The server runs in its own directory, so relative paths are resolved
+    // against ours.
+    auto Request = WriteOptionsCommands(*Opts);
+    llvm::SmallString<128> CurrentPath;
+    if (!llvm::sys::fs::current_path(CurrentPath))
+        Request += "argument -working-directory\nargument " +
+            CurrentPath.str().str() + '\n';
+
+    auto DiagnosticsCount = res->Diagnostics.size();
+    auto Replied = false;
+
+    if (SendAll(Socket, Request + "parse\n"))
+    {
+        SocketLineReader Reader(Socket);
+        std::string Line, Command, Value;
+
+        while (!Replied && Reader.ReadLine(Line))
+        {
+            SplitCommand(Line, Command, Value);
+
+            ParserDiagnostic PDiag;
+            if (Command == "diagnostic" && ReadDiagnostic(Value, PDiag))
+                AddServerDiagnostic(Opts, res, PDiag);
+            else if (Command == "precompiled")
+                PrecompiledHeader = Value;
+            else if (Command == "result")
+            {
+                int Kind;
+                if (!ReadInteger(Value, Kind))
+                    break;
+                res->Kind = (ParserResultKind)Kind;
+                Replied = true;
+            }
+        }
+    }
+
+    close(Socket);
+
+    // The header is parsed locally if the server went away before replying.
+    if (!Replied)
+        res->Diagnostics.resize(DiagnosticsCount);
+
+    return Replied;
+#endif
+}
+
+bool CppSharp::CppParser::ParseLibraryOnServer(const CppParserOptions* Opts,
+    ParserResult* res)
+{
+#ifdef _WIN32
+    return false;
+#else
+    if (Opts->MappedSymbols || Opts->LibraryFile.empty())
+        return false;
+
+    auto Socket = ConnectToServer(Opts);
+    if (Socket < 0)
+        return false;
+
+    // The server runs in its own directory, so relative paths are made
+    // absolute against ours.
+    CppParserOptions LibraryOpts;
+    LibraryOpts.LibraryFile = Opts->LibraryFile;
+    if (llvm::sys::fs::exists(LibraryOpts.LibraryFile))
+        LibraryOpts.LibraryFile = MakeAbsolute(LibraryOpts.LibraryFile);
+    for (const auto& Dir : Opts->LibraryDirs)
+        LibraryOpts.LibraryDirs.push_back(MakeAbsolute(Dir));
+
+    auto DiagnosticsCount = res->Diagnostics.size();
+    std::unique_ptr<NativeLibrary> Library;
+    auto Replied = false;
+
+    if (SendAll(Socket, WriteOptionsCommands(LibraryOpts) + "parse-library\n"))
+    {
+        SocketLineReader Reader(Socket);
+        std::string Line, Command, Value;
+
+        while (!Replied && Reader.ReadLine(Line))
+        {
+            SplitCommand(Line, Command, Value);
+
+            ParserDiagnostic PDiag;
+            if (Command == "diagnostic" && ReadDiagnostic(Value, PDiag))
+                AddServerDiagnostic(Opts, res, PDiag);
+            else if (Command == "library")
+            {
+                auto Space = Value.find(' ');
+                int ArchType;
+                if (!ReadInteger(Value.substr(0, Space), ArchType))
+                    break;
+                Library.reset(new NativeLibrary());
+                Library->ArchType = (AST::ArchType)ArchType;
+                Library->FileName = Space != std::string::npos ?
+                    Value.substr(Space + 1) : "";
+            }
+            else if (Command == "symbol" && Library)
+                Library->Symbols.push_back(Value);
+            else if (Command == "dependency" && Library)
+                Library->Dependencies.push_back(Value);
+            else if (Command == "result")
+            {
+                int Kind;
+                if (!ReadInteger(Value, Kind))
+                    break;
+                res->Kind = (ParserResultKind)Kind;
+                Replied = true;
+            }
+        }
+    }
+
+    close(Socket);
+
+    if (!Replied)
+    {
+        res->Diagnostics.resize(DiagnosticsCount);
+        return false;
+    }
+
+    res->Library = Library.release();
+    return true;
+#endif
+}
@@ -0,0 +1,108 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#pragma once
+
+#include "CppParser.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CppSharp { namespace CppParser {
+
+/// Applies a command of the parser request protocol (see Worker.cpp) to the
+/// options, returning false if it is not an option command or its value is
+/// not valid.
+CS_API bool ReadOptionsCommand(const std::string& Command, const std::string& Value,
+    CppParserOptions& Opts);
+
+/// Writes the options as commands of the parser request protocol.
+CS_API std::string WriteOptionsCommands(const CppParserOptions& Opts);
+
+/// Writes a diagnostic as a reply of the parser protocol.
+CS_API std::string WriteDiagnostic(const ParserDiagnostic& Diag);
+
+/// Writes the diagnostics of a result as replies of the parser protocol.
+CS_API std::string WriteDiagnostics(const ParserResult* Result);
+
+/// Reads the value of a diagnostic reply of the parser protocol.
+CS_API bool ReadDiagnostic(const std::string& Value, ParserDiagnostic& Diag);
+
+/// Reads the integer value of a command of the parser protocol, returning
+/// false if it is not one.
+CS_API bool ReadInteger(const std::string& Value, int& Integer);
+
+/// Long-lived parser process listening on a local socket. Connections send
+/// requests with the same protocol as the parser worker, and the server
+/// keeps the precompiled headers of the most recent requests it has seen,
+/// for as long as the files they were built from do not change. The headers
+/// are precompiled by worker processes, so a header crashing the parser
+/// only fails its own request.
+class CS_API ParserServer
+{
+public:
+    ParserServer(const std::string& SocketPath, const std::string& WorkerPath);
+
+    /// Serves connections until the process is killed, only returning if
+    /// the socket could not be set up.
+    int Run();
+
+private:
+    struct FileStamp
+    {
+        std::string File;
+        long long ModificationTime;
+        long long Size;
+    };
+
+    struct CachedHeader
+    {
+        std::string PrecompiledHeader;
+        std::string Diagnostics;
+        std::vector<FileStamp> Files;
+        std::list<std::string>::iterator Use;
+    };
+
+    /// Number of precompiled headers kept before the least recently used
+    /// ones are deleted.
+    static const size_t MaxCachedHeaders = 64;
+
+    void HandleConnection(int Socket);
+    std::string ParseHeader(const CppParserOptions& Opts, const std::string& Request);
+    bool RunWorker(const std::string& Request, std::string& Reply);
+    std::string ParseLibrary(CppParserOptions& Opts);
+    CachedHeader* FindHeader(const std::string& Request);
+    CachedHeader& StoreHeader(const std::string& Request, CachedHeader Header);
+    static std::string GetHeaderReply(const CachedHeader& Header);
+    static bool GetFileStamp(const std::string& File, FileStamp& Stamp);
+    static bool IsUpToDate(const CachedHeader& Header);
+
+    std::string SocketPath;
+    std::string WorkerPath;
+    std::mutex CacheMutex;
+    std::unordered_map<std::string, CachedHeader> Cache;
+    std::list<std::string> UseOrder;
+};
+
+/// Socket of the parser server to forward requests to, from the options or
+/// else the CPPSHARP_PARSER_SERVER environment variable.
+CS_API std::string GetParserServerSocket(const CppParserOptions* Opts);
+
+/// Has the parser server precompile the source files, adding its
+/// diagnostics and result kind to the result. Returns false if there is no
+/// server to handle the request, in which case it should be parsed locally.
+CS_API bool PrecompileOnServer(const CppParserOptions* Opts, ParserResult* res,
+    std::string& PrecompiledHeader);
+
+/// Has the parser server read the library file into the result. Returns
+/// false if there is no server to handle the request.
+CS_API bool ParseLibraryOnServer(const CppParserOptions* Opts, ParserResult* res);
+
+} }
@@ -0,0 +1,150 @@
+/************************************************************************
+*
+* CppSharp
+* Licensed under the simplified BSD license. All rights reserved.
+*
+************************************************************************/
+
+#include "CppParser.h"
+#include "ParserServer.h"
+
+#include <llvm/Support/FileSystem.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace CppSharp::CppParser;
+
+// Parser worker, run by the managed ParserWorkerPool in a child process so
+// that a crash while parsing a header does not take down the generator.
+//
+// Requests are read from the standard input, one command per line:
+//
+//   argument <value>
+//   include <directory>
+//   system-include <directory>
+//   define <macro>
+//   undefine <macro>
+//   triple <target triple>
+//   abi <CppAbi value>
+//   language <LanguageVersion value>
+//   toolset <version>
+//   microsoft-mode
+//   no-standard-includes
+//   no-builtin-includes
+//   source <file>
+//   output <precompiled header file>
+//   parse
+//
+// On "parse" the source files are precompiled into the output file, which
+// is then loaded and walked the same way the generator will, and the worker
+// replies with:
+//
+//   diagnostic <level> <line> <column> <file>\t<message>
+//   file <file the precompiled header was built from>
+//   result <ParserResultKind value>
+//
+// Run with "--server <socket>", it instead listens on a Unix socket for
+// connections sending the same requests, without "output", and keeps the
+// precompiled headers of the requests between them (see ParserServer). The
+// headers are still built by running this executable as a worker for each
+// request. The "parse" reply of the server, without the "file" lines, then
+// also names the precompiled header with
+//
+//   precompiled <precompiled header file>
+//
+// and the server reads libraries on
+//
+//   library-dir <directory>
+//   library <file>
+//   parse-library
+//
+// replying with the diagnostics, then
+//
+//   library <ArchType value> <file>
+//   symbol <name>
+//   dependency <file>
+//   result <ParserResultKind value>
+
+static ParserResultKind Parse(CppParserOptions& Opts, const std::string& Output)
+{
+    Opts.Arguments.push_back("-o");
+    Opts.Arguments.push_back(Output);
+
+    std::unique_ptr<ParserResult> Result(ClangParser::PrecompileHeader(&Opts));
+    std::cout << WriteDiagnostics(Result.get());
+
+    if (Result->Kind != ParserResultKind::Success)
+        return Result->Kind;
+
+    // Walk the precompiled header so that the headers which crash the
+    // walker are caught here rather than in the generator. The walked
+    // declarations are not needed, as the generator reads the precompiled
+    // header on its own.
+    Opts.Arguments.resize(Opts.Arguments.size() - 2);
+    Opts.Arguments.push_back("-include-pch");
+    Opts.Arguments.push_back(Output);
+
+    AST::ASTContext Context;
+    Opts.ASTContext = &Context;
+
+    Result.reset(ClangParser::ParseHeader(&Opts));
+    std::cout << WriteDiagnostics(Result.get());
+    auto Kind = Result->Kind;
+
+    for (auto Unit : Context.TranslationUnits)
+    {
+        std::cout << "file " << Unit->FileName << '\n';
+        for (const auto& Include : Unit->Includes)
+            std::cout << "file " << Include << '\n';
+    }
+
+    // The parser rebases the pointers of the nodes it walked when it is
+    // destroyed, so it goes before the context, which does not own them.
+    Result.reset();
+    for (auto Unit : Context.TranslationUnits)
+        delete Unit;
+
+    return Kind;
+}
+
+static int MainSymbol;
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && std::string(argv[1]) == "--server")
+    {
+        ParserServer Server(argv[2],
+            llvm::sys::fs::getMainExecutable(argv[0], &MainSymbol));
+        auto Result = Server.Run();
+        std::cerr << "Could not listen on " << argv[2] << std::endl;
+        return Result;
+    }
+
+    CppParserOptions Opts;
+    std::string Output;
+    std::string Line;
+
+    while (std::getline(std::cin, Line))
+    {
+        auto Space = Line.find(' ');
+        auto Command = Line.substr(0, Space);
+        auto Value = Space != std::string::npos ? Line.substr(Space + 1) : "";
+
+        if (ReadOptionsCommand(Command, Value, Opts))
+            continue;
+        else if (Command == "output")
+            Output = Value;
+        else if (Command == "parse")
+        {
+            auto Kind = Parse(Opts, Output);
+            std::cout << "result " << (int)Kind << std::endl;
+
+            Opts = CppParserOptions();
+            Output.clear();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,10 @@
+project "CppSharp.CppParser.Worker"
+
+  kind "ConsoleApp"
+  language "C++"
+  SetupNativeProject()
+  rtti "Off"
+
+  files { "*.cpp", "*.lua" }
+  includedirs { ".." }
+  links { "CppSharp.CppParser" }
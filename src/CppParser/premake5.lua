@@ -38,6 +38,8 @@ project "CppSharp.CppParser"
   
   configuration "*"
 
+  include ("Worker")
+
 end
 
 include ("Bindings")
@@ -0,0 +1,142 @@
+using System;
+using System.Linq;
+using CppSharp.AST;
+using CppSharp.AST.Extensions;
+using CppSharp.Parser;
+using CppSharp.Utils;
+using NUnit.Framework;
+
+namespace CppSharp.Generator.Tests.AST
+{
+    [TestFixture]
+    public class TestSpecializations
+    {
+        [Test]
+        public void TestAllSpecializationsWalkedByDefault()
+        {
+            var context = ParseSpecializations(options => { });
+            foreach (var type in new[] { PrimitiveType.Char, PrimitiveType.Int,
+                PrimitiveType.Float, PrimitiveType.Double })
+                Assert.IsFalse(GetSpecialization(context, "SpecializationBox", type).IsIncomplete);
+            Assert.IsFalse(GetSpecialization(context, "SpecializationPair",
+                PrimitiveType.Int).IsIncomplete);
+        }
+
+        [Test]
+        public void TestUserSpecializationsOnly()
+        {
+            var context = ParseSpecializations(options => options.UserSpecializationsOnly = true);
+
+            // Instantiated by SystemSpecializationUser, in a system header.
+            var systemSpec = GetSpecialization(context, "SpecializationBox", PrimitiveType.Char);
+            Assert.IsTrue(systemSpec.IsIncomplete);
+            Assert.AreEqual(0, systemSpec.Fields.Count);
+
+            Assert.IsFalse(GetSpecialization(context, "SpecializationBox",
+                PrimitiveType.Int).IsIncomplete);
+            Assert.IsFalse(GetSpecialization(context, "SpecializationPair",
+                PrimitiveType.Int).IsIncomplete);
+        }
+
+        [Test]
+        public void TestMaxSpecializations()
+        {
+            var context = ParseSpecializations(options => options.MaxSpecializations = 1);
+
+            var implicitSpecs = new[]
+            {
+                GetSpecialization(context, "SpecializationBox", PrimitiveType.Char),
+                GetSpecialization(context, "SpecializationBox", PrimitiveType.Int),
+                GetSpecialization(context, "SpecializationBox", PrimitiveType.Float),
+                GetSpecialization(context, "SpecializationPair", PrimitiveType.Int)
+            };
+            Assert.AreEqual(1, implicitSpecs.Count(s => !s.IsIncomplete));
+
+            // Explicit specializations do not count against the limit.
+            Assert.IsFalse(GetSpecialization(context, "SpecializationBox",
+                PrimitiveType.Double).IsIncomplete);
+        }
+
+        [Test]
+        public void TestSpecializedTemplates()
+        {
+            var context = ParseSpecializations(options =>
+                options.addSpecializedTemplates("SpecializationPair"));
+
+            Assert.IsFalse(GetSpecialization(context, "SpecializationPair",
+                PrimitiveType.Int).IsIncomplete);
+            Assert.IsTrue(GetSpecialization(context, "SpecializationBox",
+                PrimitiveType.Int).IsIncomplete);
+            Assert.IsFalse(GetSpecialization(context, "SpecializationBox",
+                PrimitiveType.Double).IsIncomplete);
+        }
+
+        [Test]
+        public void TestStubsAreReferenced()
+        {
+            var context = ParseSpecializations(options =>
+                options.addSpecializedTemplates("SpecializationPair"));
+
+            // The fields of user declarations still refer to the stubs.
+            var user = context.FindCompleteClass("SpecializationUser");
+            Assert.AreEqual(4, user.Fields.Count);
+            Class @class;
+            Assert.IsTrue(user.Fields[0].Type.TryGetClass(out @class));
+            Assert.AreSame(GetSpecialization(context, "SpecializationBox",
+                PrimitiveType.Int), @class);
+        }
+
+        [Test]
+        public void TestFunctionSpecializationArguments()
+        {
+            var context = ParseSpecializations(options => { });
+
+            var convert = context.FindDecl<FunctionTemplate>(
+                "SpecializationConvert").First(t => t != null);
+            var convertSpec = convert.Specializations.Single();
+            Assert.AreEqual(TemplateSpecializationKind.ExplicitSpecialization,
+                convertSpec.SpecializationKind);
+            Assert.AreEqual(2, convertSpec.Arguments.Count);
+            Assert.IsTrue(convertSpec.Arguments[0].Type.Type.IsPrimitiveType(PrimitiveType.Int));
+            Assert.IsTrue(convertSpec.Arguments[1].Type.Type.IsPrimitiveType(PrimitiveType.Float));
+
+            var count = context.FindDecl<FunctionTemplate>(
+                "SpecializationCount").First(t => t != null);
+            Assert.AreEqual(2, count.Specializations.Count);
+            foreach (var spec in count.Specializations)
+            {
+                Assert.AreEqual(1, spec.Arguments.Count);
+                Assert.AreEqual(TemplateArgument.ArgumentKind.Pack, spec.Arguments[0].Kind);
+            }
+            Assert.AreEqual(new[] { 1, 2 }, count.Specializations.Select(
+                s => s.SpecializedFunction.Parameters.Count).OrderBy(c => c).ToArray());
+        }
+
+        private static ClassTemplateSpecialization GetSpecialization(ASTContext context,
+            string template, PrimitiveType argument)
+        {
+            var classTemplate = context.FindDecl<ClassTemplate>(template).First(t => t != null);
+            return classTemplate.Specializations.Single(
+                s => s.Arguments[0].Type.Type.IsPrimitiveType(argument));
+        }
+
+        private static ASTContext ParseSpecializations(Action<ParserOptions> setup)
+        {
+            var parserOptions = new ParserOptions();
+            parserOptions.addIncludeDirs(GeneratorTest.GetTestsDirectory("Native"));
+            setup(parserOptions);
+            var driverOptions = new DriverOptions();
+            driverOptions.Headers.Add("Specializations.h");
+            var driver = new Driver(driverOptions, new TextDiagnosticPrinter())
+            {
+                ParserOptions = parserOptions
+            };
+            foreach (var module in driver.Options.Modules)
+                module.LibraryName = "Test";
+            driver.Setup();
+            driver.BuildParseOptions();
+            Assert.IsTrue(driver.ParseCode());
+            return driver.Context.ASTContext;
+        }
+    }
+}
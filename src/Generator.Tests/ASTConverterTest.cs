@@ -0,0 +1,198 @@
+﻿using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+using CppSharp.AST;
+using CppSharp.AST.Extensions;
+using CppSharp.Parser;
+using CppSharp.Utils;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class ASTConverterTest
+    {
+        [Test]
+        public void TestParallelConversionMatchesSerialConversion()
+        {
+            var headers = new[] { "AST.h", "ASTExtensions.h", "Enums.h", "Passes.h" };
+
+            using (var context = new ASTContext())
+            {
+                foreach (var header in headers)
+                    Assert.AreEqual(ParserResultKind.Success, ParseHeader(context, header));
+
+                var serial = ClangParser.ConvertASTContext(context,
+                    parallel: false, keepContext: true);
+                var expected = Dump(serial);
+
+                // The units are converted in a different order each time, the
+                // result has to be the same anyway.
+                for (var i = 0; i < 4; i++)
+                {
+                    var parallel = ClangParser.ConvertASTContext(context,
+                        parallel: true, keepContext: true);
+                    Assert.AreEqual(expected, Dump(parallel));
+                }
+            }
+        }
+
+        [Test]
+        public void TestBufferConversionMatchesNativeConversion()
+        {
+            var headers = new[] { "AST.h", "ASTExtensions.h", "Enums.h", "Passes.h" };
+
+            using (var context = new ASTContext())
+            {
+                foreach (var header in headers)
+                    Assert.AreEqual(ParserResultKind.Success, ParseHeader(context, header));
+
+                // Types, parameters, bases and children are read from the
+                // buffer, everything else from the native declarations.
+                var native = new ASTConverter(context)
+                {
+                    UseASTBuffer = false,
+                    KeepContext = true
+                }.Convert();
+                var buffer = new ASTConverter(context)
+                {
+                    KeepContext = true
+                }.Convert();
+
+                Assert.AreEqual(Dump(native), Dump(buffer));
+            }
+        }
+
+        [Test]
+        public void TestStreamedConversionMatchesConversion()
+        {
+            var headers = new[] { "Enums.h", "AST.h" };
+
+            var parser = new ClangParser();
+            parser.ParseProject(CreateProject(headers), unityBuild: false);
+            var expected = Dump(parser.ConvertASTContexts(), headers);
+
+            // Each header is parsed into its own context, which is converted
+            // and freed before the next one is parsed.
+            var streamingParser = new ClangParser { StreamASTConversion = true };
+            streamingParser.ParseProject(CreateProject(headers), unityBuild: false);
+            Assert.AreEqual(expected, Dump(streamingParser.ConvertASTContexts(), headers));
+        }
+
+        static Project CreateProject(IEnumerable<string> headers)
+        {
+            var project = new Project();
+            foreach (var header in headers)
+            {
+                var options = new ParserOptions();
+                options.addIncludeDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.SetupIncludes();
+                project.AddFile(header).Options = options;
+            }
+            return project;
+        }
+
+        static ParserResultKind ParseHeader(ASTContext context, string header)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.addIncludeDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.addSourceFiles(header);
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+
+        static string Dump(CppSharp.AST.ASTContext context, IEnumerable<string> units)
+        {
+            var dump = new StringBuilder();
+            foreach (var unit in context.TranslationUnits.Where(
+                u => units.Contains(Path.GetFileName(u.FilePath))).OrderBy(u => u.FileName))
+            {
+                dump.AppendLine("unit " + Path.GetFileName(unit.FilePath));
+                Dump(unit, dump, 1);
+            }
+            return dump.ToString();
+        }
+
+        static string Dump(CppSharp.AST.ASTContext context)
+        {
+            var dump = new StringBuilder();
+            foreach (var unit in context.TranslationUnits)
+            {
+                dump.AppendLine("unit " + Path.GetFileName(unit.FilePath));
+                Dump(unit, dump, 1);
+            }
+            return dump.ToString();
+        }
+
+        static void Dump(DeclarationContext context, StringBuilder dump, int depth)
+        {
+            foreach (var decl in context.Declarations)
+            {
+                dump.Append(' ', depth * 2).Append(decl.GetType().Name).Append(' ')
+                    .Append(decl.QualifiedOriginalName);
+
+                var function = decl as Function;
+                if (function != null)
+                    dump.Append(" : ").Append(Print(function.ReturnType.Type)).Append('(')
+                        .Append(string.Join(", ", function.Parameters.Select(
+                            p => Print(p.Type)))).Append(')');
+
+                var typedef = decl as TypedefNameDecl;
+                if (typedef != null)
+                    dump.Append(" : ").Append(Print(typedef.Type));
+
+                var variable = decl as Variable;
+                if (variable != null)
+                    dump.Append(" : ").Append(Print(variable.Type));
+
+                var @enum = decl as Enumeration;
+                if (@enum != null)
+                    dump.Append(" {").Append(string.Join(", ", @enum.Items.Select(
+                        item => item.Name + " = " + item.Value))).Append('}');
+
+                dump.AppendLine();
+
+                var @class = decl as Class;
+                if (@class != null)
+                {
+                    foreach (var @base in @class.Bases)
+                        dump.Append(' ', depth * 2 + 2).Append("base ")
+                            .AppendLine(Print(@base.Type));
+                    foreach (var field in @class.Fields)
+                        dump.Append(' ', depth * 2 + 2).Append("field ").Append(field.Name)
+                            .Append(" : ").AppendLine(Print(field.Type));
+                    foreach (var method in @class.Methods)
+                        dump.Append(' ', depth * 2 + 2).Append("method ").Append(method.Name)
+                            .Append(" : ").Append(Print(method.ReturnType.Type)).Append('(')
+                            .Append(string.Join(", ", method.Parameters.Select(
+                                p => Print(p.Type)))).AppendLine(")");
+                }
+
+                var declContext = decl as DeclarationContext;
+                if (declContext != null)
+                    Dump(declContext, dump, depth + 1);
+            }
+        }
+
+        // Prints the type along with the unit the declaration it refers to
+        // belongs to, so references to the wrong instance are caught too.
+        static string Print(Type type)
+        {
+            var printed = type.Visit(new CppTypePrinter());
+
+            var tagType = type.Desugar() as TagType;
+            if (tagType != null && tagType.Declaration.Namespace != null)
+                printed += "@" + Path.GetFileName(
+                    tagType.Declaration.TranslationUnit.FilePath);
+
+            return printed;
+        }
+    }
+}
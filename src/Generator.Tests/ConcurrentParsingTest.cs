@@ -0,0 +1,77 @@
+using System.IO;
+using System.Threading.Tasks;
+using CppSharp.Parser;
+using CppSharp.Utils;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class ConcurrentParsingTest
+    {
+        const int Parses = 32;
+
+        [Test]
+        public void TestConcurrentParsesWithSeparateContexts()
+        {
+            var kinds = new ParserResultKind[Parses];
+            var units = new uint[Parses];
+
+            Parallel.For(0, Parses, i =>
+            {
+                using (var context = new ASTContext())
+                {
+                    kinds[i] = ParseHeader(context, "AST.h");
+                    units[i] = context.TranslationUnitsCount;
+                }
+            });
+
+            for (var i = 0; i < Parses; i++)
+            {
+                Assert.AreEqual(ParserResultKind.Success, kinds[i]);
+                Assert.AreEqual(units[0], units[i]);
+            }
+        }
+
+        [Test]
+        public void TestConcurrentParsesWithSharedContext()
+        {
+            var headers = new[] { "AST.h", "ASTExtensions.h", "Enums.h", "Passes.h" };
+            var kinds = new ParserResultKind[Parses];
+
+            using (var context = new ASTContext())
+            {
+                Parallel.For(0, Parses, i =>
+                    kinds[i] = ParseHeader(context, headers[i % headers.Length]));
+
+                foreach (var kind in kinds)
+                    Assert.AreEqual(ParserResultKind.Success, kind);
+
+                // Each header is only added once no matter how many parses saw it.
+                foreach (var header in headers)
+                {
+                    var count = 0;
+                    for (uint i = 0; i < context.TranslationUnitsCount; i++)
+                        if (Path.GetFileName(context.getTranslationUnits(i).FileName) == header)
+                            count++;
+                    Assert.AreEqual(1, count, header);
+                }
+            }
+        }
+
+        static ParserResultKind ParseHeader(ASTContext context, string header)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.addIncludeDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.addSourceFiles(header);
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+    }
+}
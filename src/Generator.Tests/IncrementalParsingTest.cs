@@ -0,0 +1,105 @@
+using System;
+using System.IO;
+using CppSharp.Parser;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+using TranslationUnit = CppSharp.Parser.AST.TranslationUnit;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class IncrementalParsingTest
+    {
+        private string headersPath;
+
+        [SetUp]
+        public void Setup()
+        {
+            headersPath = Path.Combine(Path.GetTempPath(),
+                "CppSharp-" + Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(headersPath);
+
+            File.WriteAllText(Path.Combine(headersPath, "Incremental.h"),
+                "#include \"IncrementalBase.h\"\nvoid Derived();\n");
+            File.WriteAllText(Path.Combine(headersPath, "IncrementalBase.h"),
+                "void Base();\n");
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            Directory.Delete(headersPath, true);
+        }
+
+        [Test]
+        public void TestReparseWithoutChanges()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                var unit = FindUnit(context, "Incremental.h");
+                var baseUnit = FindUnit(context, "IncrementalBase.h");
+                var units = context.TranslationUnitsCount;
+
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                Assert.AreEqual(units, context.TranslationUnitsCount);
+                Assert.AreEqual(unit.__Instance, FindUnit(context, "Incremental.h").__Instance);
+                Assert.AreEqual(baseUnit.__Instance,
+                    FindUnit(context, "IncrementalBase.h").__Instance);
+            }
+        }
+
+        [Test]
+        public void TestReparseWithChangedHeader()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                var unit = FindUnit(context, "Incremental.h");
+                var baseUnit = FindUnit(context, "IncrementalBase.h");
+                Assert.AreEqual(1, baseUnit.FunctionsCount);
+
+                File.WriteAllText(Path.Combine(headersPath, "IncrementalBase.h"),
+                    "void Base();\nvoid Added();\n");
+
+                // The changed header and the header including it are parsed again.
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                var reparsedUnit = FindUnit(context, "Incremental.h");
+                var reparsedBaseUnit = FindUnit(context, "IncrementalBase.h");
+                Assert.AreNotEqual(unit.__Instance, reparsedUnit.__Instance);
+                Assert.AreNotEqual(baseUnit.__Instance, reparsedBaseUnit.__Instance);
+                Assert.AreEqual(2, reparsedBaseUnit.FunctionsCount);
+            }
+        }
+
+        private ParserResultKind ParseHeader(ASTContext context)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.Incremental = true;
+                options.addIncludeDirs(headersPath);
+                options.addSourceFiles("Incremental.h");
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+
+        private static TranslationUnit FindUnit(ASTContext context, string header)
+        {
+            TranslationUnit found = null;
+            for (uint i = 0; i < context.TranslationUnitsCount; i++)
+            {
+                var unit = context.getTranslationUnits(i);
+                if (Path.GetFileName(unit.FileName) != header)
+                    continue;
+                Assert.IsNull(found, header);
+                found = unit;
+            }
+            Assert.IsNotNull(found, header);
+            return found;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+using System;
+using System.IO;
+using CppSharp.Parser;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+using TranslationUnit = CppSharp.Parser.AST.TranslationUnit;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class ModulesTest
+    {
+        private string headersPath;
+        private string cachePath;
+
+        [SetUp]
+        public void Setup()
+        {
+            headersPath = Path.Combine(Path.GetTempPath(),
+                "CppSharp-" + Guid.NewGuid().ToString("N"));
+            cachePath = Path.Combine(headersPath, "ModuleCache");
+            Directory.CreateDirectory(headersPath);
+
+            File.WriteAllText(Path.Combine(headersPath, "Importer.h"),
+                "#include \"Modular.h\"\nModularType Importer();\n");
+            File.WriteAllText(Path.Combine(headersPath, "Modular.h"),
+                "#pragma once\nstruct ModularType { int Value; };\n");
+
+            // Not named module.modulemap, so it is only found when loaded.
+            File.WriteAllText(Path.Combine(headersPath, "Modular.modulemap"),
+                "module Modular {\n  header \"Modular.h\"\n  export *\n}\n");
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            Directory.Delete(headersPath, true);
+        }
+
+        [Test]
+        public void TestImportModuleMap()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context, loadModuleMap: true));
+
+                // The modular header was compiled into the cache and imported.
+                Assert.IsNotEmpty(GetCachedModules());
+
+                var unit = FindUnit(context, "Importer.h");
+                Assert.AreEqual(1, unit.FunctionsCount);
+                Assert.AreEqual("Importer", unit.getFunctions(0).Name);
+            }
+        }
+
+        [Test]
+        public void TestHeaderWithoutModuleMap()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context, loadModuleMap: false));
+
+                // Without the map the header is included textually.
+                Assert.IsEmpty(GetCachedModules());
+                Assert.AreEqual(1, FindUnit(context, "Importer.h").FunctionsCount);
+                Assert.AreEqual(1, FindUnit(context, "Modular.h").ClassesCount);
+            }
+        }
+
+        private ParserResultKind ParseHeader(ASTContext context, bool loadModuleMap)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.Modules = true;
+                options.ModuleCachePath = cachePath;
+                if (loadModuleMap)
+                    options.addModuleMapFiles(Path.Combine(headersPath, "Modular.modulemap"));
+                options.addIncludeDirs(headersPath);
+                options.addSourceFiles("Importer.h");
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+
+        private string[] GetCachedModules()
+        {
+            if (!Directory.Exists(cachePath))
+                return new string[0];
+            return Directory.GetFiles(cachePath, "Modular-*.pcm", SearchOption.AllDirectories);
+        }
+
+        private static TranslationUnit FindUnit(ASTContext context, string header)
+        {
+            TranslationUnit found = null;
+            for (uint i = 0; i < context.TranslationUnitsCount; i++)
+            {
+                var unit = context.getTranslationUnits(i);
+                if (Path.GetFileName(unit.FileName) != header)
+                    continue;
+                Assert.IsNull(found, header);
+                found = unit;
+            }
+            Assert.IsNotNull(found, header);
+            return found;
+        }
+    }
+}
@@ -0,0 +1,184 @@
+using System.Collections.Generic;
+using CppSharp.Parser;
+using CppSharp.Utils;
+using NUnit.Framework;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class NativeSymbolsTest
+    {
+        [Test]
+        public void TestMappedSymbolsLinux()
+        {
+            TestMappedSymbols("ls-linux");
+        }
+
+        [Test]
+        public void TestMappedSymbolsOSX()
+        {
+            TestMappedSymbols("ls-osx");
+        }
+
+        [Test]
+        public void TestMappedSymbolsWindows()
+        {
+            TestMappedSymbols("ls-windows");
+        }
+
+        [Test]
+        public void TestExportedSymbolsLinux()
+        {
+            using (var result = ParseLibrary("ls-linux", mapped: true))
+            {
+                var nativeLibrary = result.getLibraries(0);
+
+                // Defined symbols are found through the hash table of the
+                // library, which also has their versions.
+                Assert.IsTrue(nativeLibrary.HasSymbol("stdout"));
+                Assert.AreEqual("GLIBC_2.0", nativeLibrary.GetSymbolVersion("stdout"));
+                Assert.IsTrue(nativeLibrary.HasSymbol("_IO_stdin_used"));
+
+                // Undefined symbols are listed too, but only known by the index.
+                Assert.IsTrue(nativeLibrary.HasSymbol("strstr"));
+                Assert.IsNull(nativeLibrary.GetSymbolVersion("strstr"));
+
+                nativeLibrary.clearSymbols();
+                Assert.IsFalse(nativeLibrary.HasSymbol("stdout"));
+                Assert.IsFalse(nativeLibrary.HasSymbol("strstr"));
+                Assert.IsNull(nativeLibrary.GetSymbolVersion("stdout"));
+            }
+
+            using (var result = ParseLibrary("ls-linux", mapped: false))
+            {
+                var nativeLibrary = result.getLibraries(0);
+                Assert.IsTrue(nativeLibrary.HasSymbol("stdout"));
+                Assert.IsTrue(nativeLibrary.HasSymbol("strstr"));
+
+                // Versions are only read from mapped libraries.
+                Assert.IsNull(nativeLibrary.GetSymbolVersion("stdout"));
+            }
+        }
+
+        [Test]
+        public void TestSymbolIndexIsRebuiltOnChange()
+        {
+            using (var result = ParseLibrary("ls-linux", mapped: true))
+            {
+                var nativeLibrary = result.getLibraries(0);
+                var symbol = nativeLibrary.getSymbols(0);
+
+                // Look a symbol up first, so the index exists before it changes.
+                Assert.IsFalse(nativeLibrary.HasSymbol("__cppsharp_added_symbol"));
+                nativeLibrary.addSymbols("__cppsharp_added_symbol");
+                Assert.IsTrue(nativeLibrary.HasSymbol("__cppsharp_added_symbol"));
+                Assert.IsTrue(nativeLibrary.HasSymbol(symbol));
+
+                nativeLibrary.clearSymbols();
+                Assert.AreEqual(0, nativeLibrary.SymbolsCount);
+                Assert.IsFalse(nativeLibrary.HasSymbol("__cppsharp_added_symbol"));
+                Assert.IsFalse(nativeLibrary.HasSymbol(symbol));
+            }
+        }
+
+        [Test]
+        public void TestNativeSymbolResolver()
+        {
+            var indexed = new CppSharp.AST.SymbolContext();
+            var resolved = new CppSharp.AST.SymbolContext();
+            using (var resolver = new NativeSymbolResolver())
+            {
+                resolved.Resolver = resolver;
+                foreach (var library in new[] { "ls-linux", "ls-osx", "ls-windows" })
+                {
+                    using (var result = ParseLibrary(library, mapped: true))
+                    {
+                        var nativeLibrary = result.getLibraries(0);
+                        indexed.Libraries.Add(ClangParser.ConvertLibrary(nativeLibrary));
+                        var newLibrary = ClangParser.ConvertLibrary(nativeLibrary);
+                        resolved.Libraries.Add(newLibrary);
+                        resolver.AddLibrary(nativeLibrary, newLibrary);
+                    }
+                }
+                indexed.IndexSymbols();
+
+                // Every symbol along with the spellings that only resolve
+                // through one of the mangling variants.
+                var symbols = new List<string> { "__cppsharp_missing_symbol" };
+                foreach (var library in indexed.Libraries)
+                {
+                    foreach (var symbol in library.Symbols)
+                    {
+                        symbols.Add(symbol);
+                        symbols.Add(symbol.TrimStart('_'));
+                        symbols.Add("_" + symbol);
+                    }
+                }
+
+                var batch = new List<string>(symbols);
+                var found = resolved.FindSymbols(batch);
+                for (var i = 0; i < symbols.Count; i++)
+                {
+                    var expected = symbols[i];
+                    var expectedFound = indexed.FindSymbol(ref expected);
+                    var actual = symbols[i];
+                    Assert.AreEqual(expectedFound, resolved.FindSymbol(ref actual), symbols[i]);
+                    Assert.AreEqual(expected, actual, symbols[i]);
+                    Assert.AreEqual(expectedFound, found[i], symbols[i]);
+                    Assert.AreEqual(expected, batch[i], symbols[i]);
+
+                    CppSharp.AST.NativeLibrary expectedLibrary, actualLibrary;
+                    indexed.FindLibraryBySymbol(symbols[i], out expectedLibrary);
+                    resolved.FindLibraryBySymbol(symbols[i], out actualLibrary);
+                    Assert.AreEqual(expectedLibrary == null ? null : expectedLibrary.FileName,
+                        actualLibrary == null ? null : actualLibrary.FileName, symbols[i]);
+                }
+
+                Assert.IsFalse(found[0]);
+            }
+        }
+
+        private static void TestMappedSymbols(string library)
+        {
+            using (var copied = ParseLibrary(library, mapped: false))
+            using (var mapped = ParseLibrary(library, mapped: true))
+            {
+                var symbols = GetSymbols(copied.getLibraries(0));
+                Assert.IsNotEmpty(symbols);
+                CollectionAssert.AreEquivalent(symbols, GetSymbols(mapped.getLibraries(0)));
+
+                // Both lists answer for every symbol through their own index.
+                foreach (var result in new[] { copied, mapped })
+                {
+                    var nativeLibrary = result.getLibraries(0);
+                    foreach (var symbol in symbols)
+                        Assert.IsTrue(nativeLibrary.HasSymbol(symbol), symbol);
+                    Assert.IsFalse(nativeLibrary.HasSymbol("__cppsharp_missing_symbol"));
+                }
+            }
+        }
+
+        private static ParserResult ParseLibrary(string library, bool mapped)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.addLibraryDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.LibraryFile = library;
+                options.MappedSymbols = mapped;
+
+                var result = CppSharp.Parser.ClangParser.ParseLibrary(options);
+                Assert.AreEqual(ParserResultKind.Success, result.Kind);
+                Assert.AreEqual(1, result.LibrariesCount);
+                return result;
+            }
+        }
+
+        private static List<string> GetSymbols(CppSharp.Parser.AST.NativeLibrary library)
+        {
+            var symbols = new List<string>();
+            for (uint i = 0; i < library.SymbolsCount; i++)
+                symbols.Add(library.getSymbols(i));
+            return symbols;
+        }
+    }
+}
@@ -205,6 +205,32 @@ public void TestSetMethodAsInternal()
             Assert.AreEqual(method.Access, AccessSpecifier.Internal);
         }
 
+        [Test]
+        public void TestDefaultParamValuesFromTypedValues()
+        {
+            var function = AstContext.FindFunction("TestDefaultArgValues").First();
+            var arguments = function.Parameters.Select(p => p.DefaultArgument).ToList();
+            Assert.AreEqual(ExpressionValueKind.SignedInteger, arguments[0].ValueKind);
+            Assert.AreEqual(5UL, arguments[0].IntegerValue);
+            Assert.AreEqual(ExpressionValueKind.Float, arguments[1].ValueKind);
+            Assert.AreEqual(0.5, arguments[1].FloatValue);
+            Assert.AreEqual(ExpressionValueKind.String, arguments[2].ValueKind);
+            Assert.AreEqual("a\"b", arguments[2].StringValue);
+            Assert.AreEqual(ExpressionValueKind.NullPtr, arguments[3].ValueKind);
+            Assert.AreEqual(ExpressionValueKind.SignedInteger, arguments[4].ValueKind);
+            Assert.AreEqual(9UL, arguments[4].IntegerValue);
+
+            passBuilder.AddPass(new HandleDefaultParamValuesPass());
+            passBuilder.RunPasses(pass => pass.VisitLibrary(AstContext));
+
+            var values = function.Parameters.Select(p => p.DefaultArgument.String).ToList();
+            Assert.AreEqual("5", values[0]);
+            Assert.AreEqual("0.5F", values[1]);
+            Assert.AreEqual("\"a\\\"b\"", values[2]);
+            Assert.AreEqual("new global::System.IntPtr()", values[3]);
+            Assert.AreEqual("9", values[4]);
+        }
+
         private string TypePrinterDelegate(CppSharp.AST.Type type)
         {
             return type.Visit(new CSharpTypePrinter(Driver.Context)).Type;
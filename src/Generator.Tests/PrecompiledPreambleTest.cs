@@ -0,0 +1,100 @@
+using System;
+using System.IO;
+using System.Linq;
+using CppSharp.Parser;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+using TranslationUnit = CppSharp.Parser.AST.TranslationUnit;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class PrecompiledPreambleTest
+    {
+        private static readonly DateTime OldTime = new DateTime(2000, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+
+        private string headersPath;
+        private string preamblePath;
+
+        [SetUp]
+        public void Setup()
+        {
+            headersPath = Path.Combine(Path.GetTempPath(),
+                "CppSharp-" + Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(headersPath);
+
+            File.WriteAllText(Path.Combine(headersPath, "Leading.h"),
+                "void Leading();\n");
+            File.WriteAllText(Path.Combine(headersPath, "Last.h"),
+                "void Last();\n");
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            Directory.Delete(headersPath, true);
+            if (preamblePath != null)
+                File.Delete(preamblePath);
+        }
+
+        [Test]
+        public void TestPreambleIsReusedAndRebuilt()
+        {
+            // The preamble is keyed on the include directories, which are
+            // unique to the test, so it is the only new preamble.
+            var preambles = GetPreambles();
+            ParseHeaders(1);
+            preamblePath = GetPreambles().Except(preambles).Single();
+
+            // Mark the preamble so that rewriting it can be told apart.
+            File.SetLastWriteTimeUtc(preamblePath, OldTime);
+            ParseHeaders(1);
+            Assert.AreEqual(OldTime, File.GetLastWriteTimeUtc(preamblePath));
+
+            File.WriteAllText(Path.Combine(headersPath, "Leading.h"),
+                "void Leading();\nvoid Added();\n");
+            ParseHeaders(2);
+            Assert.AreNotEqual(OldTime, File.GetLastWriteTimeUtc(preamblePath));
+        }
+
+        private void ParseHeaders(int leadingFunctions)
+        {
+            using (var context = new ASTContext())
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.PrecompiledPreamble = true;
+                options.addIncludeDirs(headersPath);
+                options.addSourceFiles("Leading.h");
+                options.addSourceFiles("Last.h");
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    Assert.AreEqual(ParserResultKind.Success, result.Kind);
+
+                Assert.AreEqual(leadingFunctions, FindUnit(context, "Leading.h").FunctionsCount);
+                Assert.AreEqual(1, FindUnit(context, "Last.h").FunctionsCount);
+            }
+        }
+
+        private static string[] GetPreambles()
+        {
+            return Directory.GetFiles(Path.GetTempPath(), "CppSharp-*.pch");
+        }
+
+        private static TranslationUnit FindUnit(ASTContext context, string header)
+        {
+            TranslationUnit found = null;
+            for (uint i = 0; i < context.TranslationUnitsCount; i++)
+            {
+                var unit = context.getTranslationUnits(i);
+                if (Path.GetFileName(unit.FileName) != header)
+                    continue;
+                Assert.IsNull(found, header);
+                found = unit;
+            }
+            Assert.IsNotNull(found, header);
+            return found;
+        }
+    }
+}
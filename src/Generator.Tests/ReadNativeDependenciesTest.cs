@@ -1,4 +1,5 @@
 ﻿using System.Collections.Generic;
+using CppSharp.AST;
 using CppSharp.Utils;
 using NUnit.Framework;
 using CppSharp.Parser;
@@ -36,12 +37,73 @@ public void TestReadDependenciesOSX()
             Assert.AreEqual("libSystem.B.dylib", dependencies[2]);
         }
 
+        [Test]
+        public void TestParseLibrariesThroughDriver()
+        {
+            // The parser options of the driver have no AST context.
+            var symbols = ParseLibraries("ls-linux", "ls-osx", "ls-windows");
+            Assert.AreEqual(3, symbols.Libraries.Count);
+            foreach (var library in symbols.Libraries)
+                Assert.IsNotEmpty(library.Dependencies, library.FileName);
+        }
+
+        [Test]
+        public void TestParseLibrariesInOrder()
+        {
+            var libraries = new[] { "ls-windows", "ls-linux", "ls-osx" };
+            using (var options = new ParserOptions())
+            {
+                options.addLibraryDirs(GeneratorTest.GetTestsDirectory("Native"));
+                foreach (var library in libraries)
+                    options.addLibraryFiles(library);
+
+                using (var result = CppSharp.Parser.ClangParser.ParseLibraries(options))
+                {
+                    Assert.AreEqual(ParserResultKind.Success, result.Kind);
+                    Assert.AreEqual(libraries.Length, result.LibrariesCount);
+                    for (uint i = 0; i < result.LibrariesCount; i++)
+                    {
+                        var nativeLibrary = result.getLibraries(i);
+                        Assert.AreEqual(libraries[i], nativeLibrary.FileName);
+                        nativeLibrary.Dispose();
+                    }
+                }
+            }
+        }
+
+        [Test]
+        public void TestParseLibrariesWithMissingLibrary()
+        {
+            using (var options = new ParserOptions())
+            {
+                options.addLibraryDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.addLibraryFiles("ls-linux");
+                options.addLibraryFiles("ls-missing");
+
+                using (var result = CppSharp.Parser.ClangParser.ParseLibraries(options))
+                {
+                    Assert.AreEqual(ParserResultKind.FileNotFound, result.Kind);
+                    Assert.AreEqual(1, result.DiagnosticsCount);
+                    Assert.AreEqual("ls-missing", result.getDiagnostics(0).FileName);
+
+                    // The libraries which were found are still read.
+                    Assert.AreEqual(1, result.LibrariesCount);
+                    result.getLibraries(0).Dispose();
+                }
+            }
+        }
+
         private static IList<string> GetDependencies(string library)
+        {
+            return ParseLibraries(library).Libraries[0].Dependencies;
+        }
+
+        private static SymbolContext ParseLibraries(params string[] libraries)
         {
             var parserOptions = new ParserOptions();
             parserOptions.addLibraryDirs(GeneratorTest.GetTestsDirectory("Native"));
             var driverOptions = new DriverOptions();
-            driverOptions.Libraries.Add(library);
+            driverOptions.Libraries.AddRange(libraries);
             var driver = new Driver(driverOptions, new TextDiagnosticPrinter())
             {
                 ParserOptions = parserOptions
@@ -50,8 +112,7 @@ private static IList<string> GetDependencies(string library)
                 module.LibraryName = "Test";
             driver.Setup();
             Assert.IsTrue(driver.ParseLibraries());
-            var dependencies = driver.Context.Symbols.Libraries[0].Dependencies;
-            return dependencies;
+            return driver.Context.Symbols;
         }
     }
 }
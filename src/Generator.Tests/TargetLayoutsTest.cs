@@ -0,0 +1,113 @@
+using System.IO;
+using CppSharp.Parser;
+using CppSharp.Utils;
+using CppSharp.Parser.AST;
+using NUnit.Framework;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class TargetLayoutsTest
+    {
+        [Test]
+        public void TestClassTargetLayouts()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                var @class = FindClass(FindUnit(context), "TargetLayoutsPointer");
+
+                Assert.AreEqual(24, @class.Layout.Size);
+                Assert.AreEqual(2u, @class.TargetLayoutsCount);
+                // Pointers and longs are 4 bytes on i686.
+                Assert.AreEqual(12, @class.getTargetLayouts(0).Size);
+                // Longs are 4 bytes on Windows, the pointer keeps the padding.
+                Assert.AreEqual(24, @class.getTargetLayouts(1).Size);
+            }
+        }
+
+        [Test]
+        public void TestFunctionTargetLayouts()
+        {
+            using (var context = new ASTContext())
+            {
+                Assert.AreEqual(ParserResultKind.Success, ParseHeader(context));
+                var unit = FindUnit(context);
+
+                var returnByValue = FindFunction(unit, "TargetLayoutsReturnByValue");
+                Assert.AreEqual(2u, returnByValue.TargetLayoutsCount);
+                var itanium = returnByValue.getTargetLayouts(0);
+                Assert.AreEqual("_Z26TargetLayoutsReturnByValuev", itanium.Mangled);
+                Assert.IsTrue(itanium.IsReturnIndirect);
+                Assert.IsTrue(returnByValue.getTargetLayouts(1).Mangled.StartsWith("?"));
+
+                // Classes with a copy constructor are passed indirectly.
+                var takeByValue = FindFunction(unit, "TargetLayoutsTakeByValue");
+                itanium = takeByValue.getTargetLayouts(0);
+                Assert.AreEqual(1u, itanium.IndirectParametersCount);
+                Assert.AreEqual(1u, itanium.getIndirectParameters(0));
+            }
+        }
+
+        static ParserResultKind ParseHeader(ASTContext context)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.TargetTriple = "x86_64-linux-gnu";
+                options.Abi = CppAbi.Itanium;
+                options.addIncludeDirs(GeneratorTest.GetTestsDirectory("Native"));
+                options.addSourceFiles("TargetLayouts.h");
+                options.SetupIncludes();
+
+                using (var target = new ParserTarget())
+                {
+                    target.TargetTriple = "i686-linux-gnu";
+                    target.Abi = CppAbi.Itanium;
+                    options.addTargets(target);
+                }
+
+                using (var target = new ParserTarget())
+                {
+                    target.TargetTriple = "x86_64-pc-windows-msvc";
+                    target.Abi = CppAbi.Microsoft;
+                    target.MicrosoftMode = true;
+                    options.addTargets(target);
+                }
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+
+        static TranslationUnit FindUnit(ASTContext context)
+        {
+            for (uint i = 0; i < context.TranslationUnitsCount; i++)
+            {
+                var unit = context.getTranslationUnits(i);
+                if (Path.GetFileName(unit.FileName) == "TargetLayouts.h")
+                    return unit;
+            }
+            Assert.Fail("TargetLayouts.h");
+            return null;
+        }
+
+        static Class FindClass(TranslationUnit unit, string name)
+        {
+            for (uint i = 0; i < unit.ClassesCount; i++)
+                if (unit.getClasses(i).Name == name && !unit.getClasses(i).IsIncomplete)
+                    return unit.getClasses(i);
+            Assert.Fail(name);
+            return null;
+        }
+
+        static Function FindFunction(TranslationUnit unit, string name)
+        {
+            for (uint i = 0; i < unit.FunctionsCount; i++)
+                if (unit.getFunctions(i).Name == name)
+                    return unit.getFunctions(i);
+            Assert.Fail(name);
+            return null;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+using System;
+using System.IO;
+using CppSharp.Parser;
+using NUnit.Framework;
+using ASTContext = CppSharp.Parser.AST.ASTContext;
+using TranslationUnit = CppSharp.Parser.AST.TranslationUnit;
+
+namespace CppSharp.Generator.Tests
+{
+    [TestFixture]
+    public class VirtualFilesTest
+    {
+        private string headersPath;
+
+        [SetUp]
+        public void Setup()
+        {
+            headersPath = Path.Combine(Path.GetTempPath(),
+                "CppSharp-" + Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(headersPath);
+
+            File.WriteAllText(Path.Combine(headersPath, "Shadowed.h"),
+                "void OnDisk();\n");
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            Directory.Delete(headersPath, true);
+        }
+
+        [Test]
+        public void TestParseInMemoryFiles()
+        {
+            using (var context = new ASTContext())
+            {
+                // Neither header exists on disk.
+                var kind = ParseHeader(context, "Virtual.h",
+                    new VirtualFile
+                    {
+                        FileName = Path.Combine(headersPath, "Virtual.h"),
+                        Contents = "#include \"VirtualBase.h\"\nvoid Derived();\n"
+                    },
+                    new VirtualFile
+                    {
+                        FileName = Path.Combine(headersPath, "VirtualBase.h"),
+                        Contents = "void Base();\n"
+                    });
+                Assert.AreEqual(ParserResultKind.Success, kind);
+
+                var unit = FindUnit(context, "Virtual.h");
+                Assert.AreEqual(1, unit.FunctionsCount);
+                Assert.AreEqual("Derived", unit.getFunctions(0).Name);
+
+                var baseUnit = FindUnit(context, "VirtualBase.h");
+                Assert.AreEqual(1, baseUnit.FunctionsCount);
+                Assert.AreEqual("Base", baseUnit.getFunctions(0).Name);
+            }
+        }
+
+        [Test]
+        public void TestInMemoryFileShadowsFileOnDisk()
+        {
+            using (var context = new ASTContext())
+            {
+                var kind = ParseHeader(context, "Shadowed.h",
+                    new VirtualFile
+                    {
+                        FileName = Path.Combine(headersPath, "Shadowed.h"),
+                        Contents = "void InMemory();\n"
+                    });
+                Assert.AreEqual(ParserResultKind.Success, kind);
+
+                var unit = FindUnit(context, "Shadowed.h");
+                Assert.AreEqual(1, unit.FunctionsCount);
+                Assert.AreEqual("InMemory", unit.getFunctions(0).Name);
+            }
+        }
+
+        private ParserResultKind ParseHeader(ASTContext context, string header,
+            params VirtualFile[] files)
+        {
+            using (var options = new ParserOptions())
+            {
+                options.ASTContext = context;
+                options.addIncludeDirs(headersPath);
+                options.addSourceFiles(header);
+                foreach (var file in files)
+                    options.addVirtualFiles(file);
+                options.SetupIncludes();
+
+                using (var result = CppSharp.Parser.ClangParser.ParseHeader(options))
+                    return result.Kind;
+            }
+        }
+
+        private static TranslationUnit FindUnit(ASTContext context, string header)
+        {
+            TranslationUnit found = null;
+            for (uint i = 0; i < context.TranslationUnitsCount; i++)
+            {
+                var unit = context.getTranslationUnits(i);
+                if (Path.GetFileName(unit.FileName) != header)
+                    continue;
+                Assert.IsNull(found, header);
+                found = unit;
+            }
+            Assert.IsNotNull(found, header);
+            return found;
+        }
+    }
+}
@@ -128,7 +128,8 @@ public ParserOptions BuildParserOptions(SourceFile file = null)
                 NoBuiltinIncludes = ParserOptions.NoBuiltinIncludes,
                 MicrosoftMode = ParserOptions.MicrosoftMode,
                 Verbose = ParserOptions.Verbose,
-                LanguageVersion = ParserOptions.LanguageVersion
+                LanguageVersion = ParserOptions.LanguageVersion,
+                SkipFullComments = !Options.GenerateComments
             };
 
             // This eventually gets passed to Clang's MSCompatibilityVersion, which
@@ -200,10 +201,15 @@ public bool ParseCode()
             var parser = new ClangParser(new Parser.AST.ASTContext());
 
             parser.SourcesParsed += OnSourceFileParsed;
-            parser.ParseProject(Project, Options.UnityBuild);
+            if (Options.ParserWorkers > 0)
+                parser.WorkerPool = new ParserWorkerPool(Options.ParserWorkers);
+            parser.StreamASTConversion = Options.StreamingASTConversion;
+
+            using (parser.WorkerPool)
+                parser.ParseProject(Project, Options.UnityBuild, Options.UnityBuildShards);
            
             Context.TargetInfo = parser.GetTargetInfo(ParserOptions);
-            Context.ASTContext = ClangParser.ConvertASTContext(parser.ASTContext);
+            Context.ASTContext = parser.ConvertASTContexts(Options.ParallelASTConversion);
 
             return !hasParsingErrors;
         }
@@ -239,6 +245,7 @@ where library.Dependencies.Intersect(module.Libraries).Any()
 
         public bool ParseLibraries()
         {
+            var libraries = new List<string>();
             foreach (var module in Options.Modules)
             {
                 foreach (var libraryDir in module.LibraryDirs)
@@ -246,20 +253,37 @@ public bool ParseLibraries()
 
                 foreach (var library in module.Libraries)
                 {
-                    if (Context.Symbols.Libraries.Any(l => l.FileName == library))
+                    if (libraries.Contains(library) ||
+                        Context.Symbols.Libraries.Any(l => l.FileName == library))
                         continue;
 
-                    var parser = new ClangParser();
-                    parser.LibraryParsed += OnFileParsed;
+                    libraries.Add(library);
+                }
+            }
 
-                    using (var res = parser.ParseLibrary(library, ParserOptions))
-                    {
-                        if (res.Kind != ParserResultKind.Success)
-                            continue;
+            if (libraries.Count > 0)
+            {
+                var parser = new ClangParser();
+                parser.LibrariesParsed += OnFileParsed;
 
-                        Context.Symbols.Libraries.Add(ClangParser.ConvertLibrary(res.Library));
+                // Symbols are looked up through the native libraries, which
+                // the resolver owns from now on.
+                var resolver = Context.Symbols.Resolver as NativeSymbolResolver;
+                if (resolver == null)
+                {
+                    resolver = new NativeSymbolResolver();
+                    Context.Symbols.Resolver = resolver;
+                }
 
-                        res.Library.Dispose();
+                // The libraries which could not be read are reported by the
+                // result and left out of it, the others are still added.
+                using (var res = parser.ParseLibraries(libraries, ParserOptions))
+                {
+                    foreach (var library in res.GetLibrariesArray())
+                    {
+                        var newLibrary = ClangParser.ConvertLibrary(library);
+                        Context.Symbols.Libraries.Add(newLibrary);
+                        resolver.AddLibrary(library, newLibrary);
                     }
                 }
             }
@@ -536,6 +560,10 @@ public static void Run(ILibrary library)
 
             driver.Generator.Dispose();
             driver.Context.TargetInfo.Dispose();
+
+            var resolver = driver.Context.Symbols.Resolver as NativeSymbolResolver;
+            if (resolver != null)
+                resolver.Dispose();
         }
     }
 }
\ No newline at end of file
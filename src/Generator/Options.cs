@@ -22,6 +22,7 @@ public DriverOptions()
             OutputInteropIncludes = true;
             MaxIndent = 80;
             CommentPrefix = "///";
+            GenerateComments = true;
 
             Encoding = Encoding.ASCII;
 
@@ -139,12 +140,46 @@ public string LibraryName
         /// </summary>
         public bool GenerateFinalizers;
 
+        /// <summary>
+        /// If set to false, the parser skips building the full documentation
+        /// comments and only their brief text is generated.
+        /// </summary>
+        public bool GenerateComments;
+
         /// <summary>
         /// If this option is off (the default), each header is parsed separately which is much slower
         /// but safer because of a clean state of the preprocessor for each header.
         /// </summary>
         public bool UnityBuild { get; set; }
 
+        /// <summary>
+        /// If greater than one and UnityBuild is off, the headers are grouped
+        /// by directory into this many unity batches which are parsed in
+        /// parallel, then merged into a single AST.
+        /// </summary>
+        public int UnityBuildShards { get; set; }
+
+        /// <summary>
+        /// If greater than zero and UnityBuild is off, the headers are parsed
+        /// by this many worker processes, so that a header crashing the parser
+        /// is reported as an error instead of taking down the generator.
+        /// </summary>
+        public int ParserWorkers { get; set; }
+
+        /// <summary>
+        /// If set to true, the translation units of the parsed AST are converted
+        /// to the managed AST concurrently.
+        /// </summary>
+        public bool ParallelASTConversion { get; set; }
+
+        /// <summary>
+        /// If set to true and the headers are parsed one by one in this process,
+        /// each header is converted to the managed AST as soon as it is parsed
+        /// and its native AST is freed, so that the native ASTs of all the
+        /// headers are never alive at the same time.
+        /// </summary>
+        public bool StreamingASTConversion { get; set; }
+
         public string IncludePrefix;
         public bool WriteOnlyWhenChanged;
         public Func<TranslationUnit, string> GenerateName;
@@ -1,9 +1,13 @@
-﻿using CppSharp.AST;
+﻿using System.Collections.Generic;
+using System.Linq;
+using CppSharp.AST;
 
 namespace CppSharp.Passes
 {
     public class FindSymbolsPass : TranslationUnitPass
     {
+        private readonly List<IMangledDecl> mangledDecls = new List<IMangledDecl>();
+
         public FindSymbolsPass()
         {
             VisitOptions.VisitClassBases = false;
@@ -16,6 +20,31 @@ public FindSymbolsPass()
             VisitOptions.VisitClassFields = false;
         }
 
+        public override bool VisitLibrary(ASTContext context)
+        {
+            // The declarations are collected first, so that their symbols
+            // are resolved together in a single lookup.
+            mangledDecls.Clear();
+            var result = base.VisitLibrary(context);
+
+            var symbols = mangledDecls.Select(d => d.Mangled).ToList();
+            var found = Context.Symbols.FindSymbols(symbols);
+            for (var i = 0; i < mangledDecls.Count; i++)
+            {
+                if (found[i])
+                {
+                    mangledDecls[i].Mangled = symbols[i];
+                    continue;
+                }
+
+                Diagnostics.Warning("Symbol not found: {0}", symbols[i]);
+                ((Declaration) mangledDecls[i]).ExplicitlyIgnore();
+            }
+
+            mangledDecls.Clear();
+            return result;
+        }
+
         public override bool VisitDeclaration(Declaration decl)
         {
             if (!base.VisitDeclaration(decl))
@@ -27,27 +56,9 @@ public override bool VisitDeclaration(Declaration decl)
             var mangledDecl = decl as IMangledDecl;
             var method = decl as Method;
             if (decl.IsGenerated && mangledDecl != null &&
-                !(method != null && (method.IsPure || method.IsSynthetized)) &&
-                !VisitMangledDeclaration(mangledDecl))
-            {
-                decl.ExplicitlyIgnore();
-                return false;
-            }
-
-            return true;
-        }
-
-        private bool VisitMangledDeclaration(IMangledDecl mangledDecl)
-        {
-            var symbol = mangledDecl.Mangled;
-
-            if (!Context.Symbols.FindSymbol(ref symbol))
-            {
-                Diagnostics.Warning("Symbol not found: {0}", symbol);
-                return false;
-            }
+                !(method != null && (method.IsPure || method.IsSynthetized)))
+                mangledDecls.Add(mangledDecl);
 
-            mangledDecl.Mangled = symbol;
             return true;
         }
     }
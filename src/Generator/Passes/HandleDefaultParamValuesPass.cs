@@ -1,4 +1,5 @@
 ﻿using System.Collections.Generic;
+using System.Globalization;
 using System.Linq;
 using System.Text;
 using System.Text.RegularExpressions;
@@ -67,12 +68,16 @@ public override bool VisitFunctionDecl(Function function)
             var desugared = type.Desugar();
 
             // constants are obtained through dynamic calls at present so they are not compile-time values in target languages
-            if (expression.Declaration is Variable ||
+            if ((expression.Declaration is Variable &&
+                 expression.ValueKind == ExpressionValueKind.None) ||
                 (!Options.MarshalCharAsManagedChar &&
                  desugared.IsPrimitiveType(PrimitiveType.UChar)) ||
                 type.IsPrimitiveTypeConvertibleToRef())
                 return null;
 
+            if (CheckForConstantValue(desugared, expression, ref result))
+                return true;
+
             if (CheckForDefaultPointer(desugared, ref result))
                 return true;
 
@@ -101,6 +106,124 @@ private bool CheckForSimpleExpressions(Expression expression, ref string result,
                 CheckForDefaultChar(desugared, ref result);
         }
 
+        private static bool CheckForConstantValue(Type desugared, Expression expression,
+            ref string result)
+        {
+            // enumerators read better by name, which CheckForEnumValue prints
+            if (expression.ValueKind == ExpressionValueKind.None ||
+                expression.Declaration is Enumeration.Item)
+                return false;
+
+            if (expression.ValueKind == ExpressionValueKind.String)
+            {
+                if (!desugared.IsPointerToPrimitiveType(PrimitiveType.Char))
+                    return false;
+                result = PrintStringLiteral(expression.StringValue);
+                return true;
+            }
+
+            var builtin = desugared as BuiltinType;
+            if (builtin == null)
+                return false;
+
+            switch (expression.ValueKind)
+            {
+                case ExpressionValueKind.SignedInteger:
+                case ExpressionValueKind.UnsignedInteger:
+                case ExpressionValueKind.Boolean:
+                    break;
+                case ExpressionValueKind.Float:
+                    return CheckForFloatValue(builtin, expression.FloatValue, ref result);
+                default:
+                    return false;
+            }
+
+            var signed = expression.ValueKind == ExpressionValueKind.SignedInteger;
+            switch (builtin.Type)
+            {
+                case PrimitiveType.Bool:
+                    result = expression.IntegerValue != 0 ? "true" : "false";
+                    return true;
+                case PrimitiveType.Short:
+                case PrimitiveType.UShort:
+                case PrimitiveType.Int:
+                case PrimitiveType.UInt:
+                case PrimitiveType.Long:
+                case PrimitiveType.ULong:
+                case PrimitiveType.LongLong:
+                case PrimitiveType.ULongLong:
+                    result = signed ?
+                        ((long) expression.IntegerValue).ToString(CultureInfo.InvariantCulture) :
+                        expression.IntegerValue.ToString(CultureInfo.InvariantCulture);
+                    return true;
+                case PrimitiveType.Float:
+                case PrimitiveType.Double:
+                    var value = signed ? (long) expression.IntegerValue :
+                        (double) expression.IntegerValue;
+                    return CheckForFloatValue(builtin, value, ref result);
+                default:
+                    return false;
+            }
+        }
+
+        private static bool CheckForFloatValue(BuiltinType builtin, double value,
+            ref string result)
+        {
+            if (double.IsNaN(value) || double.IsInfinity(value))
+                return false;
+
+            string literal;
+            switch (builtin.Type)
+            {
+                case PrimitiveType.Float:
+                    literal = ((float) value).ToString("R", CultureInfo.InvariantCulture);
+                    break;
+                case PrimitiveType.Double:
+                    literal = value.ToString("R", CultureInfo.InvariantCulture);
+                    break;
+                default:
+                    return false;
+            }
+
+            if (literal.IndexOfAny(new[] { '.', 'E' }) < 0)
+                literal += ".0";
+            result = builtin.Type == PrimitiveType.Float ? literal + 'F' : literal;
+            return true;
+        }
+
+        private static string PrintStringLiteral(string value)
+        {
+            var literal = new StringBuilder("\"");
+            foreach (var c in value)
+            {
+                switch (c)
+                {
+                    case '"':
+                        literal.Append("\\\"");
+                        break;
+                    case '\\':
+                        literal.Append("\\\\");
+                        break;
+                    case '\n':
+                        literal.Append("\\n");
+                        break;
+                    case '\r':
+                        literal.Append("\\r");
+                        break;
+                    case '\t':
+                        literal.Append("\\t");
+                        break;
+                    default:
+                        if (char.IsControl(c))
+                            literal.AppendFormat("\\u{0:x4}", (int) c);
+                        else
+                            literal.Append(c);
+                        break;
+                }
+            }
+            return literal.Append('"').ToString();
+        }
+
         private bool CheckForDefaultPointer(Type desugared, ref string result)
         {
             if (!desugared.IsPointer())
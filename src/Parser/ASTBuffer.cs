@@ -0,0 +1,365 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using CppSharp.Parser.AST;
+using CallingConvention = System.Runtime.InteropServices.CallingConvention;
+
+namespace CppSharp.Parser
+{
+    /// <summary>
+    /// Header of the flat AST buffer written by the native ASTSerializer.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferHeader
+    {
+        public uint Magic;
+        public uint Version;
+        public uint StringsOffset;
+        public uint StringsSize;
+        public uint DeclarationsOffset;
+        public uint DeclarationsCount;
+        public uint ChildrenOffset;
+        public uint ChildrenCount;
+        public uint TypesOffset;
+        public uint TypesCount;
+        public uint BasesOffset;
+        public uint BasesCount;
+    }
+
+    [Flags]
+    public enum ASTBufferDeclarationFlags : uint
+    {
+        IsIncomplete = 1 << 0,
+        IsDependent = 1 << 1,
+        IsImplicit = 1 << 2,
+        IsAnonymous = 1 << 3,
+        IsIndirect = 1 << 4,
+        HasDefaultValue = 1 << 5
+    }
+
+    [Flags]
+    public enum ASTBufferQualifiers : uint
+    {
+        IsConst = 1 << 0,
+        IsVolatile = 1 << 1,
+        IsRestrict = 1 << 2
+    }
+
+    /// <summary>
+    /// A qualified type, as an index into the type table (-1 for no type).
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferQualifiedType
+    {
+        public int Type;
+        public ASTBufferQualifiers Qualifiers;
+    }
+
+    /// <summary>
+    /// A declaration record of the flat AST buffer. Declaration references
+    /// are indices into the declaration table (-1 if not serialized) and
+    /// strings are offsets into the string table.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferDeclaration
+    {
+        public ulong NativePtr;
+        public ulong OriginalPtr;
+        public DeclarationKind Kind;
+        public AccessSpecifier Access;
+        public int Namespace;
+        public int CompleteDeclaration;
+        public uint Location;
+        public int LineNumberStart;
+        public int LineNumberEnd;
+        public uint DefinitionOrder;
+        public uint Name;
+        public uint USR;
+        public uint DebugText;
+        public ASTBufferDeclarationFlags Flags;
+        public uint ChildrenBegin;
+        public uint ChildrenCount;
+        public ASTBufferQualifiedType Type;
+        public uint BasesBegin;
+        public uint BasesCount;
+        public uint Index;
+        public uint Reserved;
+
+        public bool IsIncomplete
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.IsIncomplete) != 0; }
+        }
+
+        public bool IsDependent
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.IsDependent) != 0; }
+        }
+
+        public bool IsImplicit
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.IsImplicit) != 0; }
+        }
+
+        public bool IsAnonymous
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.IsAnonymous) != 0; }
+        }
+
+        public bool IsIndirect
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.IsIndirect) != 0; }
+        }
+
+        public bool HasDefaultValue
+        {
+            get { return (Flags & ASTBufferDeclarationFlags.HasDefaultValue) != 0; }
+        }
+    }
+
+    /// <summary>
+    /// The list of its owner a child declaration comes from.
+    /// </summary>
+    public enum ASTBufferChildGroup : uint
+    {
+        Namespaces,
+        Enums,
+        Functions,
+        Templates,
+        Classes,
+        Typedefs,
+        TypeAliases,
+        Variables,
+        Friends,
+        TemplateParameters,
+        TemplatedDecl,
+        Fields,
+        Methods,
+        Specifiers,
+        Items,
+        Parameters,
+        Specializations
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferChild
+    {
+        public int Declaration;
+        public ASTBufferChildGroup Group;
+    }
+
+    [Flags]
+    public enum ASTBufferTypeFlags : uint
+    {
+        IsDependent = 1 << 0,
+        IsParameterPack = 1 << 1,
+        IsSerialized = 1 << 2
+    }
+
+    /// <summary>
+    /// A type record of the flat AST buffer. Only the fields of its kind are
+    /// used (see ASTSerializer.h), and none of them if it is not serialized,
+    /// in which case the type is read from NativePtr.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferType
+    {
+        public ulong NativePtr;
+        public TypeKind Kind;
+        public ASTBufferTypeFlags Flags;
+        public int Declaration;
+        public uint Value;
+        public uint Index;
+        public uint Reserved;
+        public long Size;
+        public long ElementSize;
+        public ASTBufferQualifiedType Type0;
+        public ASTBufferQualifiedType Type1;
+        public ASTBufferQualifiedType Type2;
+
+        public bool IsDependent
+        {
+            get { return (Flags & ASTBufferTypeFlags.IsDependent) != 0; }
+        }
+
+        public bool IsParameterPack
+        {
+            get { return (Flags & ASTBufferTypeFlags.IsParameterPack) != 0; }
+        }
+
+        public bool IsSerialized
+        {
+            get { return (Flags & ASTBufferTypeFlags.IsSerialized) != 0; }
+        }
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ASTBufferBase
+    {
+        public AccessSpecifier Access;
+        public uint IsVirtual;
+        public int Type;
+        public int Offset;
+    }
+
+    /// <summary>
+    /// Reads the declarations of a native AST context from a flat buffer,
+    /// so they can be converted without a native call for every field.
+    /// </summary>
+    public unsafe class ASTBuffer : IDisposable
+    {
+        const uint Magic = 0x54415343;
+        const uint Version = 2;
+
+        IntPtr handle;
+        readonly byte* data;
+        readonly ASTBufferHeader* header;
+        readonly ASTBufferDeclaration* declarations;
+        readonly ASTBufferChild* children;
+        readonly ASTBufferType* types;
+        readonly ASTBufferBase* bases;
+
+        ASTBuffer(IntPtr handle)
+        {
+            this.handle = handle;
+            data = (byte*) GetASTBufferData(handle);
+            header = (ASTBufferHeader*) data;
+
+            if (header->Magic != Magic || header->Version != Version)
+            {
+                FreeASTBuffer(handle);
+                throw new NotSupportedException("Unsupported AST buffer version");
+            }
+
+            declarations = (ASTBufferDeclaration*) (data + header->DeclarationsOffset);
+            children = (ASTBufferChild*) (data + header->ChildrenOffset);
+            types = (ASTBufferType*) (data + header->TypesOffset);
+            bases = (ASTBufferBase*) (data + header->BasesOffset);
+        }
+
+        ~ASTBuffer()
+        {
+            Dispose(false);
+        }
+
+        /// <summary>
+        /// Serializes the declarations of the native AST context.
+        /// </summary>
+        public static ASTBuffer Serialize(ASTContext context)
+        {
+            var handle = SerializeAST(context.__Instance);
+            return handle == IntPtr.Zero ? null : new ASTBuffer(handle);
+        }
+
+        /// <summary>
+        /// Frees the translation units of a native context along with their
+        /// declarations and types, once they were converted. Their wrappers
+        /// must not be disposed, as that would run their destructors again.
+        /// </summary>
+        public static void ReleaseDeclarations(ASTContext context)
+        {
+            ReleaseDeclarations(context.__Instance);
+        }
+
+        public int Count
+        {
+            get { return (int) header->DeclarationsCount; }
+        }
+
+        public ASTBufferDeclaration* this[int index]
+        {
+            get { return index < 0 ? null : declarations + index; }
+        }
+
+        /// <summary>
+        /// Finds the record of a native declaration, or null if it was not
+        /// serialized. Records are sorted by native pointer.
+        /// </summary>
+        public ASTBufferDeclaration* FindDeclaration(IntPtr nativePtr)
+        {
+            var ptr = (ulong) nativePtr.ToInt64();
+            int low = 0, high = Count - 1;
+
+            while (low <= high)
+            {
+                var mid = low + (high - low) / 2;
+                var midPtr = declarations[mid].NativePtr;
+                if (midPtr == ptr)
+                    return declarations + mid;
+                if (midPtr < ptr)
+                    low = mid + 1;
+                else
+                    high = mid - 1;
+            }
+
+            return null;
+        }
+
+        public string GetString(uint offset)
+        {
+            var length = *(int*) (data + header->StringsOffset + offset);
+            if (length == 0)
+                return string.Empty;
+
+            var text = data + header->StringsOffset + offset + sizeof(int);
+            return Marshal.PtrToStringAnsi((IntPtr) text, length);
+        }
+
+        /// <summary>
+        /// Returns a child of a declaration, in the order the converter
+        /// visits them, along with the list of the declaration it is in.
+        /// </summary>
+        public ASTBufferDeclaration* GetChild(ASTBufferDeclaration* decl, uint index,
+            out ASTBufferChildGroup group)
+        {
+            if (index >= decl->ChildrenCount)
+                throw new ArgumentOutOfRangeException("index");
+
+            var child = children + decl->ChildrenBegin + index;
+            group = child->Group;
+            return this[child->Declaration];
+        }
+
+        public ASTBufferType* GetTypeRecord(int index)
+        {
+            return index < 0 ? null : types + index;
+        }
+
+        public ASTBufferBase* GetBase(ASTBufferDeclaration* decl, uint index)
+        {
+            if (index >= decl->BasesCount)
+                throw new ArgumentOutOfRangeException("index");
+
+            return bases + decl->BasesBegin + index;
+        }
+
+        public void Dispose()
+        {
+            Dispose(true);
+            GC.SuppressFinalize(this);
+        }
+
+        protected virtual void Dispose(bool disposing)
+        {
+            if (handle == IntPtr.Zero)
+                return;
+
+            FreeASTBuffer(handle);
+            handle = IntPtr.Zero;
+        }
+
+        [DllImport("CppSharp.CppParser.dll", CallingConvention = CallingConvention.Cdecl,
+            EntryPoint = "CppSharp_SerializeAST")]
+        static extern IntPtr SerializeAST(IntPtr context);
+
+        [DllImport("CppSharp.CppParser.dll", CallingConvention = CallingConvention.Cdecl,
+            EntryPoint = "CppSharp_GetASTBufferData")]
+        static extern IntPtr GetASTBufferData(IntPtr buffer);
+
+        [DllImport("CppSharp.CppParser.dll", CallingConvention = CallingConvention.Cdecl,
+            EntryPoint = "CppSharp_FreeASTBuffer")]
+        static extern void FreeASTBuffer(IntPtr buffer);
+
+        [DllImport("CppSharp.CppParser.dll", CallingConvention = CallingConvention.Cdecl,
+            EntryPoint = "CppSharp_ReleaseDeclarations")]
+        static extern void ReleaseDeclarations(IntPtr context);
+    }
+}
@@ -1,5 +1,9 @@
 ﻿using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using CppSharp.Parser;
 using SourceLocation = CppSharp.AST.SourceLocation;
 using CppSharp.Parser.AST;
 
@@ -371,45 +375,186 @@ public virtual TRet Visit(Comment comment)
     /// </summary>
     public class ASTConverter
     {
-        ASTContext Context { get; set; }
-        readonly TypeConverter typeConverter;
+        readonly IList<ASTContext> contexts;
         readonly DeclConverter declConverter;
-        readonly CommentConverter commentConverter;
 
         public ASTConverter(ASTContext context)
+            : this(new[] { context })
         {
-            Context = context;
-            typeConverter = new TypeConverter();
-            commentConverter = new CommentConverter();
-            declConverter = new DeclConverter(typeConverter, commentConverter);
-            typeConverter.declConverter = declConverter;
         }
 
+        /// <summary>
+        /// Creates a converter which is handed the native contexts one at a
+        /// time (see ConvertAndRelease), merging their declarations.
+        /// </summary>
+        public ASTConverter()
+            : this(new ASTContext[0])
+        {
+            declConverter.MergeDeclarations = true;
+        }
+
+        /// <summary>
+        /// Creates a converter which merges several native contexts, such as
+        /// the ones of a sharded parse, into a single managed context.
+        /// Declarations found in more than one of them are converted once.
+        /// </summary>
+        public ASTConverter(IList<ASTContext> contexts)
+        {
+            this.contexts = contexts;
+            declConverter = CreateDeclConverter();
+            declConverter.MergeDeclarations = contexts.Count > 1;
+            UseASTBuffer = true;
+        }
+
+        /// <summary>
+        /// Converts the translation units concurrently. Each declaration is
+        /// converted by the converter of the unit it belongs to and shared with
+        /// the others through a concurrent map, so the result is the same as
+        /// the one of a serial conversion.
+        /// </summary>
+        public bool ConvertInParallel { get; set; }
+
+        /// <summary>
+        /// Keeps the native context alive after the conversion, so that it
+        /// can be parsed into again incrementally.
+        /// </summary>
+        public bool KeepContext { get; set; }
+
+        /// <summary>
+        /// Reads the declarations and types from a flat buffer of the native
+        /// context instead of calling into the native side for each field.
+        /// </summary>
+        public bool UseASTBuffer { get; set; }
+
         public CppSharp.AST.ASTContext Convert()
         {
             var _ctx = new AST.ASTContext();
+            var converters = new List<DeclConverter> { declConverter };
+
+            foreach (var context in contexts)
+                converters.AddRange(ConvertContext(context, _ctx));
 
-            for (uint i = 0; i < Context.TranslationUnitsCount; ++i)
+            foreach (var converter in converters)
             {
-                var unit = Context.getTranslationUnits(i);
-                var _unit = declConverter.Visit(unit) as AST.TranslationUnit;
-                _ctx.TranslationUnits.Add(_unit);
-                declConverter.VisitDeclContext(unit, _unit);
+                foreach (var nativeObject in converter.TypeConverter.NativeObjects)
+                    nativeObject.Dispose();
+
+                foreach (var nativeObject in converter.NativeObjects)
+                    nativeObject.Dispose();
             }
 
-            foreach (var nativeObject in typeConverter.NativeObjects)
-                nativeObject.Dispose();
+            if (!KeepContext)
+                foreach (var context in contexts)
+                    context.Dispose();
 
-            foreach (var nativeObject in declConverter.NativeObjects)
-                nativeObject.Dispose();
+            return _ctx;
+        }
 
-            Context.Dispose();
+        /// <summary>
+        /// Converts a native context into a managed one, merging it with the
+        /// contexts converted into it before, then frees the native context
+        /// and its declarations. This lets each header be converted as soon
+        /// as it is parsed, so that only one native AST is alive at a time.
+        /// </summary>
+        public void ConvertAndRelease(ASTContext context, AST.ASTContext _ctx)
+        {
+            ConvertContext(context, _ctx);
 
-            return _ctx;
+            declConverter.ReleaseNativeObjects();
+            ASTBuffer.ReleaseDeclarations(context);
+            context.Dispose();
+        }
+
+        IEnumerable<DeclConverter> ConvertContext(ASTContext context, AST.ASTContext _ctx)
+        {
+            var converters = new List<DeclConverter>();
+
+            using (var buffer = UseASTBuffer ? ASTBuffer.Serialize(context) : null)
+            {
+                declConverter.ASTBuffer = buffer;
+
+                if (ConvertInParallel && !declConverter.MergeDeclarations)
+                {
+                    converters.AddRange(ConvertTranslationUnitsInParallel(context,
+                        _ctx, buffer));
+                }
+                else
+                {
+                    foreach (var unit in context.GetTranslationUnitsArray())
+                    {
+                        var _unit = declConverter.Visit(unit) as AST.TranslationUnit;
+                        if (!declConverter.IsMerged(_unit))
+                            _ctx.TranslationUnits.Add(_unit);
+                        declConverter.VisitDeclContext(unit, _unit);
+                    }
+                }
+
+                declConverter.ASTBuffer = null;
+            }
+
+            declConverter.EndContext();
+            return converters;
+        }
+
+        IEnumerable<DeclConverter> ConvertTranslationUnitsInParallel(ASTContext context,
+            AST.ASTContext _ctx, ASTBuffer buffer)
+        {
+            var units = new AST.TranslationUnit[context.TranslationUnitsCount];
+            var foreignDeclarations = new List<Declaration>[units.Length];
+            var converters = new ConcurrentBag<DeclConverter>();
+
+            Parallel.For(0, units.Length,
+                () =>
+                {
+                    var converter = CreateDeclConverter(declConverter);
+                    converter.ASTBuffer = buffer;
+                    return converter;
+                },
+                (i, state, converter) =>
+                {
+                    var unit = context.getTranslationUnits((uint) i);
+                    converter.OwnerUnit = unit.__Instance;
+                    converter.ForeignDeclarations = foreignDeclarations[i] =
+                        new List<Declaration>();
+                    units[i] = converter.Visit(unit) as AST.TranslationUnit;
+                    converter.VisitDeclContext(unit, units[i]);
+                    return converter;
+                },
+                converter => converters.Add(converter));
+
+            // Declarations only referenced from other units are converted
+            // serially, in the order of the units referencing them.
+            var resolver = CreateDeclConverter(declConverter);
+            resolver.ASTBuffer = buffer;
+            resolver.ForeignDeclarations = foreignDeclarations.SelectMany(d => d).ToList();
+            resolver.VisitForeignDeclarations();
+            converters.Add(resolver);
+
+            // Whether a class is complete can only be checked once all the
+            // converters are done, as the class may still be filled in by
+            // another thread while its declaration context is visited.
+            foreach (var _unit in units)
+            {
+                DeclConverter.RemoveIncompleteClasses(_unit);
+                _ctx.TranslationUnits.Add(_unit);
+            }
+
+            return converters;
+        }
+
+        static DeclConverter CreateDeclConverter(DeclConverter shared = null)
+        {
+            var typeConverter = new TypeConverter();
+            var commentConverter = new CommentConverter();
+            var declConverter = shared != null ?
+                new DeclConverter(typeConverter, commentConverter, shared) :
+                new DeclConverter(typeConverter, commentConverter);
+            typeConverter.declConverter = declConverter;
+            return declConverter;
         }
     }
 
-    public class TypeConverter : TypeVisitor<AST.Type>
+    public unsafe class TypeConverter : TypeVisitor<AST.Type>
     {
         internal DeclConverter declConverter;
 
@@ -436,6 +581,145 @@ public AST.QualifiedType VisitQualified(QualifiedType qualType)
             return _qualType;
         }
 
+        /// <summary>
+        /// Converts a qualified type of the flat AST buffer.
+        /// </summary>
+        public AST.QualifiedType VisitQualified(ASTBufferQualifiedType qualType)
+        {
+            var _qualType = new AST.QualifiedType
+            {
+                Qualifiers = new AST.TypeQualifiers
+                {
+                    IsConst = (qualType.Qualifiers & ASTBufferQualifiers.IsConst) != 0,
+                    IsRestrict = (qualType.Qualifiers & ASTBufferQualifiers.IsRestrict) != 0,
+                    IsVolatile = (qualType.Qualifiers & ASTBufferQualifiers.IsVolatile) != 0,
+                },
+                Type = VisitBufferType(qualType.Type)
+            };
+
+            return _qualType;
+        }
+
+        /// <summary>
+        /// Converts a type of the flat AST buffer. The types which are not
+        /// serialized are converted from their native instance.
+        /// </summary>
+        public AST.Type VisitBufferType(int index)
+        {
+            var astBuffer = declConverter.ASTBuffer;
+            var type = astBuffer.GetTypeRecord(index);
+            if (type == null)
+                return null;
+
+            if (!type->IsSerialized)
+                return Visit(Parser.AST.Type.__CreateInstance(new IntPtr((long) type->NativePtr)));
+
+            AST.Type _type;
+            switch (type->Kind)
+            {
+                case TypeKind.Tag:
+                    _type = new AST.TagType
+                    {
+                        Declaration = declConverter.VisitRecord(astBuffer[type->Declaration])
+                    };
+                    break;
+                case TypeKind.Array:
+                    _type = new AST.ArrayType
+                    {
+                        Size = type->Size,
+                        SizeType = VisitArraySizeType((ArrayType.ArraySize) type->Value),
+                        QualifiedType = VisitQualified(type->Type0),
+                        ElementSize = type->ElementSize
+                    };
+                    break;
+                case TypeKind.Pointer:
+                    _type = new AST.PointerType
+                    {
+                        QualifiedPointee = VisitQualified(type->Type0),
+                        Modifier = VisitTypeModifier((PointerType.TypeModifier) type->Value)
+                    };
+                    break;
+                case TypeKind.MemberPointer:
+                    _type = new AST.MemberPointerType
+                    {
+                        QualifiedPointee = VisitQualified(type->Type0)
+                    };
+                    break;
+                case TypeKind.Typedef:
+                    _type = new AST.TypedefType
+                    {
+                        Declaration = (AST.TypedefNameDecl) declConverter.VisitRecord(
+                            astBuffer[type->Declaration])
+                    };
+                    break;
+                case TypeKind.Attributed:
+                    _type = new AST.AttributedType
+                    {
+                        Modified = VisitQualified(type->Type0),
+                        Equivalent = VisitQualified(type->Type1)
+                    };
+                    break;
+                case TypeKind.Decayed:
+                    _type = new AST.DecayedType
+                    {
+                        Decayed = VisitQualified(type->Type0),
+                        Original = VisitQualified(type->Type1),
+                        Pointee = VisitQualified(type->Type2)
+                    };
+                    break;
+                case TypeKind.TemplateParameter:
+                    _type = new AST.TemplateParameterType
+                    {
+                        Parameter = (AST.TypeTemplateParameter) declConverter.VisitRecord(
+                            astBuffer[type->Declaration]),
+                        Depth = type->Value,
+                        Index = type->Index,
+                        IsParameterPack = type->IsParameterPack
+                    };
+                    break;
+                case TypeKind.TemplateParameterSubstitution:
+                    _type = new AST.TemplateParameterSubstitutionType
+                    {
+                        Replacement = VisitQualified(type->Type0)
+                    };
+                    break;
+                case TypeKind.InjectedClassName:
+                    _type = new AST.InjectedClassNameType
+                    {
+                        Class = declConverter.VisitRecord(astBuffer[type->Declaration]) as AST.Class,
+                        InjectedSpecializationType = VisitQualified(type->Type0)
+                    };
+                    break;
+                case TypeKind.DependentName:
+                    _type = new AST.DependentNameType
+                    {
+                        Desugared = VisitQualified(type->Type0)
+                    };
+                    break;
+                case TypeKind.UnaryTransform:
+                    _type = new AST.UnaryTransformType
+                    {
+                        Desugared = VisitQualified(type->Type0),
+                        BaseType = VisitQualified(type->Type1)
+                    };
+                    break;
+                case TypeKind.Builtin:
+                    _type = new AST.BuiltinType
+                    {
+                        Type = VisitPrimitive((PrimitiveType) type->Value)
+                    };
+                    break;
+                case TypeKind.PackExpansion:
+                    _type = new AST.PackExpansionType();
+                    break;
+                default:
+                    throw new ArgumentOutOfRangeException("index");
+            }
+
+            _type.IsDependent = type->IsDependent;
+            return _type;
+        }
+
         AST.ArrayType.ArraySize VisitArraySizeType(ArrayType.ArraySize size)
         {
             switch (size)
@@ -488,9 +772,8 @@ public override AST.Type VisitFunction(FunctionType type)
             _type.CallingConvention = DeclConverter.VisitCallingConvention(
                 type.CallingConvention);
 
-            for (uint i = 0; i < type.ParametersCount; ++i)
+            foreach (var param in type.GetParametersArray())
             {
-                var param = type.getParameters(i);
                 var _param = declConverter.Visit(param) as AST.Parameter;
                 _type.Parameters.Add(_param);
             }
@@ -757,22 +1040,206 @@ public unsafe class DeclConverter : DeclVisitor<AST.Declaration>
         readonly TypeConverter typeConverter;
         readonly CommentConverter commentConverter;
 
-        readonly Dictionary<IntPtr, AST.Declaration> Declarations;
+        readonly ConcurrentDictionary<IntPtr, AST.Declaration> Declarations;
         readonly Dictionary<IntPtr, AST.PreprocessedEntity> PreprocessedEntities;
-        readonly Dictionary<IntPtr, AST.FunctionTemplateSpecialization> FunctionTemplateSpecializations;
+        readonly ConcurrentDictionary<IntPtr, AST.FunctionTemplateSpecialization> FunctionTemplateSpecializations;
+
+        // Set when the declaration maps are shared with other converters.
+        readonly bool isConcurrent;
+
+        // Declarations already being converted by one of the concurrent
+        // converters, which are the only ones filling in their instances.
+        readonly ConcurrentDictionary<IntPtr, byte> claimedDeclarations;
+
+        // Declarations of the previously converted contexts, by USR (or file
+        // name for translation units), which the current one is merged into.
+        Dictionary<string, AST.Declaration> mergeableDeclarations;
+        readonly HashSet<AST.Declaration> mergedDeclarations = new HashSet<AST.Declaration>();
+        readonly List<AST.Declaration> contextDeclarations = new List<AST.Declaration>();
 
         public DeclConverter(TypeConverter type, CommentConverter comment)
         {
             NativeObjects = new HashSet<IDisposable>();
             typeConverter = type;
             commentConverter = comment;
-            Declarations = new Dictionary<IntPtr, AST.Declaration>();
+            Declarations = new ConcurrentDictionary<IntPtr, AST.Declaration>();
             PreprocessedEntities = new Dictionary<IntPtr, AST.PreprocessedEntity>();
-            FunctionTemplateSpecializations = new Dictionary<IntPtr, AST.FunctionTemplateSpecialization>();
+            FunctionTemplateSpecializations = new ConcurrentDictionary<IntPtr, AST.FunctionTemplateSpecialization>();
+            claimedDeclarations = new ConcurrentDictionary<IntPtr, byte>();
+        }
+
+        /// <summary>
+        /// Creates a converter which shares the converted declarations with
+        /// another one, so that both can run concurrently.
+        /// </summary>
+        public DeclConverter(TypeConverter type, CommentConverter comment,
+            DeclConverter shared)
+            : this(type, comment)
+        {
+            Declarations = shared.Declarations;
+            FunctionTemplateSpecializations = shared.FunctionTemplateSpecializations;
+            claimedDeclarations = shared.claimedDeclarations;
+            isConcurrent = true;
         }
 
         public HashSet<IDisposable> NativeObjects { get; private set; }
 
+        public TypeConverter TypeConverter
+        {
+            get { return typeConverter; }
+        }
+
+        /// <summary>
+        /// Flat image of the native declarations, if available.
+        /// </summary>
+        public ASTBuffer ASTBuffer { get; set; }
+
+        /// <summary>
+        /// Forgets the native objects of the contexts converted so far, which
+        /// are about to be freed, without disposing their wrappers. Their
+        /// converted declarations are still merged with the next contexts.
+        /// </summary>
+        public void ReleaseNativeObjects()
+        {
+            NativeObjects.Clear();
+            typeConverter.NativeObjects.Clear();
+            Declarations.Clear();
+            PreprocessedEntities.Clear();
+            FunctionTemplateSpecializations.Clear();
+            claimedDeclarations.Clear();
+        }
+
+        ASTBufferDeclaration* FindRecord(Declaration decl)
+        {
+            return ASTBuffer != null ? ASTBuffer.FindDeclaration(decl.__Instance) : null;
+        }
+
+        /// <summary>
+        /// Converts the native declaration of a record of the flat AST buffer.
+        /// </summary>
+        public AST.Declaration VisitRecord(ASTBufferDeclaration* record)
+        {
+            if (record == null)
+                return null;
+
+            return Visit(Declaration.__CreateInstance(new IntPtr((long) record->NativePtr)));
+        }
+
+        /// <summary>
+        /// Converts the children of a record which are in the given list of
+        /// its declaration, in order.
+        /// </summary>
+        void VisitChildren<T>(ASTBufferDeclaration* record, ASTBufferChildGroup group,
+            Action<T> add) where T : AST.Declaration
+        {
+            for (uint i = 0; i < record->ChildrenCount; ++i)
+            {
+                ASTBufferChildGroup childGroup;
+                var child = ASTBuffer.GetChild(record, i, out childGroup);
+                if (childGroup == group)
+                    add(VisitRecord(child) as T);
+            }
+        }
+
+        /// <summary>
+        /// Native translation unit being converted by a concurrent converter.
+        /// Only the declarations of this unit are converted, the ones of other
+        /// units are left empty and collected in ForeignDeclarations.
+        /// </summary>
+        public IntPtr OwnerUnit { get; set; }
+
+        /// <summary>
+        /// Declarations referenced by a concurrent converter which belong to
+        /// another translation unit and are converted afterwards.
+        /// </summary>
+        public List<Declaration> ForeignDeclarations { get; set; }
+
+        /// <summary>
+        /// Merges the declarations of each converted context with the ones of
+        /// the contexts converted before it (see EndContext).
+        /// </summary>
+        public bool MergeDeclarations
+        {
+            get { return mergeableDeclarations != null; }
+            set
+            {
+                mergeableDeclarations = value ?
+                    new Dictionary<string, AST.Declaration>() : null;
+            }
+        }
+
+        /// <summary>
+        /// Checks if a declaration was converted from a previous context.
+        /// </summary>
+        public bool IsMerged(AST.Declaration decl)
+        {
+            return mergedDeclarations.Contains(decl);
+        }
+
+        /// <summary>
+        /// Marks the end of the conversion of a context, making its
+        /// declarations available to the contexts converted after it.
+        /// </summary>
+        public void EndContext()
+        {
+            if (!MergeDeclarations)
+                return;
+
+            foreach (var decl in contextDeclarations)
+            {
+                mergedDeclarations.Add(decl);
+
+                var key = decl is AST.TranslationUnit ?
+                    GetMergeKey(((AST.TranslationUnit) decl).FilePath) : decl.USR;
+                if (string.IsNullOrEmpty(key))
+                    continue;
+
+                // Prefer complete declarations over forward declarations.
+                AST.Declaration existing;
+                if (!mergeableDeclarations.TryGetValue(key, out existing) ||
+                    (existing.IsIncomplete && !decl.IsIncomplete))
+                    mergeableDeclarations[key] = decl;
+            }
+
+            contextDeclarations.Clear();
+        }
+
+        static string GetMergeKey(string unitFileName)
+        {
+            return "file:" + unitFileName;
+        }
+
+        AST.Declaration FindMergeableDeclaration(Declaration decl)
+        {
+            string key;
+            bool isIncomplete;
+
+            var record = FindRecord(decl);
+            if (decl.Kind == DeclarationKind.TranslationUnit)
+            {
+                key = GetMergeKey(TranslationUnit.__CreateInstance(decl.__Instance).FileName);
+                isIncomplete = false;
+            }
+            else if (record != null)
+            {
+                key = ASTBuffer.GetString(record->USR);
+                isIncomplete = record->IsIncomplete;
+            }
+            else
+            {
+                key = decl.USR;
+                isIncomplete = decl.IsIncomplete;
+            }
+
+            AST.Declaration existing;
+            if (string.IsNullOrEmpty(key) ||
+                !mergeableDeclarations.TryGetValue(key, out existing))
+                return null;
+
+            // A definition is not merged into a forward declaration.
+            return existing.IsIncomplete && !isIncomplete ? null : existing;
+        }
+
         public override AST.Declaration Visit(Declaration decl)
         {
             if (decl == null)
@@ -783,14 +1250,117 @@ public override AST.Declaration Visit(Declaration decl)
 
             var originalPtr = decl.OriginalPtr;
 
+            if (isConcurrent && CheckForDuplicates(decl))
+            {
+                // Each declaration is converted by the converter of the unit
+                // it belongs to, so that the result does not depend on the
+                // order the units are converted in. Everyone else only gets
+                // the instance which is filled in by that converter.
+                if (claimedDeclarations.ContainsKey(originalPtr))
+                    return Declarations.GetOrAdd(originalPtr, _ => CreateDeclaration(decl));
+
+                if (GetOwnerUnit(decl) != OwnerUnit)
+                {
+                    ForeignDeclarations.Add(decl);
+                    return Declarations.GetOrAdd(originalPtr, _ => CreateDeclaration(decl));
+                }
+
+                if (!claimedDeclarations.TryAdd(originalPtr, 0))
+                    return Declarations.GetOrAdd(originalPtr, _ => CreateDeclaration(decl));
+
+                return base.Visit(decl);
+            }
+
             // Check if the declaration was already handled and return its
             // existing instance.
+            AST.Declaration existing;
             if (CheckForDuplicates(decl))
-                if (Declarations.ContainsKey(originalPtr))
-                    return Declarations[originalPtr];
+                if (Declarations.TryGetValue(originalPtr, out existing))
+                    return existing;
+
+            if (MergeDeclarations && CheckForDuplicates(decl))
+            {
+                existing = FindMergeableDeclaration(decl);
+                if (existing != null)
+                {
+                    Declarations[originalPtr] = existing;
+                    return existing;
+                }
+            }
 
-            var newDecl = base.Visit(decl);
-            return newDecl;
+            return base.Visit(decl);
+        }
+
+        /// <summary>
+        /// Converts the foreign declarations no converter claimed, in order,
+        /// including the ones referenced while converting them.
+        /// </summary>
+        public void VisitForeignDeclarations()
+        {
+            for (var i = 0; i < ForeignDeclarations.Count; i++)
+            {
+                var decl = ForeignDeclarations[i];
+                if (claimedDeclarations.ContainsKey(decl.OriginalPtr))
+                    continue;
+
+                OwnerUnit = GetOwnerUnit(decl);
+                Visit(decl);
+            }
+        }
+
+        static IntPtr GetOwnerUnit(Declaration decl)
+        {
+            for (var context = decl; context != null; context = context._Namespace)
+                if (context.Kind == DeclarationKind.TranslationUnit)
+                    return context.__Instance;
+
+            return IntPtr.Zero;
+        }
+
+        T Create<T>(Declaration decl) where T : AST.Declaration, new()
+        {
+            if (isConcurrent && CheckForDuplicates(decl))
+                return (T) Declarations.GetOrAdd(decl.OriginalPtr, _ => new T());
+
+            return new T();
+        }
+
+        static AST.Declaration CreateDeclaration(Declaration decl)
+        {
+            switch (decl.Kind)
+            {
+                case DeclarationKind.TranslationUnit: return new AST.TranslationUnit();
+                case DeclarationKind.Namespace: return new AST.Namespace();
+                case DeclarationKind.Typedef: return new AST.TypedefDecl();
+                case DeclarationKind.TypeAlias: return new AST.TypeAlias();
+                case DeclarationKind.Parameter: return new AST.Parameter();
+                case DeclarationKind.Function: return new AST.Function();
+                case DeclarationKind.Method: return new AST.Method();
+                case DeclarationKind.Enumeration: return new AST.Enumeration();
+                case DeclarationKind.EnumerationItem: return new AST.Enumeration.Item();
+                case DeclarationKind.Variable: return new AST.Variable();
+                case DeclarationKind.Friend: return new AST.Friend();
+                case DeclarationKind.Field: return new AST.Field();
+                case DeclarationKind.AccessSpecifier: return new AST.AccessSpecifierDecl();
+                case DeclarationKind.Class: return new AST.Class();
+                case DeclarationKind.TypeAliasTemplate: return new AST.TypeAliasTemplate();
+                case DeclarationKind.ClassTemplate: return new AST.ClassTemplate();
+                case DeclarationKind.ClassTemplateSpecialization:
+                    return new AST.ClassTemplateSpecialization();
+                case DeclarationKind.ClassTemplatePartialSpecialization:
+                    return new AST.ClassTemplatePartialSpecialization();
+                case DeclarationKind.FunctionTemplate: return new AST.FunctionTemplate();
+                case DeclarationKind.VarTemplate: return new AST.VarTemplate();
+                case DeclarationKind.VarTemplateSpecialization:
+                    return new AST.VarTemplateSpecialization();
+                case DeclarationKind.VarTemplatePartialSpecialization:
+                    return new AST.VarTemplatePartialSpecialization();
+                case DeclarationKind.TemplateTypeParm: return new AST.TypeTemplateParameter();
+                case DeclarationKind.NonTypeTemplateParm: return new AST.NonTypeTemplateParameter();
+                case DeclarationKind.TemplateTemplateParm: return new AST.TemplateTemplateParameter();
+            }
+
+            throw new NotSupportedException("Unknown declaration kind: " + decl.Kind);
         }
 
         AST.AccessSpecifier VisitAccessSpecifier(AccessSpecifier access)
@@ -823,6 +1393,19 @@ AST.BaseClassSpecifier VisitBaseClassSpecifier(BaseClassSpecifier @base)
             return _base;
         }
 
+        AST.BaseClassSpecifier VisitBaseClassSpecifier(ASTBufferBase* @base)
+        {
+            var _base = new AST.BaseClassSpecifier
+            {
+                IsVirtual = @base->IsVirtual != 0,
+                Access = VisitAccessSpecifier(@base->Access),
+                Type = typeConverter.VisitBufferType(@base->Type),
+                Offset = @base->Offset
+            };
+
+            return _base;
+        }
+
         AST.RawComment VisitRawComment(RawComment rawComment)
         {
             var _rawComment = new AST.RawComment
@@ -878,33 +1461,52 @@ void VisitDeclaration(Declaration decl, AST.Declaration _decl)
         {
             var originalPtr = decl.OriginalPtr;
 
-            if (CheckForDuplicates(decl))
-                if (Declarations.ContainsKey(originalPtr))
-                    throw new NotSupportedException("Duplicate declaration processed");
-
             // Add the declaration to the map so that we can check if have
-            // already handled it and return the declaration.
-            Declarations[originalPtr] = _decl;
-
-            _decl.Access = VisitAccessSpecifier(decl.Access);
-            _decl.Name = decl.Name;
-            _decl.USR = decl.USR;
+            // already handled it and return the declaration. A concurrent
+            // converter fills in the instance which is already in the map.
+            if (!CheckForDuplicates(decl))
+                Declarations[originalPtr] = _decl;
+            else if (!Declarations.TryAdd(originalPtr, _decl) && !isConcurrent)
+                throw new NotSupportedException("Duplicate declaration processed");
+
+            if (MergeDeclarations)
+                contextDeclarations.Add(_decl);
+
+            var record = FindRecord(decl);
+            if (record != null)
+            {
+                _decl.Access = VisitAccessSpecifier(record->Access);
+                _decl.Name = ASTBuffer.GetString(record->Name);
+                _decl.USR = ASTBuffer.GetString(record->USR);
+                _decl.Location = new SourceLocation(record->Location);
+                _decl.LineNumberStart = record->LineNumberStart;
+                _decl.LineNumberEnd = record->LineNumberEnd;
+                _decl.DebugText = ASTBuffer.GetString(record->DebugText);
+                _decl.IsIncomplete = record->IsIncomplete;
+                _decl.IsDependent = record->IsDependent;
+                _decl.DefinitionOrder = record->DefinitionOrder;
+            }
+            else
+            {
+                _decl.Access = VisitAccessSpecifier(decl.Access);
+                _decl.Name = decl.Name;
+                _decl.USR = decl.USR;
+                _decl.Location = new SourceLocation(decl.Location.ID);
+                _decl.LineNumberStart = decl.LineNumberStart;
+                _decl.LineNumberEnd = decl.LineNumberEnd;
+                _decl.DebugText = decl.DebugText;
+                _decl.IsIncomplete = decl.IsIncomplete;
+                _decl.IsDependent = decl.IsDependent;
+                _decl.DefinitionOrder = decl.DefinitionOrder;
+            }
             _decl.Namespace = Visit(decl._Namespace) as AST.DeclarationContext;
-            _decl.Location = new SourceLocation(decl.Location.ID);
-            _decl.LineNumberStart = decl.LineNumberStart;
-            _decl.LineNumberEnd = decl.LineNumberEnd;
-            _decl.DebugText = decl.DebugText;
-            _decl.IsIncomplete = decl.IsIncomplete;
-            _decl.IsDependent = decl.IsDependent;
-            _decl.DefinitionOrder = decl.DefinitionOrder;
             if (decl.CompleteDeclaration != null)
                 _decl.CompleteDeclaration = Visit(decl.CompleteDeclaration);
             if (decl.Comment != null)
                 _decl.Comment = VisitRawComment(decl.Comment);
 
-            for (uint i = 0; i < decl.PreprocessedEntitiesCount; ++i)
+            foreach (var entity in decl.GetPreprocessedEntitiesArray())
             {
-                var entity = decl.getPreprocessedEntities(i);
                 var _entity = VisitPreprocessedEntity(entity);
                 _decl.PreprocessedEntities.Add(_entity);
             }
@@ -916,64 +1518,70 @@ void VisitDeclaration(Declaration decl, AST.Declaration _decl)
 
         public void VisitDeclContext(DeclarationContext ctx, AST.DeclarationContext _ctx)
         {
+            var record = FindRecord(ctx);
+            if (record != null)
+            {
+                VisitDeclContext(record, _ctx);
+                return;
+            }
+
             var namespaces = new Dictionary<Namespace, AST.Namespace>();
 
-            for (uint i = 0; i < ctx.NamespacesCount; ++i)
+            foreach (var decl in ctx.GetNamespacesArray())
             {
-                var decl = ctx.getNamespaces(i);
                 var _decl = Visit(decl) as AST.Namespace;
                 namespaces.Add(decl, _decl);
-                _ctx.Namespaces.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Namespaces.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.EnumsCount; ++i)
+            foreach (var decl in ctx.GetEnumsArray())
             {
-                var decl = ctx.getEnums(i);
                 var _decl = Visit(decl) as AST.Enumeration;
-                _ctx.Enums.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Enums.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.FunctionsCount; ++i)
+            foreach (var decl in ctx.GetFunctionsArray())
             {
-                var decl = ctx.getFunctions(i);
                 var _decl = Visit(decl) as AST.Function;
-                _ctx.Functions.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Functions.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.TemplatesCount; ++i)
+            foreach (var decl in ctx.GetTemplatesArray())
             {
-                var decl = ctx.getTemplates(i);
                 var _decl = Visit(decl) as AST.Template;
-                _ctx.Templates.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Templates.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.ClassesCount; ++i)
+            foreach (var decl in ctx.GetClassesArray())
             {
-                var decl = ctx.getClasses(i);
                 var _decl = Visit(decl) as AST.Class;
-                if (!_decl.IsIncomplete)
+                if ((isConcurrent || !_decl.IsIncomplete) && !IsMerged(_decl))
                     _ctx.Classes.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.TypedefsCount; ++i)
+            foreach (var decl in ctx.GetTypedefsArray())
             {
-                var decl = ctx.getTypedefs(i);
                 var _decl = Visit(decl) as AST.TypedefDecl;
-                _ctx.Typedefs.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Typedefs.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.VariablesCount; ++i)
+            foreach (var decl in ctx.GetVariablesArray())
             {
-                var decl = ctx.getVariables(i);
                 var _decl = Visit(decl) as AST.Variable;
-                _ctx.Variables.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Variables.Add(_decl);
             }
 
-            for (uint i = 0; i < ctx.FriendsCount; ++i)
+            foreach (var decl in ctx.GetFriendsArray())
             {
-                var decl = ctx.getFriends(i);
                 var _decl = Visit(decl) as AST.Friend;
-                _ctx.Declarations.Add(_decl);
+                if (!IsMerged(_decl))
+                    _ctx.Declarations.Add(_decl);
             }
 
             foreach (var @namespace in namespaces)
@@ -986,15 +1594,107 @@ public void VisitDeclContext(DeclarationContext ctx, AST.DeclarationContext _ctx
             // Anonymous types
         }
 
+        /// <summary>
+        /// Converts the children of a declaration context from the flat AST
+        /// buffer, in the same order as the native lists above.
+        /// </summary>
+        void VisitDeclContext(ASTBufferDeclaration* ctx, AST.DeclarationContext _ctx)
+        {
+            var namespaceRecords = new List<IntPtr>();
+            var namespaces = new List<AST.Namespace>();
+
+            for (uint i = 0; i < ctx->ChildrenCount; ++i)
+            {
+                ASTBufferChildGroup group;
+                var child = ASTBuffer.GetChild(ctx, i, out group);
+
+                switch (group)
+                {
+                    case ASTBufferChildGroup.Namespaces:
+                    {
+                        var _decl = VisitRecord(child) as AST.Namespace;
+                        namespaceRecords.Add((IntPtr) child);
+                        namespaces.Add(_decl);
+                        if (!IsMerged(_decl))
+                            _ctx.Namespaces.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Enums:
+                    {
+                        var _decl = VisitRecord(child) as AST.Enumeration;
+                        if (!IsMerged(_decl))
+                            _ctx.Enums.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Functions:
+                    {
+                        var _decl = VisitRecord(child) as AST.Function;
+                        if (!IsMerged(_decl))
+                            _ctx.Functions.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Templates:
+                    {
+                        var _decl = VisitRecord(child) as AST.Template;
+                        if (!IsMerged(_decl))
+                            _ctx.Templates.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Classes:
+                    {
+                        var _decl = VisitRecord(child) as AST.Class;
+                        if ((isConcurrent || !_decl.IsIncomplete) && !IsMerged(_decl))
+                            _ctx.Classes.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Typedefs:
+                    {
+                        var _decl = VisitRecord(child) as AST.TypedefDecl;
+                        if (!IsMerged(_decl))
+                            _ctx.Typedefs.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Variables:
+                    {
+                        var _decl = VisitRecord(child) as AST.Variable;
+                        if (!IsMerged(_decl))
+                            _ctx.Variables.Add(_decl);
+                        break;
+                    }
+                    case ASTBufferChildGroup.Friends:
+                    {
+                        var _decl = VisitRecord(child) as AST.Friend;
+                        if (!IsMerged(_decl))
+                            _ctx.Declarations.Add(_decl);
+                        break;
+                    }
+                }
+            }
+
+            for (var i = 0; i < namespaces.Count; i++)
+                VisitDeclContext((ASTBufferDeclaration*) namespaceRecords[i], namespaces[i]);
+        }
+
+        /// <summary>
+        /// Removes the incomplete classes of a declaration context and of its
+        /// nested contexts, which concurrent converters keep while visiting.
+        /// </summary>
+        public static void RemoveIncompleteClasses(AST.DeclarationContext _ctx)
+        {
+            _ctx.Declarations.RemoveAll(d => d is AST.Class && d.IsIncomplete);
+
+            foreach (var _child in _ctx.Namespaces.Concat<AST.DeclarationContext>(_ctx.Classes))
+                RemoveIncompleteClasses(_child);
+        }
+
         public override AST.Declaration VisitTranslationUnit(TranslationUnit decl)
         {
-            var _unit = new AST.TranslationUnit();
+            var _unit = Create<AST.TranslationUnit>(decl);
             _unit.FilePath = decl.FileName;
             _unit.IsSystemHeader = decl.IsSystemHeader;
 
-            for (uint i = 0; i < decl.MacrosCount; ++i)
+            foreach (var macro in decl.GetMacrosArray())
             {
-                var macro = decl.getMacros(i);
                 var _macro = VisitMacroDefinition(macro);
                 _unit.Macros.Add(_macro);
             }
@@ -1005,7 +1705,7 @@ public override AST.Declaration VisitTranslationUnit(TranslationUnit decl)
 
         public override AST.Declaration VisitNamespace(Namespace decl)
         {
-            var _namespace = new AST.Namespace();
+            var _namespace = Create<AST.Namespace>(decl);
             VisitDeclaration(decl, _namespace);
             _namespace.IsInline = decl.IsInline;
 
@@ -1014,18 +1714,24 @@ public override AST.Declaration VisitNamespace(Namespace decl)
 
         public override AST.Declaration VisitTypedef(TypedefDecl decl)
         {
-            var _typedef = new AST.TypedefDecl();
+            var _typedef = Create<AST.TypedefDecl>(decl);
             VisitDeclaration(decl, _typedef);
-            _typedef.QualifiedType = typeConverter.VisitQualified(decl.QualifiedType);
+            var record = FindRecord(decl);
+            _typedef.QualifiedType = record != null ?
+                typeConverter.VisitQualified(record->Type) :
+                typeConverter.VisitQualified(decl.QualifiedType);
 
             return _typedef;
         }
 
         public override AST.Declaration VisitTypeAlias(TypeAlias decl)
         {
-            var _typeAlias = new AST.TypeAlias();
+            var _typeAlias = Create<AST.TypeAlias>(decl);
             VisitDeclaration(decl, _typeAlias);
-            _typeAlias.QualifiedType = typeConverter.VisitQualified(decl.QualifiedType);
+            var record = FindRecord(decl);
+            _typeAlias.QualifiedType = record != null ?
+                typeConverter.VisitQualified(record->Type) :
+                typeConverter.VisitQualified(decl.QualifiedType);
             if (decl.DescribedAliasTemplate != null)
                 _typeAlias.DescribedAliasTemplate = (AST.TypeAliasTemplate) Visit(decl.DescribedAliasTemplate);
 
@@ -1034,14 +1740,28 @@ public override AST.Declaration VisitTypeAlias(TypeAlias decl)
 
         public override AST.Declaration VisitParameter(Parameter decl)
         {
-            var _param = new AST.Parameter();
+            var _param = Create<AST.Parameter>(decl);
             VisitDeclaration(decl, _param);
 
-            _param.QualifiedType = typeConverter.VisitQualified(decl.QualifiedType);
-            _param.IsIndirect = decl.IsIndirect;
-            _param.HasDefaultValue = decl.HasDefaultValue;
-            _param.Index = decl.Index;
-            _param.DefaultArgument = VisitStatement(decl.DefaultArgument);
+            var record = FindRecord(decl);
+            if (record != null)
+            {
+                _param.QualifiedType = typeConverter.VisitQualified(record->Type);
+                _param.IsIndirect = record->IsIndirect;
+                _param.HasDefaultValue = record->HasDefaultValue;
+                _param.Index = record->Index;
+                // Only parameters with a default value have a default argument.
+                if (record->HasDefaultValue)
+                    _param.DefaultArgument = VisitStatement(decl.DefaultArgument);
+            }
+            else
+            {
+                _param.QualifiedType = typeConverter.VisitQualified(decl.QualifiedType);
+                _param.IsIndirect = decl.IsIndirect;
+                _param.HasDefaultValue = decl.HasDefaultValue;
+                _param.Index = decl.Index;
+                _param.DefaultArgument = VisitStatement(decl.DefaultArgument);
+            }
 
             return _param;
         }
@@ -1094,14 +1814,49 @@ private AST.Expression VisitStatement(Statement statement)
             expression.Declaration = Visit(statement.Decl);
             expression.String = statement.String;
 
+            var value = Expression.__CreateInstance(statement.__Instance);
+            expression.ValueKind = VisitExpressionValueKind(value.ValueKind);
+            expression.IntegerValue = value.IntegerValue;
+            expression.FloatValue = value.FloatValue;
+            if (value.ValueKind == ExpressionValueKind.String)
+                expression.StringValue = value.StringValue;
+
             return expression;
         }
 
+        private AST.ExpressionValueKind VisitExpressionValueKind(ExpressionValueKind kind)
+        {
+            switch (kind)
+            {
+                case ExpressionValueKind.None:
+                    return AST.ExpressionValueKind.None;
+                case ExpressionValueKind.SignedInteger:
+                    return AST.ExpressionValueKind.SignedInteger;
+                case ExpressionValueKind.UnsignedInteger:
+                    return AST.ExpressionValueKind.UnsignedInteger;
+                case ExpressionValueKind.Boolean:
+                    return AST.ExpressionValueKind.Boolean;
+                case ExpressionValueKind.Character:
+                    return AST.ExpressionValueKind.Character;
+                case ExpressionValueKind.Float:
+                    return AST.ExpressionValueKind.Float;
+                case ExpressionValueKind.String:
+                    return AST.ExpressionValueKind.String;
+                case ExpressionValueKind.NullPtr:
+                    return AST.ExpressionValueKind.NullPtr;
+                default:
+                    throw new NotImplementedException();
+            }
+        }
+
         public void VisitFunction(Function function, AST.Function _function)
         {
             VisitDeclaration(function, _function);
 
-            _function.ReturnType = typeConverter.VisitQualified(function.ReturnType);
+            var record = FindRecord(function);
+            _function.ReturnType = record != null ?
+                typeConverter.VisitQualified(record->Type) :
+                typeConverter.VisitQualified(function.ReturnType);
             _function.IsReturnIndirect = function.IsReturnIndirect;
             _function.HasThisReturn = function.HasThisReturn;
             _function.IsVariadic = function.IsVariadic;
@@ -1115,9 +1870,15 @@ public void VisitFunction(Function function, AST.Function _function)
             if (function.InstantiatedFrom != null)
                 _function.InstantiatedFrom = (AST.Function) Visit(function.InstantiatedFrom);
 
-            for (uint i = 0; i < function.ParametersCount; ++i)
+            if (record != null)
+            {
+                VisitChildren<AST.Parameter>(record, ASTBufferChildGroup.Parameters,
+                    _function.Parameters.Add);
+                return;
+            }
+
+            foreach (var param in function.GetParametersArray())
             {
-                var param = function.getParameters(i);
                 var _param = Visit(param) as AST.Parameter;
                 _function.Parameters.Add(_param);
             }
@@ -1125,7 +1886,7 @@ public void VisitFunction(Function function, AST.Function _function)
 
         public override AST.Declaration VisitFunction(Function decl)
         {
-            var _function = new CppSharp.AST.Function();
+            var _function = Create<AST.Function>(decl);
             VisitFunction(decl, _function);
 
             return _function;
@@ -1133,7 +1894,7 @@ public override AST.Declaration VisitFunction(Function decl)
 
         public override AST.Declaration VisitMethod(Method decl)
         {
-            var _method = new AST.Method();
+            var _method = Create<AST.Method>(decl);
             VisitFunction(decl, _method);
 
             _method.IsVirtual = decl.IsVirtual;
@@ -1297,7 +2058,7 @@ static internal AST.CallingConvention VisitCallingConvention(CallingConvention c
 
         public override AST.Declaration VisitEnumeration(Enumeration decl)
         {
-            var _enum = new AST.Enumeration();
+            var _enum = Create<AST.Enumeration>(decl);
             VisitDeclaration(decl, _enum);
 
             _enum.Modifiers = VisitEnumModifiers(decl.Modifiers);
@@ -1305,9 +2066,16 @@ public override AST.Declaration VisitEnumeration(Enumeration decl)
             _enum.BuiltinType = typeConverter.Visit(decl.BuiltinType)
                 as AST.BuiltinType;
 
-            for (uint i = 0; i < decl.ItemsCount; ++i)
+            var record = FindRecord(decl);
+            if (record != null)
+            {
+                VisitChildren<AST.Enumeration.Item>(record, ASTBufferChildGroup.Items,
+                    _item => _enum.AddItem(_item));
+                return _enum;
+            }
+
+            foreach (var item in decl.GetItemsArray())
             {
-                var item = decl.getItems(i);
                 var _item = Visit(item) as AST.Enumeration.Item;
                 _enum.AddItem(_item);
             }
@@ -1323,11 +2091,9 @@ public override AST.Declaration VisitEnumeration(Enumeration decl)
 
         public override AST.Declaration VisitEnumerationItem(Enumeration.Item decl)
         {
-            var _item = new AST.Enumeration.Item
-            {
-                Expression = decl.Expression,
-                Value = decl.Value
-            };
+            var _item = Create<AST.Enumeration.Item>(decl);
+            _item.Expression = decl.Expression;
+            _item.Value = decl.Value;
             VisitDeclaration(decl, _item);
 
             return _item;
@@ -1337,13 +2103,15 @@ public void VisitVariable(Variable decl, AST.Variable _variable)
         {
             VisitDeclaration(decl, _variable);
             _variable.Mangled = decl.Mangled;
-            _variable.QualifiedType = typeConverter.VisitQualified(
-                decl.QualifiedType);
+            var record = FindRecord(decl);
+            _variable.QualifiedType = record != null ?
+                typeConverter.VisitQualified(record->Type) :
+                typeConverter.VisitQualified(decl.QualifiedType);
         }
 
         public override AST.Declaration VisitVariable(Variable decl)
         {
-            var _variable = new AST.Variable();
+            var _variable = Create<AST.Variable>(decl);
             VisitVariable(decl, _variable);
 
             return _variable;
@@ -1351,7 +2119,7 @@ public override AST.Declaration VisitVariable(Variable decl)
 
         public override AST.Declaration VisitFriend(Friend decl)
         {
-            var _friend = new AST.Friend();
+            var _friend = Create<AST.Friend>(decl);
             VisitDeclaration(decl, _friend);
             _friend.Declaration = Visit(decl.Declaration);
 
@@ -1360,11 +2128,13 @@ public override AST.Declaration VisitFriend(Friend decl)
 
         public override AST.Declaration VisitField(Field decl)
         {
-            var _field = new AST.Field();
+            var _field = Create<AST.Field>(decl);
             VisitDeclaration(decl, _field);
 
-            _field.QualifiedType = typeConverter.VisitQualified(
-                decl.QualifiedType);
+            var record = FindRecord(decl);
+            _field.QualifiedType = record != null ?
+                typeConverter.VisitQualified(record->Type) :
+                typeConverter.VisitQualified(decl.QualifiedType);
             _field.Access = VisitAccessSpecifier(decl.Access);
             _field.Class = Visit(decl.Class) as AST.Class;
             _field.IsBitField = decl.IsBitField;
@@ -1375,7 +2145,7 @@ public override AST.Declaration VisitField(Field decl)
 
         public override AST.Declaration VisitAccessSpecifier(AccessSpecifierDecl decl)
         {
-            var _access = new AST.AccessSpecifierDecl();
+            var _access = Create<AST.AccessSpecifierDecl>(decl);
             VisitDeclaration(decl, _access);
 
             return _access;
@@ -1386,32 +2156,48 @@ void VisitClass(Class @class, AST.Class _class)
             VisitDeclaration(@class, _class);
             VisitDeclContext(@class, _class);
 
-            for (uint i = 0; i < @class.BasesCount; ++i)
+            var record = FindRecord(@class);
+            if (record != null)
             {
-                var @base = @class.getBases(i);
-                var _base = VisitBaseClassSpecifier(@base);
-                _class.Bases.Add(_base);
-            }
+                for (uint i = 0; i < record->BasesCount; ++i)
+                {
+                    var @base = ASTBuffer.GetBase(record, i);
+                    var _base = VisitBaseClassSpecifier(@base);
+                    _class.Bases.Add(_base);
+                }
 
-            for (uint i = 0; i < @class.FieldsCount; ++i)
-            {
-                var field = @class.getFields(i);
-                var _field = Visit(field) as AST.Field;
-                _class.Fields.Add(_field);
+                VisitChildren<AST.Field>(record, ASTBufferChildGroup.Fields,
+                    _class.Fields.Add);
+                VisitChildren<AST.Method>(record, ASTBufferChildGroup.Methods,
+                    _class.Methods.Add);
+                VisitChildren<AST.AccessSpecifierDecl>(record, ASTBufferChildGroup.Specifiers,
+                    _class.Specifiers.Add);
             }
-
-            for (uint i = 0; i < @class.MethodsCount; ++i)
+            else
             {
-                var method = @class.getMethods(i);
-                var _method = Visit(method) as AST.Method;
-                _class.Methods.Add(_method);
-            }
+                foreach (var @base in @class.GetBasesArray())
+                {
+                    var _base = VisitBaseClassSpecifier(@base);
+                    _class.Bases.Add(_base);
+                }
 
-            for (uint i = 0; i < @class.SpecifiersCount; ++i)
-            {
-                var spec = @class.getSpecifiers(i);
-                var _spec = Visit(spec) as AST.AccessSpecifierDecl;
-                _class.Specifiers.Add(_spec);
+                foreach (var field in @class.GetFieldsArray())
+                {
+                    var _field = Visit(field) as AST.Field;
+                    _class.Fields.Add(_field);
+                }
+
+                foreach (var method in @class.GetMethodsArray())
+                {
+                    var _method = Visit(method) as AST.Method;
+                    _class.Methods.Add(_method);
+                }
+
+                foreach (var spec in @class.GetSpecifiersArray())
+                {
+                    var _spec = Visit(spec) as AST.AccessSpecifierDecl;
+                    _class.Specifiers.Add(_spec);
+                }
             }
 
             _class.IsPOD = @class.IsPOD;
@@ -1430,7 +2216,7 @@ void VisitClass(Class @class, AST.Class _class)
 
         public override AST.Declaration VisitClass(Class @class)
         {
-            var _class = new AST.Class();
+            var _class = Create<AST.Class>(@class);
             VisitClass(@class, _class);
 
             return _class;
@@ -1572,9 +2358,8 @@ public void VisitTemplate(Template template, AST.Template _template)
 
             _template.TemplatedDecl = Visit(template.TemplatedDecl);
 
-            for (uint i = 0; i < template.ParametersCount; ++i)
+            foreach (var param in template.GetParametersArray())
             {
-                var param = template.getParameters(i);
                 var _param = Visit(param);
                 _template.Parameters.Add(_param);
             }
@@ -1582,7 +2367,7 @@ public void VisitTemplate(Template template, AST.Template _template)
 
         public override AST.Declaration VisitTypeAliasTemplate(TypeAliasTemplate decl)
         {
-            var _decl = new AST.TypeAliasTemplate();
+            var _decl = Create<AST.TypeAliasTemplate>(decl);
             VisitTemplate(decl, _decl);
 
             return _decl;
@@ -1590,11 +2375,10 @@ public override AST.Declaration VisitTypeAliasTemplate(TypeAliasTemplate decl)
 
         public override AST.Declaration VisitClassTemplate(ClassTemplate decl)
         {
-            var _decl = new AST.ClassTemplate();
+            var _decl = Create<AST.ClassTemplate>(decl);
             VisitTemplate(decl, _decl);
-            for (uint i = 0; i < decl.SpecializationsCount; ++i)
+            foreach (var spec in decl.GetSpecializationsArray())
             {
-                var spec = decl.getSpecializations(i);
                 var _spec = (AST.ClassTemplateSpecialization)Visit(spec);
                 _decl.Specializations.Add(_spec);
             }
@@ -1604,7 +2388,7 @@ public override AST.Declaration VisitClassTemplate(ClassTemplate decl)
         public override AST.Declaration VisitClassTemplateSpecialization(
             ClassTemplateSpecialization decl)
         {
-            var _decl = new AST.ClassTemplateSpecialization();
+            var _decl = Create<AST.ClassTemplateSpecialization>(decl);
             VisitClassTemplateSpecialization(decl, _decl);
             return _decl;
         }
@@ -1680,18 +2464,18 @@ private AST.TemplateSpecializationKind VisitSpecializationKind(TemplateSpecializ
         public override AST.Declaration VisitClassTemplatePartialSpecialization(
             ClassTemplatePartialSpecialization decl)
         {
-            var _decl = new AST.ClassTemplatePartialSpecialization();
+            var _decl = Create<AST.ClassTemplatePartialSpecialization>(decl);
             VisitClassTemplateSpecialization(decl, _decl);
             return _decl;
         }
 
         public override AST.Declaration VisitFunctionTemplate(FunctionTemplate decl)
         {
-            var _decl = new AST.FunctionTemplate();
+            var _decl = Create<AST.FunctionTemplate>(decl);
             VisitTemplate(decl, _decl);
-            for (uint i = 0; i < decl.SpecializationsCount; ++i)
+            foreach (var spec in decl.GetSpecializationsArray())
             {
-                var _spec = VisitFunctionTemplateSpecialization(decl.getSpecializations(i));
+                var _spec = VisitFunctionTemplateSpecialization(spec);
                 _decl.Specializations.Add(_spec);
             }
             return _decl;
@@ -1711,18 +2495,16 @@ private AST.FunctionTemplateSpecialization VisitFunctionTemplateSpecialization(F
                 var _arg = VisitTemplateArgument(spec.getArguments(i));
                 _spec.Arguments.Add(_arg);
             }
-            FunctionTemplateSpecializations.Add(spec.__Instance, _spec);
             NativeObjects.Add(spec);
-            return _spec;
+            return FunctionTemplateSpecializations.GetOrAdd(spec.__Instance, _spec);
         }
 
         public override AST.Declaration VisitVarTemplate(VarTemplate decl)
         {
-            var _decl = new AST.VarTemplate();
+            var _decl = Create<AST.VarTemplate>(decl);
             VisitTemplate(decl, _decl);
-            for (uint i = 0; i < decl.SpecializationsCount; ++i)
+            foreach (var spec in decl.GetSpecializationsArray())
             {
-                var spec = decl.getSpecializations(i);
                 var _spec = (AST.VarTemplateSpecialization)Visit(spec);
                 _decl.Specializations.Add(_spec);
             }
@@ -1732,7 +2514,7 @@ public override AST.Declaration VisitVarTemplate(VarTemplate decl)
         public override AST.Declaration VisitVarTemplateSpecialization(
             VarTemplateSpecialization decl)
         {
-            var _decl = new AST.VarTemplateSpecialization();
+            var _decl = Create<AST.VarTemplateSpecialization>(decl);
             VisitVarTemplateSpecialization(decl, _decl);
             return _decl;
         }
@@ -1753,7 +2535,7 @@ private void VisitVarTemplateSpecialization(VarTemplateSpecialization decl, AST.
         public override AST.Declaration VisitVarTemplatePartialSpecialization(
             VarTemplatePartialSpecialization decl)
         {
-            var _decl = new AST.VarTemplatePartialSpecialization();
+            var _decl = Create<AST.VarTemplatePartialSpecialization>(decl);
             VisitVarTemplateSpecialization(decl, _decl);
             return _decl;
         }
@@ -1829,7 +2611,7 @@ public AST.MacroExpansion VisitMacroExpansion(MacroExpansion macroExpansion)
 
         public override AST.Declaration VisitTypeTemplateParameter(TypeTemplateParameter decl)
         {
-            var templateParameter = new AST.TypeTemplateParameter();
+            var templateParameter = Create<AST.TypeTemplateParameter>(decl);
             VisitDeclaration(decl, templateParameter);
             templateParameter.DefaultArgument = typeConverter.VisitQualified(decl.DefaultArgument);
             templateParameter.Depth = decl.Depth;
@@ -1840,7 +2622,7 @@ public override AST.Declaration VisitTypeTemplateParameter(TypeTemplateParameter
 
         public override AST.Declaration VisitNonTypeTemplateParameter(NonTypeTemplateParameter decl)
         {
-            var nonTypeTemplateParameter = new AST.NonTypeTemplateParameter();
+            var nonTypeTemplateParameter = Create<AST.NonTypeTemplateParameter>(decl);
             VisitDeclaration(decl, nonTypeTemplateParameter);
             nonTypeTemplateParameter.DefaultArgument = VisitStatement(decl.DefaultArgument);
             nonTypeTemplateParameter.Depth = decl.Depth;
@@ -1854,7 +2636,7 @@ public override AST.Declaration VisitNonTypeTemplateParameter(NonTypeTemplatePar
 
         public override AST.Declaration VisitTemplateTemplateParameter(TemplateTemplateParameter decl)
         {
-            var templateTemplateParameter = new AST.TemplateTemplateParameter();
+            var templateTemplateParameter = Create<AST.TemplateTemplateParameter>(decl);
             VisitTemplate(decl, templateTemplateParameter);
             templateTemplateParameter.IsParameterPack = decl.IsParameterPack;
             templateTemplateParameter.IsPackExpansion = decl.IsPackExpansion;
@@ -1868,8 +2650,8 @@ public unsafe class CommentConverter : CommentsVisitor<AST.Comment>
         public override AST.Comment VisitFullComment(FullComment comment)
         {
             var fullComment = new AST.FullComment();
-            for (uint i = 0; i < comment.BlocksCount; i++)
-                fullComment.Blocks.Add((AST.BlockContentComment) Visit(comment.getBlocks(i)));
+            foreach (var block in comment.GetBlocksArray())
+                fullComment.Blocks.Add((AST.BlockContentComment) Visit(block));
             return fullComment;
         }
 
@@ -1912,8 +2694,8 @@ protected override AST.Comment VisitTParamCommandComment(TParamCommandComment co
         protected override AST.Comment VisitVerbatimBlockComment(VerbatimBlockComment comment)
         {
             var verbatimBlockComment = new AST.VerbatimBlockComment();
-            for (uint i = 0; i < comment.LinesCount; i++)
-                verbatimBlockComment.Lines.Add((AST.VerbatimBlockLineComment) Visit(comment.getLines(i)));
+            foreach (var line in comment.GetLinesArray())
+                verbatimBlockComment.Lines.Add((AST.VerbatimBlockLineComment) Visit(line));
             VisitBlockCommandComment(verbatimBlockComment, comment);
             return verbatimBlockComment;
         }
@@ -1928,8 +2710,8 @@ protected override AST.Comment VisitVerbatimLineComment(VerbatimLineComment comm
         protected override AST.Comment VisitParagraphComment(ParagraphComment comment)
         {
             var paragraphComment = new AST.ParagraphComment();
-            for (uint i = 0; i < comment.ContentCount; i++)
-                paragraphComment.Content.Add((AST.InlineContentComment) Visit(comment.getContent(i)));
+            foreach (var content in comment.GetContentArray())
+                paragraphComment.Content.Add((AST.InlineContentComment) Visit(content));
             paragraphComment.IsWhitespace = comment.IsWhitespace;
             return paragraphComment;
         }
@@ -0,0 +1,101 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using CppSharp.AST;
+using NativeLibrary = CppSharp.AST.NativeLibrary;
+using SymbolVariant = CppSharp.Parser.AST.SymbolVariant;
+
+namespace CppSharp
+{
+    /// <summary>
+    /// Resolves symbols through the symbol indices of the native libraries
+    /// read by the parser. The mangling variants of all the symbols of a
+    /// lookup are probed natively in a single call.
+    /// </summary>
+    public unsafe class NativeSymbolResolver : ISymbolResolver, IDisposable
+    {
+        private readonly Parser.AST.SymbolContext symbolContext = new Parser.AST.SymbolContext();
+        private readonly List<Parser.AST.NativeLibrary> nativeLibraries = new List<Parser.AST.NativeLibrary>();
+        private readonly List<NativeLibrary> libraries = new List<NativeLibrary>();
+
+        /// <summary>
+        /// Adds a library read by the parser along with its managed
+        /// counterpart. The native library is disposed with the resolver.
+        /// </summary>
+        public void AddLibrary(Parser.AST.NativeLibrary nativeLibrary, NativeLibrary library)
+        {
+            symbolContext.addLibraries(nativeLibrary);
+            nativeLibraries.Add(nativeLibrary);
+            libraries.Add(library);
+        }
+
+        public NativeLibrary FindLibraryBySymbol(string symbol)
+        {
+            var index = symbolContext.FindLibraryBySymbol(symbol);
+            return index < 0 ? null : libraries[index];
+        }
+
+        public NativeLibrary[] ResolveSymbols(IList<string> symbols)
+        {
+            var count = symbols.Count;
+            var names = new IntPtr[count];
+            var indices = new int[count];
+            var variants = new SymbolVariant[count];
+
+            try
+            {
+                for (var i = 0; i < count; i++)
+                    names[i] = Marshal.StringToHGlobalAnsi(symbols[i]);
+
+                fixed (IntPtr* namesPtr = names)
+                fixed (int* indicesPtr = indices)
+                fixed (SymbolVariant* variantsPtr = variants)
+                    symbolContext.ResolveSymbols((sbyte**) namesPtr, (uint) count,
+                        indicesPtr, variantsPtr);
+            }
+            finally
+            {
+                foreach (var name in names)
+                    Marshal.FreeHGlobal(name);
+            }
+
+            var result = new NativeLibrary[count];
+            for (var i = 0; i < count; i++)
+            {
+                if (indices[i] < 0)
+                    continue;
+
+                result[i] = libraries[indices[i]];
+                symbols[i] = GetVariant(symbols[i], variants[i]);
+            }
+
+            return result;
+        }
+
+        private static string GetVariant(string symbol, SymbolVariant variant)
+        {
+            switch (variant)
+            {
+                case SymbolVariant.LeadingUnderscore:
+                    return "_" + symbol;
+                case SymbolVariant.TrimmedUnderscores:
+                    return symbol.TrimStart('_');
+                case SymbolVariant.ImpPrefix:
+                    return "_imp_" + symbol;
+                case SymbolVariant.DoubleImpPrefix:
+                    return "__imp_" + symbol;
+                default:
+                    return symbol;
+            }
+        }
+
+        public void Dispose()
+        {
+            foreach (var nativeLibrary in nativeLibraries)
+                nativeLibrary.Dispose();
+            nativeLibraries.Clear();
+            libraries.Clear();
+            symbolContext.Dispose();
+        }
+    }
+}
@@ -1,6 +1,8 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
+using System.Threading.Tasks;
 using CppSharp.AST;
 using CppSharp.Parser;
 using ASTContext = CppSharp.Parser.AST.ASTContext;
@@ -15,6 +17,31 @@ public class ClangParser
         /// </summary>
         public ASTContext ASTContext { get; private set; }
 
+        /// <summary>
+        /// Contexts of the shards of a sharded parse, which are converted
+        /// together with the main context.
+        /// </summary>
+        public IList<ASTContext> ShardASTContexts { get; private set; }
+
+        /// <summary>
+        /// Pool of worker processes parsing the source files out of process,
+        /// if any. The headers crashing their worker are reported and skipped.
+        /// </summary>
+        public ParserWorkerPool WorkerPool { get; set; }
+
+        /// <summary>
+        /// If set, ParseProject converts each source file as soon as it is
+        /// parsed and frees its native AST, so that the native ASTs of the
+        /// whole project are never alive at the same time. The result is
+        /// then returned by ConvertASTContexts.
+        /// </summary>
+        public bool StreamASTConversion { get; set; }
+
+        // Converter and managed context the source files are converted into
+        // as they are parsed, when the conversion is streamed.
+        ASTConverter streamingConverter;
+        AST.ASTContext streamedASTContext;
+
         /// <summary>
         /// Fired when source files are parsed.
         /// </summary>
@@ -25,14 +52,20 @@ public class ClangParser
         /// </summary>
         public Action<string, ParserResult> LibraryParsed = delegate {};
 
+        /// <summary>
+        /// Fired when library files are parsed together.
+        /// </summary>
+        public Action<IList<string>, ParserResult> LibrariesParsed = delegate {};
+
         public ClangParser()
+            : this(new ASTContext())
         {
-            ASTContext = new ASTContext();
         }
 
         public ClangParser(ASTContext context)
         {
             ASTContext = context;
+            ShardASTContexts = new List<ASTContext>();
         }
 
         /// <summary>
@@ -76,19 +109,195 @@ private void ParseSourceFiles(IList<SourceFile> files)
                 SourcesParsed(files, result);
         }
 
+        /// <summary>
+        /// Parses the source files in unity batches, grouped by their parser
+        /// options and directory. The batches are parsed concurrently, each
+        /// into its own shard context.
+        /// </summary>
+        private void ParseShards(IList<SourceFile> files, int shards)
+        {
+            var batchSize = (files.Count + shards - 1) / shards;
+            var batches = new List<List<SourceFile>>();
+
+            // Files sharing a directory tend to share their includes, so keep
+            // them in the same batch. Batches never mix parser options.
+            foreach (var group in files.GroupBy(f => GetOptionsKey(f.Options)))
+            {
+                var sorted = group.OrderBy(f => System.IO.Path.GetDirectoryName(f.Path),
+                    StringComparer.Ordinal).ToList();
+
+                for (var i = 0; i < sorted.Count; i += batchSize)
+                    batches.Add(sorted.Skip(i).Take(batchSize).ToList());
+            }
+
+            var contexts = batches.Select(b => new ASTContext()).ToList();
+            var parsedLock = new object();
+
+            Parallel.For(0, batches.Count, i =>
+            {
+                var batch = batches[i];
+
+                // The files of the batch share their options, which are copied
+                // so the first file's own options are left as they were.
+                using (var options = new ParserOptions(batch[0].Options))
+                {
+                    options.ASTContext = contexts[i];
+
+                    foreach (var file in batch)
+                        options.addSourceFiles(file.Path);
+
+                    using (var result = Parser.ClangParser.ParseHeader(options))
+                        lock (parsedLock)
+                            SourcesParsed(batch, result);
+                }
+            });
+
+            foreach (var context in contexts)
+                ShardASTContexts.Add(context);
+        }
+
+        static string GetOptionsKey(ParserOptions options)
+        {
+            var key = new List<string>();
+
+            for (uint i = 0; i < options.ArgumentsCount; ++i)
+                key.Add(options.getArguments(i));
+            for (uint i = 0; i < options.IncludeDirsCount; ++i)
+                key.Add(options.getIncludeDirs(i));
+            for (uint i = 0; i < options.SystemIncludeDirsCount; ++i)
+                key.Add(options.getSystemIncludeDirs(i));
+            for (uint i = 0; i < options.DefinesCount; ++i)
+                key.Add(options.getDefines(i));
+            for (uint i = 0; i < options.UndefinesCount; ++i)
+                key.Add(options.getUndefines(i));
+
+            return string.Join("\n", key);
+        }
+
+        /// <summary>
+        /// Precompiles each source file in a worker process, then parses it
+        /// from its precompiled header, which only needs the declarations to
+        /// be read back. The files are handled concurrently, and each is read
+        /// back as soon as its header is built.
+        /// </summary>
+        /// <remarks>
+        /// The workers also walk each header the same way it is walked here,
+        /// so a header which crashes the parser or the walker is reported as
+        /// failed and skipped before it is read back in this process.
+        /// </remarks>
+        private void ParseSourceFilesInWorkers(IList<SourceFile> files)
+        {
+            var parsedLock = new object();
+
+            Parallel.For(0, files.Count,
+                new ParallelOptions { MaxDegreeOfParallelism = WorkerPool.Count },
+                i =>
+                {
+                    var file = files[i];
+                    var precompiledHeader = Path.Combine(Path.GetTempPath(),
+                        "CppSharp-" + Guid.NewGuid().ToString("N") + ".pch");
+
+                    try
+                    {
+                        using (var result = WorkerPool.Precompile(file.Options,
+                            new[] { file.Path }, precompiledHeader))
+                        {
+                            if (result.Kind != ParserResultKind.Success)
+                            {
+                                lock (parsedLock)
+                                    SourcesParsed(new[] { file }, result);
+                                return;
+                            }
+                        }
+
+                        // The options of the file are left as they are, so that
+                        // it can be parsed again.
+                        using (var options = new ParserOptions(file.Options))
+                        {
+                            options.ASTContext = ASTContext;
+                            options.addArguments("-include-pch");
+                            options.addArguments(precompiledHeader);
+                            options.addSourceFiles(file.Path);
+
+                            using (var result = Parser.ClangParser.ParseHeader(options))
+                                lock (parsedLock)
+                                    SourcesParsed(new[] { file }, result);
+                        }
+                    }
+                    finally
+                    {
+                        File.Delete(precompiledHeader);
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Parses each source file into its own native context, which is
+        /// converted and freed as soon as the file is parsed.
+        /// </summary>
+        private void ParseSourceFilesStreaming(IList<SourceFile> files)
+        {
+            if (streamingConverter == null)
+            {
+                streamingConverter = new ASTConverter();
+                streamedASTContext = new AST.ASTContext();
+            }
+
+            foreach (var file in files)
+            {
+                var context = new ASTContext();
+
+                // The options of the file are left as they are, so that it
+                // can be parsed again.
+                using (var options = new ParserOptions(file.Options))
+                {
+                    options.ASTContext = context;
+                    options.addSourceFiles(file.Path);
+
+                    using (var result = Parser.ClangParser.ParseHeader(options))
+                        SourcesParsed(new[] { file }, result);
+                }
+
+                streamingConverter.ConvertAndRelease(context, streamedASTContext);
+            }
+        }
+
         /// <summary>
         /// Parses the project source files.
         /// </summary>
-        public void ParseProject(Project project, bool unityBuild)
+        public void ParseProject(Project project, bool unityBuild, int shards = 1)
         {
             // TODO: Search for cached AST trees on disk
-            // TODO: Do multi-threaded parsing of source files
 
             if (unityBuild)
+            {
                 ParseSourceFiles(project.Sources);
-            else
-                foreach (var parserResult in project.Sources.Select(s => ParseSourceFile(s)).ToList())
-                    parserResult.Dispose();
+                return;
+            }
+
+            if (shards > 1 && project.Sources.Count > 1)
+            {
+                ParseShards(project.Sources, shards);
+                return;
+            }
+
+            if (WorkerPool != null)
+            {
+                ParseSourceFilesInWorkers(project.Sources);
+                return;
+            }
+
+            if (StreamASTConversion)
+            {
+                ParseSourceFilesStreaming(project.Sources);
+                return;
+            }
+
+            // Release the compiler state of each source file as soon as it
+            // is parsed, so that only the declarations are kept around until
+            // the AST is converted instead of every Clang AST of the project.
+            foreach (var source in project.Sources)
+                ParseSourceFile(source).Dispose();
         }
 
         /// <summary>
@@ -105,14 +314,64 @@ public ParserResult ParseLibrary(string file, ParserOptions options)
         }
 
         /// <summary>
-        /// Converts a native parser AST to a managed AST.
+        /// Parses library files with symbols. The library directories are
+        /// searched once and the libraries are then read in parallel.
         /// </summary>
-        static public AST.ASTContext ConvertASTContext(ASTContext context)
+        public ParserResult ParseLibraries(IList<string> files, ParserOptions options)
         {
-            var converter = new ASTConverter(context);
+            options.clearLibraryFiles();
+            foreach (var file in files)
+                options.addLibraryFiles(file);
+
+            var result = Parser.ClangParser.ParseLibraries(options);
+            LibrariesParsed(files, result);
+
+            return result;
+        }
+
+        /// <summary>
+        /// Converts a native parser AST to a managed AST, optionally
+        /// converting its translation units in parallel. The native context
+        /// is disposed unless it is kept to be reparsed incrementally.
+        /// </summary>
+        static public AST.ASTContext ConvertASTContext(ASTContext context,
+            bool parallel = false, bool keepContext = false)
+        {
+            var converter = new ASTConverter(context)
+            {
+                ConvertInParallel = parallel,
+                KeepContext = keepContext
+            };
             return converter.Convert();
         }
 
+        /// <summary>
+        /// Converts the main context of the parser and the contexts of its
+        /// shards to a single managed AST.
+        /// </summary>
+        public AST.ASTContext ConvertASTContexts(bool parallel = false)
+        {
+            if (streamedASTContext != null)
+            {
+                // The source files were already converted as they were parsed,
+                // the main context was only used for the target info.
+                var _ctx = streamedASTContext;
+                streamingConverter = null;
+                streamedASTContext = null;
+                ASTContext.Dispose();
+                return _ctx;
+            }
+
+            if (ShardASTContexts.Count == 0)
+                return ConvertASTContext(ASTContext, parallel);
+
+            var contexts = new List<ASTContext> { ASTContext };
+            contexts.AddRange(ShardASTContexts);
+            ShardASTContexts.Clear();
+
+            return new ASTConverter(contexts).Convert();
+        }
+
         public static AST.NativeLibrary ConvertLibrary(NativeLibrary library)
         {
             var newLibrary = new AST.NativeLibrary
@@ -10,6 +10,11 @@ public ParserOptions()
             MicrosoftMode = !Platform.IsUnixPlatform;
         }
 
+        public ParserOptions(ParserOptions options)
+            : base(options)
+        {
+        }
+
         public bool IsItaniumLikeAbi { get { return Abi != CppAbi.Microsoft; } }
         public bool IsMicrosoftAbi { get { return Abi == CppAbi.Microsoft; } }
 
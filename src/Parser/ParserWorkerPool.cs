@@ -0,0 +1,198 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using CppSharp.Parser;
+
+namespace CppSharp
+{
+    /// <summary>
+    /// Pool of parser worker processes (CppSharp.CppParser.Worker) which
+    /// precompile headers out of process. A header crashing the parser only
+    /// takes down its worker, which is reported as an error for the header
+    /// and restarted.
+    /// </summary>
+    public class ParserWorkerPool : IDisposable
+    {
+        readonly string workerPath;
+        readonly BlockingCollection<Process> idleWorkers = new BlockingCollection<Process>();
+
+        public ParserWorkerPool(int count)
+            : this(DefaultWorkerPath, count)
+        {
+        }
+
+        public ParserWorkerPool(string workerPath, int count)
+        {
+            if (count <= 0)
+                throw new ArgumentOutOfRangeException("count");
+
+            this.workerPath = workerPath;
+            Count = count;
+
+            for (var i = 0; i < count; i++)
+                idleWorkers.Add(StartWorker());
+        }
+
+        /// <summary>
+        /// Path of the worker executable next to the parser assemblies.
+        /// </summary>
+        public static string DefaultWorkerPath
+        {
+            get
+            {
+                var name = "CppSharp.CppParser.Worker" + (Platform.IsWindows ? ".exe" : string.Empty);
+                return Path.Combine(AppDomain.CurrentDomain.BaseDirectory, name);
+            }
+        }
+
+        /// <summary>
+        /// Number of worker processes.
+        /// </summary>
+        public int Count { get; private set; }
+
+        /// <summary>
+        /// Precompiles source files into a file which can then be parsed
+        /// in-process with "-include-pch". Can be called concurrently, up to
+        /// the number of workers.
+        /// </summary>
+        public ParserResult Precompile(ParserOptions options, IList<string> files,
+            string outputFile)
+        {
+            var worker = idleWorkers.Take();
+            var result = new ParserResult();
+            var replied = false;
+
+            try
+            {
+                WriteRequest(worker.StandardInput, options, files, outputFile);
+                replied = ReadResult(worker.StandardOutput, result);
+            }
+            catch (IOException)
+            {
+            }
+            finally
+            {
+                if (!replied)
+                {
+                    worker.WaitForExit();
+                    worker.Dispose();
+                    worker = StartWorker();
+                }
+
+                idleWorkers.Add(worker);
+            }
+
+            if (replied)
+                return result;
+
+            // The worker exited before replying, so the header crashed it.
+            result.Kind = ParserResultKind.Error;
+            using (var diagnostic = new ParserDiagnostic
+            {
+                FileName = files.Count > 0 ? files[0] : string.Empty,
+                Message = "The parser worker crashed while parsing " + string.Join(", ", files),
+                Level = ParserDiagnosticLevel.Fatal
+            })
+                result.addDiagnostics(diagnostic);
+
+            return result;
+        }
+
+        Process StartWorker()
+        {
+            var startInfo = new ProcessStartInfo(workerPath)
+            {
+                UseShellExecute = false,
+                CreateNoWindow = true,
+                RedirectStandardInput = true,
+                RedirectStandardOutput = true
+            };
+
+            return Process.Start(startInfo);
+        }
+
+        static void WriteRequest(TextWriter writer, ParserOptions options,
+            IList<string> files, string outputFile)
+        {
+            for (uint i = 0; i < options.ArgumentsCount; ++i)
+                writer.WriteLine("argument " + options.getArguments(i));
+            for (uint i = 0; i < options.IncludeDirsCount; ++i)
+                writer.WriteLine("include " + options.getIncludeDirs(i));
+            for (uint i = 0; i < options.SystemIncludeDirsCount; ++i)
+                writer.WriteLine("system-include " + options.getSystemIncludeDirs(i));
+            for (uint i = 0; i < options.DefinesCount; ++i)
+                writer.WriteLine("define " + options.getDefines(i));
+            for (uint i = 0; i < options.UndefinesCount; ++i)
+                writer.WriteLine("undefine " + options.getUndefines(i));
+
+            if (!string.IsNullOrEmpty(options.TargetTriple))
+                writer.WriteLine("triple " + options.TargetTriple);
+            writer.WriteLine("abi " + (int) options.Abi);
+            writer.WriteLine("language " + (int) options.LanguageVersion);
+            writer.WriteLine("toolset " + options.ToolSetToUse);
+
+            if (options.MicrosoftMode)
+                writer.WriteLine("microsoft-mode");
+            if (options.NoStandardIncludes)
+                writer.WriteLine("no-standard-includes");
+            if (options.NoBuiltinIncludes)
+                writer.WriteLine("no-builtin-includes");
+
+            foreach (var file in files)
+                writer.WriteLine("source " + file);
+
+            writer.WriteLine("output " + outputFile);
+            writer.WriteLine("parse");
+            writer.Flush();
+        }
+
+        static bool ReadResult(TextReader reader, ParserResult result)
+        {
+            string line;
+            while ((line = reader.ReadLine()) != null)
+            {
+                var fields = line.Split(new[] { ' ' }, 5);
+
+                if (fields[0] == "result")
+                {
+                    result.Kind = (ParserResultKind) int.Parse(fields[1],
+                        CultureInfo.InvariantCulture);
+                    return true;
+                }
+
+                if (fields[0] != "diagnostic" || fields.Length < 5)
+                    continue;
+
+                var location = fields[4].Split(new[] { '\t' }, 2);
+                using (var diagnostic = new ParserDiagnostic
+                {
+                    Level = (ParserDiagnosticLevel) int.Parse(fields[1],
+                        CultureInfo.InvariantCulture),
+                    LineNumber = int.Parse(fields[2], CultureInfo.InvariantCulture),
+                    ColumnNumber = int.Parse(fields[3], CultureInfo.InvariantCulture),
+                    FileName = location[0],
+                    Message = location.Length > 1 ? location[1] : string.Empty
+                })
+                    result.addDiagnostics(diagnostic);
+            }
+
+            return false;
+        }
+
+        public void Dispose()
+        {
+            idleWorkers.CompleteAdding();
+
+            foreach (var worker in idleWorkers.GetConsumingEnumerable())
+            {
+                // Closing the input makes the worker exit once it is idle.
+                worker.StandardInput.Close();
+                worker.WaitForExit();
+                worker.Dispose();
+            }
+        }
+    }
+}
@@ -72,3 +72,8 @@ class ClassWithAbstractOperator
 {
   virtual operator int() = 0;
 };
+
+// Tests default arguments folded to typed values
+constexpr int TestDefaultArgSquare(int x) { return x * x; }
+void TestDefaultArgValues(int i = 2 + 3, float f = 0.5f, const char* s = "a\"b",
+                          void* p = nullptr, int c = TestDefaultArgSquare(3));
@@ -0,0 +1,34 @@
+#include "SpecializationsSystem.h"
+
+template <>
+struct SpecializationBox<double>
+{
+    double Value;
+    int Precision;
+};
+
+struct SpecializationUser
+{
+    SpecializationBox<int> Int;
+    SpecializationBox<float> Float;
+    SpecializationPair<int> Pair;
+    SpecializationBox<double> Double;
+};
+
+template <typename T, typename U>
+T SpecializationConvert(U value) { return T(value); }
+
+// Only the first argument is written, the second one is deduced.
+template <>
+inline int SpecializationConvert<int>(float value) { return (int) value; }
+
+template <typename... Args>
+int SpecializationCount(Args... args) { return sizeof...(Args); }
+
+// The written arguments are converted to a single pack argument.
+template <>
+inline int SpecializationCount<int, char>(int a, char b) { return 2; }
+
+// None of the arguments are written.
+template <>
+inline int SpecializationCount(double a) { return 1; }
@@ -0,0 +1,19 @@
+#pragma GCC system_header
+
+template <typename T>
+struct SpecializationBox
+{
+    T Value;
+};
+
+template <typename T>
+struct SpecializationPair
+{
+    T First;
+    T Second;
+};
+
+struct SystemSpecializationUser
+{
+    SpecializationBox<char> Box;
+};
@@ -0,0 +1,15 @@
+struct TargetLayoutsPointer
+{
+    char Tag;
+    void* Pointer;
+    long Value;
+};
+
+struct TargetLayoutsValue
+{
+    TargetLayoutsValue(const TargetLayoutsValue& other);
+    int Value;
+};
+
+TargetLayoutsValue TargetLayoutsReturnByValue();
+void TargetLayoutsTakeByValue(int a, TargetLayoutsValue b);